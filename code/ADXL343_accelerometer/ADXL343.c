@@ -35,6 +35,9 @@ static uint8_t _doubleTapStatus;
 	#include "../Atmega328p_SPI/Atmega328p_SPI.h"
 #else
 	#include "../pFleury_i2c_stuff/i2cmaster.h"
+	
+	/* Address and bit rate of the ADXL343 on the i2c bus */
+	static const i2c_device_t _adxlDevice = I2C_DEVICE(I2C_WRITE_ADDR, ADXL343_I2C_BITRATE);
 #endif /* ADXL343_SPI_MODE */
 
 /*
@@ -55,28 +58,15 @@ void ADXL343_setup_axis_read() {
 		A328p_SPI_transfer_data_to_reg(SPI_WRITE | SPI_SINGLEBYTE | POWER_CTL,	 0x08);
 		return;
 	#else
-		/* I2C Comms */
-		i2c_init();
-		i2c_set_bitrate(ADXL343_I2C_BITRATE);
-		i2c_start_wait(I2C_WRITE_ADDR);
-		i2c_write(BW_RATE);
-		i2c_write(0x0D);
-		i2c_stop();
-		
-		i2c_start_wait(I2C_WRITE_ADDR);
-		i2c_write(POWER_CTL);
-		i2c_write(0x08);
-		i2c_stop();
-		
-		i2c_start_wait(I2C_WRITE_ADDR);
-		i2c_write(DATA_FORMAT);
-		i2c_write(0x07);
-		i2c_stop();
+		/* I2C Comms, BW_RATE and POWER_CTL are next to each other so go in one burst */
+		uint8_t rateAndPower[2] = {0x0D, 0x08};
+		uint8_t dataFormat = 0x07;
+		uint8_t fifoControl = 0x00;
 		
-		i2c_start_wait(I2C_WRITE_ADDR);
-		i2c_write(FIFO_CTL);
-		i2c_write(0x00);
-		i2c_stop();
+		i2c_init();
+		i2c_write_regs(&_adxlDevice, BW_RATE, rateAndPower, 2);
+		i2c_write_regs(&_adxlDevice, DATA_FORMAT, &dataFormat, 1);
+		i2c_write_regs(&_adxlDevice, FIFO_CTL, &fifoControl, 1);
 		return;
 	#endif /* ADXL343_SPI_MODE */
 }
@@ -118,17 +108,15 @@ void ADXL343_update_axis_readings() {
 		return;
 	#else
 		/* I2C Comms */
-		i2c_set_bitrate(ADXL343_I2C_BITRATE);
-		i2c_start_wait(0xA6);
-		i2c_write(X_DATA_0);
-		i2c_rep_start(0xA7);
-		x0 = i2c_readAck();
-		x1 = i2c_readAck();
-		y0 = i2c_readAck();
-		y1 = i2c_readAck();
-		z0 = i2c_readAck();
-		z1 = i2c_readNak();
-		i2c_stop();
+		uint8_t axisData[6] = {0, 0, 0, 0, 0, 0};
+		
+		i2c_read_regs(&_adxlDevice, X_DATA_0, axisData, 6);
+		x0 = axisData[0];
+		x1 = axisData[1];
+		y0 = axisData[2];
+		y1 = axisData[3];
+		z0 = axisData[4];
+		z1 = axisData[5];
 		
 		/* Combine all accelerometer data into integers */
  		x = (x1 << 8) | x0;
@@ -224,55 +212,33 @@ void ADXL343_double_tap_init() {
 	
 	#else
 	/* I2C COMMS */
-	i2c_set_bitrate(ADXL343_I2C_BITRATE);
-	
-	 /* Disable interrupts for double tap */
-	i2c_start_wait(I2C_WRITE_ADDR);
-	i2c_write(ADXL343_INT_ENABLE_CONTROL);
-	i2c_write(0x00);
-	i2c_stop();
+	uint8_t value;
 	
-	/* Set tap duration */
-	i2c_start_wait(I2C_WRITE_ADDR);
-	i2c_write(ADXL343_TAP_DURATION);
-	i2c_write(0x15);
-	i2c_stop();
+	/* Tap duration, latency and window are next to each other so go in one burst */
+	uint8_t tapTiming[3] = {0x15, 0x10, 0xF0};
 	
-	/* Set tap latency */
-	i2c_start_wait(I2C_WRITE_ADDR);
-	i2c_write(ADXL343_TAP_LATENCY);
-	i2c_write(0x10);
-	i2c_stop();
+	/* Disable interrupts for double tap */
+	value = 0x00;
+	i2c_write_regs(&_adxlDevice, ADXL343_INT_ENABLE_CONTROL, &value, 1);
 	
-	/* Set tap window */
-	i2c_start_wait(I2C_WRITE_ADDR);
-	i2c_write(ADXL343_TAP_WINDOW);
-	i2c_write(0xF0);
-	i2c_stop();
+	/* Set tap duration, latency and window */
+	i2c_write_regs(&_adxlDevice, ADXL343_TAP_DURATION, tapTiming, 3);
 	
-	/* Set tap threshold */
-	i2c_start_wait(I2C_WRITE_ADDR);
-	i2c_write(ADXL343_TAP_THRESHOLD);
-	i2c_write(0x80);
-	i2c_stop();
+	/* Set tap threshold, on its own so the offset registers after it are left alone */
+	value = 0x80;
+	i2c_write_regs(&_adxlDevice, ADXL343_TAP_THRESHOLD, &value, 1);
 	
 	/* Activate y-axis */
-	i2c_start_wait(I2C_WRITE_ADDR);
-	i2c_write(ADXL343_TAP_AXES);
-	i2c_write(0x02);
-	i2c_stop();
+	value = 0x02;
+	i2c_write_regs(&_adxlDevice, ADXL343_TAP_AXES, &value, 1);
 	
 	/* Double tap triggers INT1 */
-	i2c_start_wait(I2C_WRITE_ADDR);
-	i2c_write(ADXL343_INTERRUPT_MAPPING_CONTROL);
-	i2c_write(0x00);
-	i2c_stop();
+	value = 0x00;
+	i2c_write_regs(&_adxlDevice, ADXL343_INTERRUPT_MAPPING_CONTROL, &value, 1);
 	
 	/* Enable interrupts for double tap */
-	i2c_start_wait(I2C_WRITE_ADDR);
-	i2c_write(ADXL343_INT_ENABLE_CONTROL);
-	i2c_write(0x20);
-	i2c_stop();
+	value = 0x20;
+	i2c_write_regs(&_adxlDevice, ADXL343_INT_ENABLE_CONTROL, &value, 1);
 	
 	#endif /* ADXL343_SPI_MODE */
 }
@@ -291,14 +257,9 @@ void ADXL343_clear_double_tap() {
 	/* SPI COMMS */
 	
 	#else
-	/* I2C COMMS */
-	i2c_set_bitrate(ADXL343_I2C_BITRATE);
-	
-	i2c_start_wait(I2C_WRITE_ADDR);
-	i2c_write(ADXL343_INTERRUPT_SOURCE);
-	i2c_rep_start(I2C_READ_ADDR);
-	i2c_readNak();
-	i2c_stop();
+	/* I2C COMMS, reading the interrupt source clears the double tap */
+	uint8_t interruptSource;
+	i2c_read_regs(&_adxlDevice, ADXL343_INTERRUPT_SOURCE, &interruptSource, 1);
 	#endif
 	
 	/* Enable pin change interrupt for PD4 (PCINT20) */
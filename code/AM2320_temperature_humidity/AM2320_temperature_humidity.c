@@ -26,6 +26,7 @@
 #include <avr/io.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #define F_CPU 16000000L	/* Clock frequency of CPU */
 #include <util/delay.h>
@@ -55,6 +56,15 @@ Index:
 */
 static uint8_t _rawData[8];
 
+/* Address and bit rate of the AM2320 on the i2c bus */
+static const i2c_device_t _am2320Device = I2C_DEVICE(AM2320_ADDR, AM2320_I2C_BITRATE);
+
+/* The wake up command, the sensor does not ACK it while asleep so its NAK is not counted */
+static i2c_transaction_t _wakeUp = {&_am2320Device, I2C_TRANSACTION_REGISTER | I2C_TRANSACTION_NO_STATS, AM2320_WAKE_UP_COMMAND, 0, 0, 0, 0, 0, I2C_TRANSACTION_PENDING};
+
+/* Read of the 8 bytes of _rawData, with no register or write data it is only a read */
+static i2c_transaction_t _dataRead = {&_am2320Device, 0, 0, 0, 0, _rawData, sizeof(_rawData), 0, I2C_TRANSACTION_PENDING};
+
 /*
 * AM2320_wake_up()
 * -------------
@@ -64,12 +74,12 @@ static uint8_t _rawData[8];
 * communicate.
 * The sensor sleeps after the temp and humidity registers
 * have been read.
+* The sensor does not ACK its address while asleep, the
+* wake up is sent with I2C_TRANSACTION_NO_STATS so that NAK
+* is left out of the i2c error counters.
 */
 void AM2320_wake_up() {
-	i2c_set_bitrate(AM2320_I2C_BITRATE);
-	i2c_start(AM2320_ADDR | AM2320_I2C_WRITE);
-	i2c_write(AM2320_WAKE_UP_COMMAND);
-	i2c_stop();
+	i2c_transfer(&_wakeUp);
 	
 	/* Minimum 800us delay required after 
 	wakeup sequence according to datasheet */
@@ -95,23 +105,20 @@ void AM2320_update_temperature_humidity() {
 	int16_t temperature;
 	uint16_t humidity;
 	
+	/* The function code goes where a register would, then the first register and how many */
+	uint8_t readCommand[2] = {AM2320_HUMIDITY_REG_HIGH, 0x04}; /* Read 4 registers */
+	
 	AM2320_wake_up();
-	i2c_start(AM2320_ADDR | AM2320_I2C_WRITE);
-	i2c_write(AM2320_COMMAND_READ_REG_DATA);
-	i2c_write(AM2320_HUMIDITY_REG_HIGH);
-	i2c_write(0x04); /* Read 4 registers */
-	i2c_stop();
+	i2c_write_regs(&_am2320Device, AM2320_COMMAND_READ_REG_DATA, readCommand, 2);
 	
 	/* Wait at least 1.5ms for sensor */
 	_delay_ms(2); 
 	
-	/* Receive data from sensor */
-	i2c_start(AM2320_ADDR | AM2320_I2C_READ);
-	for(uint8_t i = 0; i < 8; i++) {
-		_rawData[i] = i2c_readAck();
+	/* Receive data from sensor, there is no register to send first */
+	if (i2c_transfer(&_dataRead)) {
+		/* Zero readings fail the range checks below */
+		memset(_rawData, 0, sizeof(_rawData));
 	}
-	_rawData[8] = i2c_readNak(); /* Last read must be a NAK */
-	i2c_stop();
 	
 	/* Construct temporary calculations for temp and humidity
 	from the received data */
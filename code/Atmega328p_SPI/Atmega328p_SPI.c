@@ -18,6 +18,10 @@
  * slave device (used for multi byte read/write).
  * A328p_SPI_receive_data_only() - Receive data from the slave
  * device (used for multi byte read).
+ * A328p_SPI_transmit_byte() - Transmit a byte without changing
+ * the SS pin (used for multi byte write).
+ * A328p_SPI_set_clock_rate() - Change the SPI clock divider.
+ * A328p_SPI_get_clock_rate() - Get the current SPI clock divider.
  **************************************************************
 */
 
@@ -150,4 +154,47 @@ uint8_t A328p_SPI_receive_data_only() {
 	// This should be the contents of the reg.
 	data = SPDR;
 	return data;
+}
+
+/*
+ * A328p_SPI_transmit_byte()
+ * --------------------------
+ * Transmit a byte to the slave without changing the SS pin. The caller
+ * selects the device before and deselects it after the transfer.
+*/
+void A328p_SPI_transmit_byte(uint8_t data) {
+	SPDR = data;
+	// Wait for transmission complete
+	while (!(SPSR & (1 << SPIF)));
+}
+
+/*
+ * A328p_SPI_set_clock_rate()
+ * ---------------------------
+ * Change the SPI clock divider, use one of the A328P_SPI_CLOCK_DIVx macros.
+ * Devices on the same bus that need different clock rates can switch before
+ * each transfer and restore the previous rate afterwards.
+*/
+void A328p_SPI_set_clock_rate(uint8_t rate) {
+	SPCR = (SPCR & ~((1 << SPR1) | (1 << SPR0))) | (rate & 0x03);
+	
+	if (rate & 0x04) {
+		SPSR |= (1 << SPI2X);
+	} else {
+		SPSR &= ~(1 << SPI2X);
+	}
+}
+
+/*
+ * A328p_SPI_get_clock_rate()
+ * ---------------------------
+ * Return the current SPI clock divider as one of the A328P_SPI_CLOCK_DIVx macros.
+*/
+uint8_t A328p_SPI_get_clock_rate() {
+	uint8_t rate = SPCR & ((1 << SPR1) | (1 << SPR0));
+	
+	if (SPSR & (1 << SPI2X)) {
+		rate |= 0x04;
+	}
+	return rate;
 }
\ No newline at end of file
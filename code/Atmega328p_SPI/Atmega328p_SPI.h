@@ -18,6 +18,10 @@
  * slave device (used for multi byte read/write).
  * A328p_SPI_receive_data_only() - Receive data from the slave
  * device (used for multi byte read).
+ * A328p_SPI_transmit_byte() - Transmit a byte without changing
+ * the SS pin (used for multi byte write).
+ * A328p_SPI_set_clock_rate() - Change the SPI clock divider.
+ * A328p_SPI_get_clock_rate() - Get the current SPI clock divider.
  **************************************************************
 */
 
@@ -33,6 +37,18 @@
 #define SS_HIGH A328p_set_SS(1)
 #define SS_LOW	A328p_set_SS(0)
 
+/* 
+SPI clock rates for A328p_SPI_set_clock_rate(). Bit 2 is the SPI2X bit and
+bits 0-1 are the SPR1:SPR0 bits.
+*/
+#define A328P_SPI_CLOCK_DIV2	0x04
+#define A328P_SPI_CLOCK_DIV4	0x00
+#define A328P_SPI_CLOCK_DIV8	0x05
+#define A328P_SPI_CLOCK_DIV16	0x01
+#define A328P_SPI_CLOCK_DIV32	0x06
+#define A328P_SPI_CLOCK_DIV64	0x02
+#define A328P_SPI_CLOCK_DIV128	0x03
+
 void A328p_set_SS(uint8_t value);
 void A328p_SPI_init();
 void A328p_SPI_transfer_data_to_reg(uint8_t reg, uint8_t data);
@@ -40,5 +56,8 @@ void A328p_SPI_transfer_data_only(uint8_t data);
 uint8_t A328p_SPI_receive_from_reg(uint8_t reg);
 void A328p_SPI_send_reg_only(uint8_t reg);
 uint8_t A328p_SPI_receive_data_only();
+void A328p_SPI_transmit_byte(uint8_t data);
+void A328p_SPI_set_clock_rate(uint8_t rate);
+uint8_t A328p_SPI_get_clock_rate();
 
 #endif /* ATMEGA328P_SPI_H_ */
\ No newline at end of file
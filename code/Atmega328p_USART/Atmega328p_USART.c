@@ -3,14 +3,15 @@
  * Atmega328p_USART.c
  * Author: Tom
  * Date: 16/11/2023
- * Simple AVR Library for USART serial communication. Only
- * transmission has been added for this so far.
+ * Simple AVR Library for USART serial communication. Received
+ * characters are taken one at a time for simple commands.
  **************************************************************
  * EXTERNAL FUNCTIONS
  **************************************************************
  * USART_init() - Initialise the 328p for USART comms.
  * USART_transmit_character() - Transmit a char over USART.
  * USART_transmit_string() - Transmit a string over USART.
+ * USART_receive_character() - Take the last character received.
  **************************************************************
 */
 
@@ -21,6 +22,8 @@
 
 #include "Atmega328p_USART.h"
 
+static volatile unsigned char _received;	/* Last character received, 0 = none */
+
 /*
  * USART_init()
  * -------------
@@ -56,6 +59,26 @@ void USART_transmit_string(char* string) {
 	}
 }
 
-ISR(USART_RX_vect) {
+/*
+ * USART_receive_character()
+ * -------------------------
+ * Take the last character received over the USART rx line. Only the last one is kept, a
+ * character that arrives before the one before it has been taken replaces it.
+ *
+ * Return: The character, or 0 if nothing has been received since the last call.
+*/
+unsigned char USART_receive_character() {
+	unsigned char character;
+	uint8_t sreg = SREG;
 	
+	cli();
+	character = _received;
+	_received = 0;
+	SREG = sreg;
+	return character;
+}
+
+/* Keep each character received, reading UDR0 also clears the interrupt */
+ISR(USART_RX_vect) {
+	_received = UDR0;
 }
\ No newline at end of file
@@ -3,14 +3,15 @@
  * Atmega328p_USART.h
  * Author: Tom
  * Date: 16/11/2023
- * Simple AVR Library for USART serial communication. Only
- * transmission has been added for this so far.
+ * Simple AVR Library for USART serial communication. Received
+ * characters are taken one at a time for simple commands.
  **************************************************************
  * EXTERNAL FUNCTIONS
  **************************************************************
  * USART_init() - Initialise the 328p for USART comms.
  * USART_transmit_character() - Transmit a char over USART.
  * USART_transmit_string() - Transmit a string over USART.
+ * USART_receive_character() - Take the last character received.
  **************************************************************
 */
 
@@ -27,7 +28,6 @@
 void USART_init();
 void USART_transmit_character(unsigned char data);
 void USART_transmit_string(char* string);
-
-/* will need some receive functionality soon */
+unsigned char USART_receive_character();
 
 #endif /* ATMEGA328P_USART_H_ */
\ No newline at end of file
@@ -14,6 +14,10 @@
  * RTC_init() - Initialise the RTC.
  * RTC_set_time() - Set the current time on the RTC.
  * RTC_update_current_time() - Get the current time on the RTC.
+ * RTC_request_current_time() - Start reading the current time
+ * on the RTC without waiting for it.
+ * RTC_current_time_ready() - Check if the time asked for by
+ * RTC_request_current_time() has arrived.
  * RTC_get_time_seconds_int() - Get time in seconds as integer.
  * RTC_get_time_minutes_int() - Get time in minutes as integer.
  * RTC_get_time_hours_int() - Get time in hours as integer.
@@ -57,55 +61,38 @@ static uint8_t _alarmTime[3];
 static uint8_t _alarmEnabled;
 static uint8_t _alarmStatus;
 
+/* Address and bit rate of the RTC on the i2c bus */
+static const i2c_device_t _rtcDevice = I2C_DEVICE(RTC_ADDR, RTC_I2C_BITRATE);
+
+/* Read of the time keeping registers queued by RTC_request_current_time() */
+static uint8_t _rawTimeData[3];
+static uint8_t _rawTimeCollected = 1;
+static i2c_transaction_t _timeRead = {
+	.device = &_rtcDevice,
+	.flags = I2C_TRANSACTION_REGISTER,
+	.reg = RTC_SECONDS_REGISTER,
+	.readData = _rawTimeData,
+	.readLength = 3
+};
+
 /*
  * _read_register()
  * -----------------------
  * Internal function to read a single register on the RTC.
 */
 uint8_t _read_register(uint8_t regAddr) {
-	uint8_t data;
-	i2c_set_bitrate(RTC_I2C_BITRATE);
-	i2c_start(RTC_ADDR | RTC_I2C_WRITE);
-	i2c_write(regAddr);
-	i2c_rep_start(RTC_ADDR | RTC_I2C_READ);
-	data = i2c_readNak();
-	i2c_stop();
+	uint8_t data = 0;
+	i2c_read_regs(&_rtcDevice, regAddr, &data, 1);
 	return data;
 }
 
-/*
- * _read_multiple_registers()
- * -----------------------------
- * Internal function to read multiple registers on the RTC. The number of reads
- * required must be known.
-*/
-void _read_multiple_registers(uint8_t startAddr, uint8_t* data, uint8_t numOfReads) {
-	i2c_set_bitrate(RTC_I2C_BITRATE);
-	i2c_start(RTC_ADDR | RTC_I2C_WRITE);
-	i2c_write(startAddr);
-	i2c_stop();
-	
-	i2c_start(RTC_ADDR | RTC_I2C_READ);
-	
-	for (uint8_t i = 0; i < numOfReads - 1; i++) {
-		data[i] = i2c_readAck();
-	}
-	data[numOfReads - 1] = i2c_readNak();
-	i2c_stop();
-	
-}
-
 /*
  * _write_register()
  * ---------------------
  * Internal function to write a value to a register on the RTC.
 */
 void _write_register(uint8_t regAddr, uint8_t data) {
-	i2c_set_bitrate(RTC_I2C_BITRATE);
-	i2c_start(RTC_ADDR | RTC_I2C_WRITE);
-	i2c_write(regAddr);
-	i2c_write(data);
-	i2c_stop();
+	i2c_write_regs(&_rtcDevice, regAddr, &data, 1);
 }
 
 /*
@@ -115,20 +102,18 @@ void _write_register(uint8_t regAddr, uint8_t data) {
 */
 void RTC_init() {
 	i2c_init();
-	i2c_set_bitrate(RTC_I2C_BITRATE);
-	i2c_start(RTC_ADDR | RTC_I2C_WRITE);
-	i2c_write(RTC_SECONDS_REGISTER);
 	
 	/* 
 	Don't need this while using backup battery as it 
 	will reset seconds back to zero 
 	*/
 	#ifdef RTC_FULL_RESET
-	i2c_write(RTC_OSCILLATOR_ENABLE);
+	uint8_t oscillator = RTC_OSCILLATOR_ENABLE;
+	i2c_write_regs(&_rtcDevice, RTC_SECONDS_REGISTER, &oscillator, 1);
+	#else
+	i2c_write_regs(&_rtcDevice, RTC_SECONDS_REGISTER, 0, 0);
 	#endif /* RTC_FULL_RESET */
 	
-	i2c_stop();
-	
 	_alarmEnabled = RTC_ALARM_DISABLED;
 	_alarmStatus = RTC_ALARM_INACTIVE;
 	
@@ -144,11 +129,11 @@ void RTC_init() {
  *		RTC_set_time( 0x15, 0x45, 0x16 )
  * As you can see the tens digit is stored in the upper byte and the ones
  * digit in the lower.
+ * The seconds, minutes and hours registers are written in one burst.
 */
 void RTC_set_time(uint8_t hour, uint8_t min, uint8_t sec) {
-	_write_register(RTC_SECONDS_REGISTER, sec | RTC_OSCILLATOR_ENABLE);
-	_write_register(RTC_MINUTES_REGISTER, min);
-	_write_register(RTC_HOURS_REGISTER, hour);
+	uint8_t time[3] = {sec | RTC_OSCILLATOR_ENABLE, min, hour};
+	i2c_write_regs(&_rtcDevice, RTC_SECONDS_REGISTER, time, 3);
 }
 
 /*
@@ -159,8 +144,61 @@ void RTC_set_time(uint8_t hour, uint8_t min, uint8_t sec) {
 void RTC_update_current_time() {
 	uint8_t rawTimeData[] = {0, 0, 0};
 	
-	_read_multiple_registers(RTC_SECONDS_REGISTER, rawTimeData, 3);
+	i2c_read_regs(&_rtcDevice, RTC_SECONDS_REGISTER, rawTimeData, 3);
+	_store_current_time(rawTimeData);
+}
+
+/*
+ * RTC_request_current_time()
+ * --------------------------
+ * External function to queue a read of the time keeping registers on the RTC and return
+ * straight away. The read runs from the TWI interrupt, use RTC_current_time_ready() to pick
+ * up the time once it has arrived.
+ *
+ * Return:	1 if the read has been queued.
+ *			0 if the last read has not finished yet or the i2c queue is full.
+ *
+ * NOTE: Global interrupts must be enabled.
+*/
+uint8_t RTC_request_current_time() {
+	if (!_rawTimeCollected && (_timeRead.status == I2C_TRANSACTION_PENDING)) {
+		return 0;
+	}
+	if (i2c_post(&_timeRead)) {
+		return 0;
+	}
+	_rawTimeCollected = 0;
+	return 1;
+}
+
+/*
+ * RTC_current_time_ready()
+ * ------------------------
+ * External function to check if the read queued by RTC_request_current_time() has finished.
+ * When it has, the current time is updated the same as RTC_update_current_time().
+ *
+ * Return:	1 once for each read that has finished, the current time has been updated.
+ *			0 if the read is still in progress, failed or has already been picked up.
+*/
+uint8_t RTC_current_time_ready() {
+	if (_rawTimeCollected || (_timeRead.status == I2C_TRANSACTION_PENDING)) {
+		return 0;
+	}
+	_rawTimeCollected = 1;
 	
+	if (_timeRead.status != I2C_TRANSACTION_DONE) {
+		return 0;
+	}
+	_store_current_time(_rawTimeData);
+	return 1;
+}
+
+/*
+ * _store_current_time()
+ * ---------------------
+ * Internal function to store the time keeping registers as the digits of the current time.
+*/
+void _store_current_time(uint8_t rawTimeData[3]) {
 	_currentTime[0] = (rawTimeData[0] & 0x70) >> 4;
 	_currentTime[1] = (rawTimeData[0] & 0x0F);
 	_currentTime[2] = (rawTimeData[1] & 0x70) >> 4;
@@ -472,12 +510,12 @@ void RTC_get_year_string(char string[3]) {
 /*
 * RTC_set_date()
 * --------------
-* External function to set the date on the RTCC.
+* External function to set the date on the RTCC. The date,
+* month and year registers are written in one burst.
 */
 void RTC_set_date(uint8_t dayDate, uint8_t month, uint8_t year) {
-	RTC_set_date_day(dayDate);
-	RTC_set_month(month);
-	RTC_set_year(year);
+	uint8_t date[3] = {dayDate, month, year};
+	i2c_write_regs(&_rtcDevice, RTC_DATE_DAY_REGISTER, date, 3);
 }
 
 /*
@@ -563,6 +601,29 @@ void RTC_alarm_deactivate() {
 	_alarmStatus = RTC_ALARM_INACTIVE;
 }
 
+/*
+* RTC_get_date_ints()
+* -------------------
+* External function to get the current date as integers. The date, month and year registers
+* are read in one burst.
+*
+* dayDate: Set to the date of the month (1 - 31).
+*
+* month: Set to the month (1 - 12).
+*
+* year: Set to the year (0 - 99).
+*/
+void RTC_get_date_ints(uint8_t* dayDate, uint8_t* month, uint8_t* year) {
+	uint8_t date[3] = {0, 0, 0};
+	
+	i2c_read_regs(&_rtcDevice, RTC_DATE_DAY_REGISTER, date, 3);
+	
+	/* Tens digit in the upper bits, the month register also has the leap year bit */
+	*dayDate = (((date[0] & 0x30) >> 4) * 10) + (date[0] & 0x0F);
+	*month = (((date[1] & 0x10) >> 4) * 10) + (date[1] & 0x0F);
+	*year = (((date[2] & 0xF0) >> 4) * 10) + (date[2] & 0x0F);
+}
+
 /*
 * RTC_get_date_string()
 * ---------------------
@@ -570,9 +631,11 @@ void RTC_alarm_deactivate() {
 * current date formatted as: DD-MM-YY
 */
 void RTC_get_date_string(char string[9]) {
-	uint8_t dayDate = RTC_get_date_day_int();
-	uint8_t month = RTC_get_month_int();
-	uint8_t year = RTC_get_year_int();
+	uint8_t dayDate;
+	uint8_t month;
+	uint8_t year;
+	
+	RTC_get_date_ints(&dayDate, &month, &year);
 	
 	string[0] = (dayDate / 10) + 48;
 	string[1] = (dayDate % 10) + 48;
@@ -14,6 +14,10 @@
  * RTC_init() - Initialise the RTC.
  * RTC_set_time() - Set the current time on the RTC.
  * RTC_update_current_time() - Get the current time on the RTC.
+ * RTC_request_current_time() - Start reading the current time
+ * on the RTC without waiting for it.
+ * RTC_current_time_ready() - Check if the time asked for by
+ * RTC_request_current_time() has arrived.
  * RTC_get_time_seconds_int() - Get time in seconds as integer.
  * RTC_get_time_minutes_int() - Get time in minutes as integer.
  * RTC_get_time_hours_int() - Get time in hours as integer.
@@ -37,6 +41,7 @@
  * RTC_alarm_deactivate() - Deactivate alarm.
  * RTC_get_alarm_time_hex() - Get the alarm time as hex integer.
  * RTC_get_current_time_hex() - Get the current time as hex int.
+ * RTC_get_date_ints() - Get current date as integers.
  * RTC_get_date_string() - Get current date as a formatted string.
  * RTC_get_alarm_time_seconds_int() - Get alarm time seconds as int.
  * RTC_get_alarm_time_minutes_int() - Get alarm time minutes as int.
@@ -102,8 +107,8 @@
 
 /* Private functions */
 uint8_t _read_register(uint8_t regAddr);
-void _read_multiple_registers(uint8_t startAddr, uint8_t* data, uint8_t numOfReads);
 void _write_register(uint8_t regAddr, uint8_t data);
+void _store_current_time(uint8_t rawTimeData[3]);
 
 /* Initialise */
 void RTC_init(); 
@@ -111,6 +116,8 @@ void RTC_init();
 /* Time functions */
 void RTC_set_time(uint8_t hour, uint8_t min, uint8_t sec);
 void RTC_update_current_time();
+uint8_t RTC_request_current_time();
+uint8_t RTC_current_time_ready();
 uint8_t RTC_get_time_seconds_int();
 uint8_t RTC_get_time_minutes_int();
 uint8_t RTC_get_time_hours_int();
@@ -139,6 +146,7 @@ uint8_t RTC_check_alarm_match();
 void RTC_alarm_deactivate();
 uint32_t RTC_get_alarm_time_hex();
 uint32_t RTC_get_current_time_hex();
+void RTC_get_date_ints(uint8_t* dayDate, uint8_t* month, uint8_t* year);
 void RTC_get_date_string(char string[9]);
 uint8_t RTC_get_alarm_time_seconds_int();
 uint8_t RTC_get_alarm_time_minutes_int();
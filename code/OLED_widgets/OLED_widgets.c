@@ -0,0 +1,548 @@
+/*
+ **************************************************************
+ * OLED_widgets.c
+ * Retained widgets for the SH1106 OLED library. The widgets of
+ * a screen are kept in a table with the area of the screen they
+ * cover, so when one changes only that area is cleared and
+ * redrawn instead of the whole frame.
+ **************************************************************
+ * EXTERNAL FUNCTIONS
+ **************************************************************
+ * WIDGET_screen() - Switch to a screen of widgets.
+ * WIDGET_set_background() - Draw the parts of a screen that
+ * never change from a background.
+ * WIDGET_add_label() - Add a string that does not change.
+ * WIDGET_add_label_P() - Add a string stored in PROGMEM that
+ * does not change.
+ * WIDGET_add_value() - Add a string that is updated with
+ * WIDGET_set_value().
+ * WIDGET_add_icon() - Add an XBM image.
+ * WIDGET_add_packed_icon() - Add an image compressed by
+ * tools/pack_assets.py.
+ * WIDGET_add_box() - Add a line, rectangle or outline.
+ * WIDGET_set_value() - Change the string of a value.
+ * WIDGET_set_image() - Change the image of an icon.
+ * WIDGET_set_position() - Move a widget.
+ * WIDGET_render() - Redraw the widgets that have changed.
+ **************************************************************
+*/
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <string.h>
+
+#include "OLED_widgets.h"
+#include "../SH1106_OLED/SH1106.h"
+
+#ifdef OLED_PAGE_RENDERER
+	#error "The widgets redraw parts of the frame buffer, OLED_PAGE_RENDERER must not be defined"
+#endif /* OLED_PAGE_RENDERER */
+
+static widget_t _widgets[WIDGET_MAX];	/* Widgets of the current screen, drawn in this order */
+static uint8_t _numOfWidgets;			/* Number of widgets in _widgets[] */
+static uint8_t _screen = WIDGET_SCREEN_NONE;	/* Screen the widgets belong to */
+static const uint8_t* _background;		/* PROGMEM background of the screen, 0 = blank */
+
+/* Private function prototypes */
+static uint8_t _add_widget(uint8_t type, uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t screenOrientation);
+static void _widget_bounds(widget_t* widget, uint8_t bounds[4]);
+static void _redraw_area(uint8_t area[4]);
+static void _draw_widget(widget_t* widget);
+
+/*
+* WIDGET_screen()
+* ---------------
+* External function to switch to a screen of widgets. When the screen is not the one already
+* shown the widget table is emptied and the buffer is cleared, so the widgets of the new
+* screen can be added.
+*
+* screen: Any number that identifies the screen, or WIDGET_SCREEN_NONE when the buffer is
+* about to be drawn without widgets so the next screen of widgets starts from scratch.
+*
+* Return:	1 if the screen has just been switched to and its widgets need to be added.
+*			0 if the widgets are already in place.
+*/
+uint8_t WIDGET_screen(uint8_t screen) {
+	if (screen == _screen) {
+		return 0;
+	}
+	
+	_screen = screen;
+	_numOfWidgets = 0;
+	_background = 0;
+	
+	if (screen == WIDGET_SCREEN_NONE) {
+		return 0;
+	}
+	
+	OLED_clear_buffer();
+	return 1;
+}
+
+/*
+* _add_widget()
+* -------------
+* Private function to add a widget to the end of the table, so it is drawn on top of the
+* widgets before it. The widget is drawn by the next WIDGET_render().
+*
+* Return: The index of the widget, or WIDGET_NONE if the table is full.
+*/
+static uint8_t _add_widget(uint8_t type, uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t screenOrientation) {
+	if (_numOfWidgets >= WIDGET_MAX) {
+		return WIDGET_NONE;
+	}
+	
+	widget_t* widget = &_widgets[_numOfWidgets];
+	memset(widget, 0, sizeof(widget_t));
+	widget->type = type;
+	widget->flags = WIDGET_CHANGED;
+	widget->xPosition = xPosition;
+	widget->yPosition = yPosition;
+	widget->width = width;
+	widget->height = height;
+	widget->orientation = screenOrientation;
+	
+	return _numOfWidgets++;
+}
+
+/*
+* WIDGET_set_background()
+* -----------------------
+* External function to draw the parts of the current screen that never change, such as its
+* lines and titles, by copying a background made by tools/make_backgrounds.py into the buffer.
+* The background is put back instead of clearing when the widgets are redrawn, so the widgets
+* can be drawn over it. Call it after WIDGET_screen() returns 1.
+*
+* background: The background stored in PROGMEM, see OLED_draw_background().
+*/
+void WIDGET_set_background(const uint8_t background[]) {
+	_background = background;
+	OLED_draw_background(background);
+}
+
+/*
+* WIDGET_add_label()
+* ------------------
+* External function to add a string that does not change, drawn the same as
+* OLED_draw_string_aligned().
+*
+* string: The string to be drawn. Only the pointer is kept so the string must stay in place.
+*
+* Return: The index of the widget, or WIDGET_NONE if the table is full.
+*/
+uint8_t WIDGET_add_label(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation) {
+	uint8_t index = _add_widget(WIDGET_TYPE_LABEL, xPosition, yPosition, fontSize, characterSpacing, screenOrientation);
+	
+	if (index != WIDGET_NONE) {
+		_widgets[index].alignment = alignment;
+		_widgets[index].data = string;
+	}
+	return index;
+}
+
+/*
+* WIDGET_add_label_P()
+* --------------------
+* External function to add a string stored in PROGMEM that does not change, drawn the same as
+* OLED_draw_string_aligned(). eg. WIDGET_add_label_P(PSTR("Humidity"), 0, 80, 8, 1, OLED_ALIGN_LEFT, 1);
+*
+* string: The string stored in PROGMEM.
+*
+* Return: The index of the widget, or WIDGET_NONE if the table is full.
+*/
+uint8_t WIDGET_add_label_P(const char* string, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation) {
+	uint8_t index = _add_widget(WIDGET_TYPE_LABEL_P, xPosition, yPosition, fontSize, characterSpacing, screenOrientation);
+	
+	if (index != WIDGET_NONE) {
+		_widgets[index].alignment = alignment;
+		_widgets[index].data = string;
+	}
+	return index;
+}
+
+/*
+* WIDGET_add_value()
+* ------------------
+* External function to add a string that is set with WIDGET_set_value(), drawn the same as
+* OLED_draw_string_aligned(). The string is empty until it is first set.
+*
+* Return: The index of the widget, or WIDGET_NONE if the table is full.
+*/
+uint8_t WIDGET_add_value(uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation) {
+	uint8_t index = _add_widget(WIDGET_TYPE_VALUE, xPosition, yPosition, fontSize, characterSpacing, screenOrientation);
+	
+	if (index != WIDGET_NONE) {
+		_widgets[index].alignment = alignment;
+	}
+	return index;
+}
+
+/*
+* WIDGET_add_format_P()
+* ---------------------
+* External function to add up to 3 numbers drawn with a format stored in PROGMEM, the same as
+* OLED_printf_P(), and set with WIDGET_set_numbers(). The numbers are passed to the format as
+* unsigned ints, eg. WIDGET_add_format_P(PSTR("%02u:%02u:%02u"), 64, 4, 25, 5, OLED_ALIGN_CENTER, 0);
+* They are 0 until they are first set.
+*
+* format: The format stored in PROGMEM.
+*
+* Return: The index of the widget, or WIDGET_NONE if the table is full.
+*/
+uint8_t WIDGET_add_format_P(const char* format, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation) {
+	uint8_t index = _add_widget(WIDGET_TYPE_FORMAT_P, xPosition, yPosition, fontSize, characterSpacing, screenOrientation);
+	
+	if (index != WIDGET_NONE) {
+		_widgets[index].alignment = alignment;
+		_widgets[index].data = format;
+	}
+	return index;
+}
+
+/*
+* WIDGET_add_icon()
+* -----------------
+* External function to add an XBM image, drawn the same as OLED_draw_xbm().
+*
+* xbm: The image stored as a PROGMEM array.
+*
+* Return: The index of the widget, or WIDGET_NONE if the table is full.
+*/
+uint8_t WIDGET_add_icon(const uint8_t xbm[], uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t screenOrientation) {
+	uint8_t index = _add_widget(WIDGET_TYPE_ICON, xPosition, yPosition, width, height, screenOrientation);
+	
+	if (index != WIDGET_NONE) {
+		_widgets[index].data = xbm;
+	}
+	return index;
+}
+
+/*
+* WIDGET_add_packed_icon()
+* ------------------------
+* External function to add an image compressed by tools/pack_assets.py, drawn the same as
+* OLED_draw_packed(). The size is read from the image.
+*
+* packed: The packed image stored as a PROGMEM array.
+*
+* Return: The index of the widget, or WIDGET_NONE if the table is full.
+*/
+uint8_t WIDGET_add_packed_icon(const uint8_t packed[], uint8_t xPosition, uint8_t yPosition, uint8_t screenOrientation) {
+	uint8_t width = pgm_read_byte(&(packed[0]));
+	uint8_t height = pgm_read_byte(&(packed[1]));
+	uint8_t index = _add_widget(WIDGET_TYPE_PACKED_ICON, xPosition, yPosition, width, height, screenOrientation);
+	
+	if (index != WIDGET_NONE) {
+		_widgets[index].data = packed;
+	}
+	return index;
+}
+
+/*
+* WIDGET_add_box()
+* ----------------
+* External function to add a rectangle. A filled box 1 pixel high or wide is a line.
+*
+* xPosition: The x-coordinate of the top left corner of the box.
+*
+* yPosition: The y-coordinate of the top left corner of the box.
+*
+* width: The number of columns the box covers.
+*
+* height: The number of rows the box covers.
+*
+* style: WIDGET_BOX_OUTLINE or WIDGET_BOX_FILLED.
+*
+* screenOrientation: Rotates the box around the screen the same as OLED_draw_xbm().
+*
+* Return: The index of the widget, or WIDGET_NONE if the table is full.
+*
+* NOTE: The box must fit on the screen.
+*/
+uint8_t WIDGET_add_box(uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t style, uint8_t screenOrientation) {
+	uint8_t index = _add_widget(WIDGET_TYPE_BOX, xPosition, yPosition, width, height, screenOrientation);
+	
+	if ((index != WIDGET_NONE) && (style == WIDGET_BOX_FILLED)) {
+		_widgets[index].flags |= WIDGET_FILLED;
+	}
+	return index;
+}
+
+/*
+* WIDGET_set_value()
+* ------------------
+* External function to change the string of a value widget. The widget is only redrawn if
+* the string is different.
+*
+* widget: The index returned by WIDGET_add_value().
+*
+* string: The new string, it is copied and cut to WIDGET_VALUE_LENGTH - 1 characters.
+*/
+void WIDGET_set_value(uint8_t widget, char* string) {
+	if (widget >= _numOfWidgets) {
+		return;
+	}
+	
+	char* value = _widgets[widget].value;
+	if (strncmp(value, string, WIDGET_VALUE_LENGTH - 1) != 0) {
+		strncpy(value, string, WIDGET_VALUE_LENGTH - 1);
+		value[WIDGET_VALUE_LENGTH - 1] = '\0';
+		_widgets[widget].flags |= WIDGET_CHANGED;
+	}
+}
+
+/*
+* WIDGET_set_numbers()
+* --------------------
+* External function to change the numbers of a format widget. The widget is only redrawn if
+* one of them is different.
+*
+* widget: The index returned by WIDGET_add_format_P().
+*
+* first, second, third: The numbers, in the order the format uses them.
+*/
+void WIDGET_set_numbers(uint8_t widget, uint8_t first, uint8_t second, uint8_t third) {
+	if (widget >= _numOfWidgets) {
+		return;
+	}
+	
+	uint8_t* numbers = (uint8_t*)_widgets[widget].value;
+	if ((numbers[0] != first) || (numbers[1] != second) || (numbers[2] != third)) {
+		numbers[0] = first;
+		numbers[1] = second;
+		numbers[2] = third;
+		_widgets[widget].flags |= WIDGET_CHANGED;
+	}
+}
+
+/*
+* WIDGET_set_image()
+* ------------------
+* External function to change the image of an icon widget. The new image must be the same
+* size. The widget is only redrawn if the image is different.
+*
+* widget: The index returned by WIDGET_add_icon() or WIDGET_add_packed_icon().
+*
+* image: The new image stored as a PROGMEM array, packed if the widget was added packed.
+*/
+void WIDGET_set_image(uint8_t widget, const uint8_t image[]) {
+	if ((widget < _numOfWidgets) && (_widgets[widget].data != image)) {
+		_widgets[widget].data = image;
+		_widgets[widget].flags |= WIDGET_CHANGED;
+	}
+}
+
+/*
+* WIDGET_set_position()
+* ---------------------
+* External function to move a widget. The widget is only redrawn if the position is different.
+*
+* widget: The index of the widget.
+*
+* xPosition: The new x-coordinate, the same as when the widget was added.
+*
+* yPosition: The new y-coordinate, the same as when the widget was added.
+*/
+void WIDGET_set_position(uint8_t widget, uint8_t xPosition, uint8_t yPosition) {
+	if (widget >= _numOfWidgets) {
+		return;
+	}
+	
+	if ((_widgets[widget].xPosition != xPosition) || (_widgets[widget].yPosition != yPosition)) {
+		_widgets[widget].xPosition = xPosition;
+		_widgets[widget].yPosition = yPosition;
+		_widgets[widget].flags |= WIDGET_CHANGED;
+	}
+}
+
+/*
+* WIDGET_render()
+* ---------------
+* External function to bring the buffer up to date with the widgets. For every widget that
+* has changed, the area it covered and the area it covers now are cleared and every widget
+* in them is redrawn, clipped to the area. The rest of the buffer is not touched, so only
+* those columns are sent by the next OLED_display_buffer().
+*
+* NOTE: 
+*	-	If an interrupt driven flush is in progress this waits for it to finish first.
+*	-	The widgets are turned by their own screenOrientation, not the canvas set by
+*		OLED_set_canvas(), which is left as it was.
+*/
+void WIDGET_render() {
+	uint8_t canvas = OLED_get_canvas();
+	
+	while (OLED_flush_busy());
+	
+	// The bounds are already on the screen.
+	OLED_set_canvas(OLED_CLOCKWISE_0);
+	
+	for (uint8_t i = 0; i < _numOfWidgets; i++) {
+		widget_t* widget = &_widgets[i];
+		uint8_t lastBounds[4];
+		
+		if (!(widget->flags & WIDGET_CHANGED)) {
+			continue;
+		}
+		widget->flags &= ~WIDGET_CHANGED;
+		
+		memcpy(lastBounds, widget->bounds, sizeof(lastBounds));
+		_widget_bounds(widget, widget->bounds);
+		
+		_redraw_area(lastBounds);
+		if (memcmp(lastBounds, widget->bounds, sizeof(lastBounds)) != 0) {
+			_redraw_area(widget->bounds);
+		}
+	}
+	
+	OLED_set_canvas(canvas);
+}
+
+/*
+* _widget_bounds()
+* ----------------
+* Private function to work out the area of the screen a widget covers, after rotation and
+* cut to the edges of the screen.
+*
+* widget: The widget.
+*
+* bounds: Set to the left, right, top and bottom of the area. The right and bottom are one
+* past the area and an empty area has left >= right.
+*/
+static void _widget_bounds(widget_t* widget, uint8_t bounds[4]) {
+	uint8_t xPosition = widget->xPosition;
+	uint8_t width = widget->width;
+	uint8_t height = widget->height;
+	int16_t left;
+	int16_t top;
+	int16_t right;
+	int16_t bottom;
+	
+	if ((widget->type == WIDGET_TYPE_LABEL) || (widget->type == WIDGET_TYPE_VALUE) || (widget->type == WIDGET_TYPE_LABEL_P) || (widget->type == WIDGET_TYPE_FORMAT_P)) {
+		if (widget->type == WIDGET_TYPE_LABEL_P) {
+			OLED_measure_string_P((const char*)widget->data, widget->width, widget->height, &width, &height);
+		} else if (widget->type == WIDGET_TYPE_FORMAT_P) {
+			uint8_t* numbers = (uint8_t*)widget->value;
+			OLED_measure_printf_P(widget->width, widget->height, &width, &height, (const char*)widget->data, numbers[0], numbers[1], numbers[2]);
+		} else {
+			char* string = (widget->type == WIDGET_TYPE_LABEL) ? (char*)widget->data : widget->value;
+			OLED_measure_string(string, widget->width, widget->height, &width, &height);
+		}
+		
+		// The same start as OLED_draw_string_aligned().
+		uint8_t shift = 0;
+		if (widget->alignment == OLED_ALIGN_CENTER) {
+			shift = width / 2;
+		} else if (widget->alignment == OLED_ALIGN_RIGHT) {
+			shift = width;
+		}
+		if (shift > xPosition) {
+			shift = xPosition;
+		}
+		xPosition -= shift;
+	}
+	
+	// The same rotation as OLED_draw_xbm().
+	switch (widget->orientation) {
+		case OLED_CLOCKWISE_90:
+			left = OLED_WIDTH - (int16_t)widget->yPosition - height;
+			top = xPosition;
+			right = left + height;
+			bottom = top + width;
+			break;
+		case OLED_CLOCKWISE_180:
+			left = OLED_WIDTH - (int16_t)xPosition - width;
+			top = OLED_HEIGHT - (int16_t)widget->yPosition - height;
+			right = left + width;
+			bottom = top + height;
+			break;
+		case OLED_CLOCKWISE_270:
+			left = widget->yPosition;
+			top = OLED_HEIGHT - (int16_t)xPosition - width;
+			right = left + height;
+			bottom = top + width;
+			break;
+		default:
+			left = xPosition;
+			top = widget->yPosition;
+			right = left + width;
+			bottom = top + height;
+			break;
+	}
+	
+	bounds[0] = (left < 0) ? 0 : ((left > OLED_WIDTH) ? OLED_WIDTH : left);
+	bounds[1] = (right < 0) ? 0 : ((right > OLED_WIDTH) ? OLED_WIDTH : right);
+	bounds[2] = (top < 0) ? 0 : ((top > OLED_HEIGHT) ? OLED_HEIGHT : top);
+	bounds[3] = (bottom < 0) ? 0 : ((bottom > OLED_HEIGHT) ? OLED_HEIGHT : bottom);
+}
+
+/*
+* _redraw_area()
+* --------------
+* Private function to clear an area of the buffer, back to the background if the screen has
+* one, and redraw the widgets that cover any of it, in table order, with drawing clipped to
+* the area.
+*
+* area: The left, right, top and bottom of the area, the right and bottom are one past it.
+*/
+static void _redraw_area(uint8_t area[4]) {
+	if ((area[0] >= area[1]) || (area[2] >= area[3])) {
+		return;
+	}
+	
+	OLED_set_clip(area[0], area[1], area[2], area[3]);
+	if (_background) {
+		OLED_restore_background(_background, area[0], area[1], area[2], area[3]);
+	} else {
+		OLED_clear_rectangle(area[0], area[1], area[2], area[3]);
+	}
+	
+	for (uint8_t i = 0; i < _numOfWidgets; i++) {
+		uint8_t* bounds = _widgets[i].bounds;
+		
+		if ((bounds[0] < area[1]) && (bounds[1] > area[0]) && (bounds[2] < area[3]) && (bounds[3] > area[2])) {
+			_draw_widget(&_widgets[i]);
+		}
+	}
+	
+	OLED_reset_clip();
+}
+
+/*
+* _draw_widget()
+* --------------
+* Private function to draw a widget into the buffer.
+*
+* widget: The widget to be drawn.
+*/
+static void _draw_widget(widget_t* widget) {
+	uint8_t* bounds = widget->bounds;
+	
+	switch (widget->type) {
+		case WIDGET_TYPE_LABEL:
+			OLED_draw_string_aligned((char*)widget->data, widget->xPosition, widget->yPosition, widget->width, widget->height, widget->alignment, widget->orientation);
+			break;
+		case WIDGET_TYPE_VALUE:
+			OLED_draw_string_aligned(widget->value, widget->xPosition, widget->yPosition, widget->width, widget->height, widget->alignment, widget->orientation);
+			break;
+		case WIDGET_TYPE_LABEL_P:
+			OLED_printf_P(widget->xPosition, widget->yPosition, widget->width, widget->height, widget->alignment, widget->orientation, PSTR("%S"), (const char*)widget->data);
+			break;
+		case WIDGET_TYPE_FORMAT_P: {
+			uint8_t* numbers = (uint8_t*)widget->value;
+			OLED_printf_P(widget->xPosition, widget->yPosition, widget->width, widget->height, widget->alignment, widget->orientation, (const char*)widget->data, numbers[0], numbers[1], numbers[2]);
+			break;
+		}
+		case WIDGET_TYPE_ICON:
+			OLED_draw_xbm(widget->xPosition, widget->yPosition, (const uint8_t*)widget->data, widget->width, widget->height, widget->orientation);
+			break;
+		case WIDGET_TYPE_PACKED_ICON:
+			OLED_draw_packed(widget->xPosition, widget->yPosition, (const uint8_t*)widget->data, widget->orientation);
+			break;
+		case WIDGET_TYPE_BOX:
+			// The bounds are already rotated, OLED_draw_rectangle() draws width + 1 columns.
+			if (bounds[0] < bounds[1]) {
+				OLED_draw_rectangle(bounds[0], bounds[2], bounds[1] - bounds[0] - 1, bounds[3] - bounds[2], (widget->flags & WIDGET_FILLED) ? 1 : 0, OLED_DRAW_SET);
+			}
+			break;
+	}
+}
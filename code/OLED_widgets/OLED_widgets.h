@@ -0,0 +1,93 @@
+/*
+ **************************************************************
+ * OLED_widgets.h
+ * Retained widgets for the SH1106 OLED library. The widgets of
+ * a screen are kept in a table with the area of the screen they
+ * cover, so when one changes only that area is cleared and
+ * redrawn instead of the whole frame.
+ **************************************************************
+ * EXTERNAL FUNCTIONS
+ **************************************************************
+ * WIDGET_screen() - Switch to a screen of widgets.
+ * WIDGET_set_background() - Draw the parts of a screen that
+ * never change from a background.
+ * WIDGET_add_label() - Add a string that does not change.
+ * WIDGET_add_label_P() - Add a string stored in PROGMEM that
+ * does not change.
+ * WIDGET_add_value() - Add a string that is updated with
+ * WIDGET_set_value().
+ * WIDGET_add_format_P() - Add numbers drawn with a PROGMEM
+ * format that are updated with WIDGET_set_numbers().
+ * WIDGET_add_icon() - Add an XBM image.
+ * WIDGET_add_packed_icon() - Add an image compressed by
+ * tools/pack_assets.py.
+ * WIDGET_add_box() - Add a line, rectangle or outline.
+ * WIDGET_set_value() - Change the string of a value.
+ * WIDGET_set_numbers() - Change the numbers of a format.
+ * WIDGET_set_image() - Change the image of an icon.
+ * WIDGET_set_position() - Move a widget.
+ * WIDGET_render() - Redraw the widgets that have changed.
+ **************************************************************
+*/
+
+#ifndef OLED_WIDGETS_H_
+#define OLED_WIDGETS_H_
+
+/* Most widgets on a screen, each costs sizeof(widget_t) bytes of SRAM */
+#define WIDGET_MAX 8
+
+/* Longest string a value widget can hold, including the '\0' */
+#define WIDGET_VALUE_LENGTH 9
+
+/* Returned by the WIDGET_add_x() functions when the table is full */
+#define WIDGET_NONE 0xFF
+
+/* Passed to WIDGET_screen() when the buffer is being drawn without widgets */
+#define WIDGET_SCREEN_NONE 0xFF
+
+#define WIDGET_TYPE_LABEL	0x00
+#define WIDGET_TYPE_VALUE	0x01
+#define WIDGET_TYPE_ICON	0x02
+#define WIDGET_TYPE_BOX		0x03
+#define WIDGET_TYPE_PACKED_ICON	0x04
+#define WIDGET_TYPE_LABEL_P	0x05
+#define WIDGET_TYPE_FORMAT_P	0x06
+
+/* widget_t.flags */
+#define WIDGET_CHANGED	0x01	/* Needs to be redrawn by WIDGET_render() */
+#define WIDGET_FILLED	0x02	/* Box is solid rather than an outline */
+
+/* Box styles for WIDGET_add_box() */
+#define WIDGET_BOX_OUTLINE	0x00
+#define WIDGET_BOX_FILLED	0x01
+
+typedef struct {
+	uint8_t type;			/* WIDGET_TYPE_x */
+	uint8_t flags;			/* WIDGET_CHANGED and WIDGET_FILLED */
+	uint8_t xPosition;		/* Position given to the OLED draw function */
+	uint8_t yPosition;
+	uint8_t width;			/* Size of an icon or box, the font size and spacing of a string */
+	uint8_t height;
+	uint8_t alignment;		/* OLED_ALIGN_x, strings only */
+	uint8_t orientation;	/* screenOrientation given to the OLED draw function */
+	const void* data;		/* String of a label, PROGMEM string of a label_P or format_P or PROGMEM image of an icon */
+	char value[WIDGET_VALUE_LENGTH];	/* String of a value, the first 3 bytes are the numbers of a format_P */
+	uint8_t bounds[4];		/* Area of the screen last drawn: left, right, top, bottom (exclusive) */
+} widget_t;
+
+uint8_t WIDGET_screen(uint8_t screen);
+void WIDGET_set_background(const uint8_t background[]);
+uint8_t WIDGET_add_label(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation);
+uint8_t WIDGET_add_label_P(const char* string, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation);
+uint8_t WIDGET_add_value(uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation);
+uint8_t WIDGET_add_format_P(const char* format, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation);
+uint8_t WIDGET_add_icon(const uint8_t xbm[], uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t screenOrientation);
+uint8_t WIDGET_add_packed_icon(const uint8_t packed[], uint8_t xPosition, uint8_t yPosition, uint8_t screenOrientation);
+uint8_t WIDGET_add_box(uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t style, uint8_t screenOrientation);
+void WIDGET_set_value(uint8_t widget, char* string);
+void WIDGET_set_numbers(uint8_t widget, uint8_t first, uint8_t second, uint8_t third);
+void WIDGET_set_image(uint8_t widget, const uint8_t image[]);
+void WIDGET_set_position(uint8_t widget, uint8_t xPosition, uint8_t yPosition);
+void WIDGET_render();
+
+#endif /* OLED_WIDGETS_H_ */
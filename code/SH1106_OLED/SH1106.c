@@ -4,7 +4,8 @@
  * Author: Tom
  * Date: 10/11/2023
  * AVR Library for 128x64 SH1106 OLED Display Module. This lib
- * requires the Peter Fleury i2cmaster interface.
+ * requires the Peter Fleury i2cmaster interface, or
+ * Atmega328p_SPI.h by me when using the 4-wire SPI interface.
  * I have created 4 fonts for the screen so far.
  * This was written specifically for the atmega328p MCU. 
  **************************************************************
@@ -15,9 +16,30 @@
  * data for the screen.
  * OLED_display_buffer() - Display the pixel data buffer on the
  * sh1106.
+ * OLED_display_buffer_async() - Start displaying the pixel data
+ * buffer on the sh1106 using the TWI interrupt.
+ * OLED_flush_busy() - Check if the interrupt driven display of
+ * the buffer is still in progress.
  * OLED_draw_string() - Draw a string in the buffer.
+ * OLED_draw_string_P() - Draw a string stored in PROGMEM in
+ * the buffer.
+ * OLED_draw_string_font() - Draw a string in the buffer with
+ * a font descriptor.
+ * OLED_draw_string_aligned() - Draw a string in the buffer
+ * aligned left, center or right on a point.
+ * OLED_printf_P() - Format a string with a PROGMEM format and
+ * draw it in the buffer.
+ * OLED_measure_string() - Get the width and height of a string.
+ * OLED_measure_string_P() - Get the width and height of a
+ * string stored in PROGMEM.
+ * OLED_measure_printf_P() - Get the width and height of a
+ * string formatted as OLED_printf_P() draws it.
+ * OLED_measure_character() - Get the position and width of a
+ * character in a string.
  * OLED_set_pixel() - Set a pixel in the buffer at a position.
  * OLED_draw_xbm() - Draw an XBM image file to the screen.
+ * OLED_draw_packed() - Draw an image compressed by
+ * tools/pack_assets.py to the screen.
  * OLED_screen_off()
  * OLED_screen_on()
  * OLED_invert_buffer() - Invert all data in the buffer.
@@ -28,37 +50,217 @@
  * of the buffer.
  * OLED_invert_rectangle() - Invert pixels on the buffer in a
  * rectangular region.
+ * OLED_clear_rectangle() - Clear pixels on the buffer in a
+ * rectangular region.
+ * OLED_draw_background() - Replace the buffer with a background
+ * made by tools/make_backgrounds.py.
+ * OLED_restore_background() - Put back the pixels of a background
+ * in a rectangular region.
+ * OLED_set_clip() - Limit drawing to a rectangular region.
+ * OLED_reset_clip() - Allow drawing on the whole screen again.
+ * OLED_set_canvas() - Turn the coordinates of the draw functions
+ * to a screen orientation.
+ * OLED_get_canvas() - Get the orientation of the canvas.
  * OLED_draw_horizontal_line() - Draw a horizontal line on the scren.
  * OLED_draw_vertical_line() - Draw a vertical line on the screen.
  * OLED_draw_rectangle() - Draw a rectangle on the screen.
  * OLED_draw_circle() - Draw a circle on the screen.
  * OLED_display_invert() - Invert the display.
+ * OLED_scroll_to() - Move the picture up the display without
+ * sending it again.
+ * OLED_roll_start() - Start rolling the old frame off the
+ * display and the buffer on.
+ * OLED_roll_step() - Move a roll on by one step.
  **************************************************************
 */
 
 #include <avr/io.h>
 #include <string.h>
+#include <stdarg.h>
 #include <avr/pgmspace.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
 
 #include "SH1106.h"
-#include "../pFleury_i2c_stuff/i2cmaster.h"
+
+#ifdef OLED_SPI_MODE
+	#include "../Atmega328p_SPI/Atmega328p_SPI.h"
+#else
+	#include "../pFleury_i2c_stuff/i2cmaster.h"
+#endif /* OLED_SPI_MODE */
 #include "XBM_fonts/XBM_FONT_8.h"
 #include "XBM_fonts/XBM_FONT_16.h"
 #include "XBM_fonts/XBM_FONT_NUMBERS_20.h"
 #include "XBM_fonts/XBM_FONT_NUMBERS_25.h"
+#include "XBM_fonts/XBM_FONTS_ROTATED.h"
+
+/* Fonts available to OLED_draw_string(), selected by their height */
+static const font_t* const _fonts[] PROGMEM = {
+	&FONT_8_DESCRIPTOR,
+	&FONT_16_DESCRIPTOR,
+	&FONT_20_DESCRIPTOR,
+	&FONT_25_DESCRIPTOR
+};
+
+/* 
+Position and settings of a string being drawn or measured one character at a time, see
+_text_start(). The cursor and width are relative to xStart.
+*/
+typedef struct {
+	const font_t* font;		/* Descriptor of the font stored in PROGMEM */
+	uint8_t xStart;			/* x-coordinate of the start of the string */
+	uint8_t yPosition;		/* y-coordinate of the top of the string */
+	uint8_t spacing;		/* Pixels between characters */
+	uint8_t orientation;	/* screenOrientation given to the draw functions */
+	uint8_t draw;			/* 1 = draw the characters, 0 = only measure them */
+	uint8_t cursor;			/* Where the next character starts */
+	uint8_t width;			/* One past the last column of the characters so far */
+	uint8_t lowest;			/* One past the lowest row of the characters so far */
+} text_cursor_t;
+
+/* Powers of ten used by OLED_printf_P() to split a number into digits without dividing */
+static const uint32_t _powersOfTen[] PROGMEM = {
+	1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+#ifdef OLED_PAGE_RENDERER
+	/* Used to store the pixel data for the strip of pages being drawn by OLED_render() */
+	static uint8_t _oled_buffer[OLED_STRIP_PAGES][OLED_WIDTH];
+	
+	/* The page of the screen that the first page of _oled_buffer holds */
+	static uint8_t _stripPage = OLED_HEIGHT / 8;
+	
+	#define OLED_BUFFER_PAGES		OLED_STRIP_PAGES
+	#define OLED_BUFFER_FIRST_PAGE	_stripPage
+#else
+	/* Used to store the pixel data for the OLED display */
+	static uint8_t _oled_buffer[OLED_HEIGHT / 8][OLED_WIDTH];
+	
+	#define OLED_BUFFER_PAGES		(OLED_HEIGHT / 8)
+	#define OLED_BUFFER_FIRST_PAGE	0
+#endif /* OLED_PAGE_RENDERER */
+
+/* 
+Region of the screen that drawing is limited to, see OLED_set_clip(). _clipRight and
+_clipBottom are one past the region and _clipMasks holds the rows of the region in each page.
+*/
+static uint8_t _clipLeft;
+static uint8_t _clipRight;
+static uint8_t _clipTop;
+static uint8_t _clipBottom;
+static uint8_t _clipMasks[OLED_HEIGHT / 8];
+
+/* Orientation the pixel, line, rectangle and circle coordinates are turned by, see OLED_set_canvas() */
+static uint8_t _canvasOrientation = OLED_CLOCKWISE_0;
+
+#ifndef OLED_SPI_MODE
+	/* Address and bit rate of the display on the i2c bus */
+	static const i2c_device_t _oledDevice = I2C_DEVICE(OLED_ADDR << 1, OLED_I2C_BITRATE);
+#endif /* OLED_SPI_MODE */
 
-/* Used to store the pixel data for the OLED display */
-static uint8_t _oled_buffer[OLED_HEIGHT / 8][OLED_WIDTH];
+#ifndef OLED_PAGE_RENDERER
+/* 
+Range of columns on each page that have changed since the last time the buffer was sent
+to the display. _dirtyStart is the first changed column and _dirtyEnd is one past the last.
+A page is clean when _dirtyStart >= _dirtyEnd.
+The interrupt driven flush claims a page from the TWI interrupt, so the main loop only
+changes a pair with interrupts disabled.
+*/
+static volatile uint8_t _dirtyStart[OLED_HEIGHT / 8];
+static volatile uint8_t _dirtyEnd[OLED_HEIGHT / 8];
+
+#ifdef OLED_SHADOW_BUFFER
+	/* Copy of the pixel data that was last sent to the OLED display */
+	static uint8_t _oled_shadow[OLED_HEIGHT / 8][OLED_WIDTH];
+#endif /* OLED_SHADOW_BUFFER */
+
+/* 
+State of the flush in progress. This is shared by the blocking flush and the interrupt
+driven flush started by OLED_display_buffer_async().
+*/
+static uint8_t _flushPage;			/* Page being sent */
+static uint8_t _flushPageStart;		/* First changed column claimed from _flushPage */
+static uint8_t _flushPageEnd;		/* One past the last changed column claimed from _flushPage */
+static uint8_t _flushColumn;		/* Next column to be sent */
+static uint8_t _flushSpanEnd;		/* One past the last column of the span being sent */
+static uint8_t _flushCommands[3];	/* Address commands for the span being sent */
+static volatile uint8_t _flushBusy;	/* An interrupt driven flush is in progress */
+static void (*_flushCallback)(void);	/* Called when the interrupt driven flush finishes */
+
+#ifndef OLED_SPI_MODE
+	/* i2c transactions queued by the interrupt driven flush, the address then the data of each span */
+	static i2c_transaction_t _flushAddress = {
+		.device = &_oledDevice,
+		.flags = I2C_TRANSACTION_REGISTER,
+		.reg = OLED_COMMAND_MODE,
+		.writeData = _flushCommands,
+		.writeLength = 3
+	};
+	static i2c_transaction_t _flushData = {
+		.device = &_oledDevice,
+		.flags = I2C_TRANSACTION_REGISTER,
+		.reg = OLED_DATA_MODE
+	};
+#endif /* OLED_SPI_MODE */
+
+/* Roll in progress, see OLED_roll_start() */
+static uint8_t _rollDirection = OLED_ROLL_NONE;
+static uint8_t _rollLines;			/* Lines the display has rolled so far */
+static uint8_t _rollPagesSent;		/* Pages of the new frame sent so far */
+#endif /* OLED_PAGE_RENDERER */
 
 /* Private function prototypes */
+#ifdef OLED_SPI_MODE
+static void _spi_transfer(uint8_t dataCommand, uint8_t bytes[], uint8_t numOfBytes);
+#endif /* OLED_SPI_MODE */
 static void _single_command(uint8_t command);
 static void _multiple_command(uint8_t commands[], uint8_t numOfCommands);
-static void _send_byte(uint8_t byte);
-static uint8_t _bitread(uint8_t byte, uint8_t bit);
-static void _xbm_font_8_to_buffer(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation);
-static void _xbm_font_16_to_buffer(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation);
-static void _xbm_font_20_to_buffer(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation);
-static void _xbm_font_25_to_buffer(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation);
+static void _send_data(uint8_t data[], uint8_t numOfBytes);
+static void _set_page_and_column(uint8_t page, uint8_t column);
+static void _mark_dirty(uint8_t page, uint8_t columnStart, uint8_t columnEnd);
+static void _mark_all_dirty();
+static void _address_commands(uint8_t page, uint8_t column, uint8_t commands[3]);
+#ifndef OLED_PAGE_RENDERER
+static void _send_span(uint8_t page, uint8_t columnStart, uint8_t columnEnd);
+static void _claim_page(uint8_t page);
+static uint8_t _next_span();
+static void _wait_for_flush();
+#ifndef OLED_SPI_MODE
+static void _flush_post_span();
+static void _flush_address_sent(i2c_transaction_t* transaction);
+static void _flush_data_sent(i2c_transaction_t* transaction);
+static void _flush_failed();
+static void _flush_finished();
+#endif /* OLED_SPI_MODE */
+#endif /* OLED_PAGE_RENDERER */
+static uint8_t _strip_overlaps(int16_t yTop, int16_t yBottom);
+static void _or_column_byte(int16_t xPosition, int16_t yTop, uint8_t bits);
+static void _draw_byte(uint8_t page, uint8_t column, uint8_t mask, uint8_t drawMode);
+static void _draw_pixel(int16_t xCoordinate, int16_t yCoordinate, uint8_t drawMode);
+static void _fill_region(int16_t xLeft, int16_t xRight, int16_t yTop, int16_t yBottom, uint8_t drawMode);
+static uint8_t _clip_region(int16_t* xLeft, int16_t* xRight, int16_t* yTop, int16_t* yBottom);
+static uint8_t _page_mask(uint8_t page, int16_t yTop, int16_t yBottom);
+static void _canvas_region(int16_t* xLeft, int16_t* xRight, int16_t* yTop, int16_t* yBottom);
+static void _canvas_fill(int16_t xLeft, int16_t xRight, int16_t yTop, int16_t yBottom, uint8_t drawMode);
+static void _canvas_pixel(int16_t xCoordinate, int16_t yCoordinate, uint8_t drawMode);
+static const uint8_t* _background_page(const uint8_t* background, uint8_t page);
+static void _circle_points(uint8_t xCenter, uint8_t yCenter, uint8_t x, uint8_t y, uint8_t drawMode, uint8_t clipped);
+static void _outline_pixel(uint8_t column, uint8_t row, uint8_t value);
+static uint8_t _reverse_byte(uint8_t byte);
+static void _draw_packed_pixels(const uint8_t* data, uint8_t encoding, uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t screenOrientation);
+static void _draw_packed_span(uint8_t xPosition, uint8_t yPosition, uint8_t column, uint8_t rowStart, uint8_t rowEnd, uint8_t screenOrientation);
+#ifdef OLED_PRE_ROTATED_FONTS
+static uint8_t _draw_pre_rotated(const uint8_t* const rotated[], const uint16_t* const rotatedOffsets[], uint8_t index, uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t screenOrientation);
+#endif /* OLED_PRE_ROTATED_FONTS */
+static uint8_t _glyph_index(const font_t* font, uint8_t character);
+static const font_t* _font_for_size(uint8_t fontSize);
+static uint8_t _string_metrics(const font_t* font, char* string, uint8_t numOfCharacters, uint8_t characterSpacing, uint8_t* cursor, uint8_t* height);
+static uint8_t _aligned_start(uint8_t width, uint8_t xPosition, uint8_t alignment);
+static void _text_start(text_cursor_t* text, const font_t* font, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation, uint8_t draw);
+static void _text_put(text_cursor_t* text, uint8_t character);
+static void _text_put_P(text_cursor_t* text, const char* string);
+static void _text_format(text_cursor_t* text, const char* format, va_list args);
+static void _text_number(text_cursor_t* text, uint32_t value, uint8_t negative, uint8_t width, uint8_t zeroPad, uint8_t decimals, uint8_t hex);
 
 /*
 * OLED_init()
@@ -69,7 +271,14 @@ static void _xbm_font_25_to_buffer(char* string, uint8_t xPosition, uint8_t yPos
 * then the OLED_NUMBER_OF_INITIALISATION_COMMANDS macro must be updated.
 */
 void OLED_init() {
-	i2c_init();
+	#ifdef OLED_SPI_MODE
+		DDRB |= (1 << OLED_SPI_CS_PIN) | (1 << OLED_SPI_DC_PIN);
+		PORTB |= (1 << OLED_SPI_CS_PIN);
+		A328p_SPI_init();
+	#else
+		i2c_init();
+	#endif /* OLED_SPI_MODE */
+	
 	uint8_t initCommands[] = {
 		OLED_DISPLAY_OFF,
 		OLED_MUX_RATIO, 0x3F,						/* Multiplex ratio 1/64 duty cycle */
@@ -86,6 +295,18 @@ void OLED_init() {
 		OLED_DISPLAY_ON	
 	};
 	_multiple_command(initCommands, OLED_NUMBER_OF_INITIALISATION_COMMANDS);
+	OLED_reset_clip();
+	
+	/* The display RAM is random at power up so send the whole buffer once */
+	#ifdef OLED_PAGE_RENDERER
+		OLED_render(0);
+	#else
+		for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
+			_send_span(page, 0, OLED_WIDTH);
+			_dirtyStart[page] = OLED_WIDTH;
+			_dirtyEnd[page] = 0;
+		}
+	#endif /* OLED_PAGE_RENDERER */
 }
 
 /* 
@@ -105,10 +326,59 @@ void OLED_display_invert(uint8_t invert) {
 	}
 }
 
+/*
+* OLED_scroll_to()
+* ----------------
+* External function to set the line of the display RAM shown at the top of the screen. The
+* picture moves up by 'line' rows and the rows that leave the top come back in at the bottom.
+* Only one command byte is sent, the buffer and the display RAM are not changed.
+*
+* line: The first line to show (0 - 63), 0 is the normal position.
+*
+* NOTE: Drawing still uses the normal coordinates, the scroll only moves what is shown.
+*/
+void OLED_scroll_to(uint8_t line) {
+	_single_command(OLED_DISPLAY_START_LINE | (line & (OLED_HEIGHT - 1)));
+}
+
+#ifdef OLED_SPI_MODE
+/*
+* _spi_transfer()
+* ---------------
+* Private function to send commands or display data to the OLED display using SPI. The
+* SPI clock is raised to OLED_SPI_CLOCK_RATE for the transfer and restored afterwards so
+* slower devices on the same bus are not affected.
+*
+* dataCommand: OLED_DATA_MODE to send display data, OLED_COMMAND_MODE to send commands.
+*
+* bytes: The bytes to be sent to the OLED display.
+*
+* numOfBytes: The number of bytes in the 'bytes' array.
+*/
+static void _spi_transfer(uint8_t dataCommand, uint8_t bytes[], uint8_t numOfBytes) {
+	uint8_t previousRate = A328p_SPI_get_clock_rate();
+	A328p_SPI_set_clock_rate(OLED_SPI_CLOCK_RATE);
+	
+	if (dataCommand == OLED_DATA_MODE) {
+		PORTB |= (1 << OLED_SPI_DC_PIN);
+	} else {
+		PORTB &= ~(1 << OLED_SPI_DC_PIN);
+	}
+	
+	PORTB &= ~(1 << OLED_SPI_CS_PIN);
+	for (uint8_t i = 0; i < numOfBytes; i++) {
+		A328p_SPI_transmit_byte(bytes[i]);
+	}
+	PORTB |= (1 << OLED_SPI_CS_PIN);
+	
+	A328p_SPI_set_clock_rate(previousRate);
+}
+#endif /* OLED_SPI_MODE */
+
 /*	
 * _single_command()
 * ---------------------
-* Private function to send a single command to the OLED display using i2c.
+* Private function to send a single command to the OLED display.
 *
 * command: Command to be sent to the OLED display.
 *
@@ -116,17 +386,17 @@ void OLED_display_invert(uint8_t invert) {
 *		for an invalid command.
 */ 
 static void _single_command(uint8_t command) {
-	i2c_set_bitrate(OLED_I2C_BITRATE);
-	i2c_start_wait(OLED_ADDR << 1);	
-	i2c_write(OLED_COMMAND_MODE);	
-	i2c_write(command);
-	i2c_stop();
+	#ifdef OLED_SPI_MODE
+		_spi_transfer(OLED_COMMAND_MODE, &command, 1);
+	#else
+		i2c_write_regs(&_oledDevice, OLED_COMMAND_MODE, &command, 1);
+	#endif /* OLED_SPI_MODE */
 }
 
 /*	
 * _multiple_command()
 * -----------------------
-* Private function to send multiple commands to the OLED display using i2c.
+* Private function to send multiple commands to the OLED display.
 *
 * commands:	An array of commands that will be sent to the OLED display.
 *			The commands will be sent in the same order that they appear
@@ -138,495 +408,1866 @@ static void _single_command(uint8_t command) {
 *		for invalid commands.
 */
 static void _multiple_command(uint8_t commands[], uint8_t numOfCommands) {
-	i2c_set_bitrate(OLED_I2C_BITRATE);
-	i2c_start_wait(OLED_ADDR << 1);	
-	i2c_write(OLED_COMMAND_MODE);	
-	for (uint8_t i = 0; i < numOfCommands; i++) {
-		i2c_write(commands[i]);
-	}
-	i2c_stop();
+	#ifdef OLED_SPI_MODE
+		_spi_transfer(OLED_COMMAND_MODE, commands, numOfCommands);
+	#else
+		i2c_write_regs(&_oledDevice, OLED_COMMAND_MODE, commands, numOfCommands);
+	#endif /* OLED_SPI_MODE */
 }
 
 /*
-* OLED_clear_buffer()
-* -------------------
-* Clear the OLED display buffer by setting all the elements of the array to 0x00.
+* _mark_dirty()
+* -------------
+* Private function to record that a range of columns on a page has changed and needs to
+* be sent to the display on the next flush. The range is merged with any range already
+* recorded for that page.
+*
+* page: The page that has changed.
+*
+* columnStart: The first column that has changed.
+*
+* columnEnd: One past the last column that has changed.
+*
+* NOTE: With OLED_PAGE_RENDERER defined every strip is sent in full so nothing is recorded.
 */
-void OLED_clear_buffer() {
-	for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
-		for (uint8_t column = 0; column < OLED_WIDTH; column++) {
-			_oled_buffer[page][column] = 0x00;
+static void _mark_dirty(uint8_t page, uint8_t columnStart, uint8_t columnEnd) {
+	#ifndef OLED_PAGE_RENDERER
+		// A page claimed by the flush part way through would be left as [OLED_WIDTH, end)
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+			if (columnStart < _dirtyStart[page]) {
+				_dirtyStart[page] = columnStart;
+			}
+			if (columnEnd > _dirtyEnd[page]) {
+				_dirtyEnd[page] = columnEnd;
+			}
 		}
-	}
+	#else
+		(void)page;
+		(void)columnStart;
+		(void)columnEnd;
+	#endif /* OLED_PAGE_RENDERER */
 }
 
 /*
-* _send_byte()
-* ----------------
-* Private function to send a single byte of data to be displayed on the OLED screen.
-*
-* byte: The byte of data to be sent to the OLED display.
+* _mark_all_dirty()
+* -----------------
+* Private function to mark every column on every page as changed.
 */
-static void _send_byte(uint8_t byte) {
-	i2c_set_bitrate(OLED_I2C_BITRATE);
-	i2c_start_wait(OLED_ADDR << 1);
-	i2c_write(OLED_DATA_MODE);		
-	i2c_write(byte);
-	i2c_stop();
+static void _mark_all_dirty() {
+	#ifndef OLED_PAGE_RENDERER
+		for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+				_dirtyStart[page] = 0;
+				_dirtyEnd[page] = OLED_WIDTH;
+			}
+		}
+	#endif /* OLED_PAGE_RENDERER */
 }
 
 /*
-* OLED_display_buffer()
-* ---------------------
-* External function to display the content of the buffer on the OLED display.
+* OLED_clear_buffer()
+* -------------------
+* Clear the OLED display buffer by setting all the elements of the array to 0x00.
+* Only the columns that were not already blank are marked as changed.
+* If an interrupt driven flush is in progress this waits for it to finish first.
+* With OLED_PAGE_RENDERER defined this clears the strip being rendered.
 */
-void OLED_display_buffer() {
-	uint8_t horizontalOffset = 2;	// The horizontal offset will vary depending on the hardware
+void OLED_clear_buffer() {
+	#ifndef OLED_PAGE_RENDERER
+		_wait_for_flush();	/* Wait for an interrupt driven flush to finish with the buffer */
+	#endif /* OLED_PAGE_RENDERER */
 	
-	for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
-		_single_command(OLED_SET_PAGE_ADDR + page);	// Set page address
-		for (uint8_t column = horizontalOffset; column < OLED_WIDTH + horizontalOffset; column++) {
-			_single_command(OLED_SET_LOWER_COLUMN_ADDR + (column & 0x0F));
-			_single_command(OLED_SET_HIGHER_COLUMN_ADDR + ((column >> 4) & 0x0F));
-			_send_byte(_oled_buffer[page][column - horizontalOffset]);
+	for (uint8_t page = 0; page < OLED_BUFFER_PAGES; page++) {
+		for (uint8_t column = 0; column < OLED_WIDTH; column++) {
+			if (_oled_buffer[page][column]) {
+				_oled_buffer[page][column] = 0x00;
+				_mark_dirty(OLED_BUFFER_FIRST_PAGE + page, column, column + 1);
+			}
 		}
 	}
 }
 
 /*
-* OLED_draw_string()
-* ------------------
-* External function to draw a string on the buffer in the correct position and orientation.
-*
-* string: The string to be represented in the buffer.
-*
-* xPosition:	The x-coordinate of the starting pixel of the string.
+* _send_data()
+* ------------
+* Private function to send a block of display data to the OLED screen in a single
+* transaction. The SH1106 increments its column address after every data byte so
+* consecutive bytes land in consecutive columns of the current page.
 *
-* yPosition:	The y-coordinate of the starting pixel of the string.
+* data: The bytes of pixel data to be sent to the OLED display.
 *
-* fontSize: The desired font size (Either 8 or 16 so far).
+* numOfBytes: The number of bytes in the 'data' array.
+*/
+static void _send_data(uint8_t data[], uint8_t numOfBytes) {
+	#ifdef OLED_SPI_MODE
+		_spi_transfer(OLED_DATA_MODE, data, numOfBytes);
+	#else
+		i2c_write_regs(&_oledDevice, OLED_DATA_MODE, data, numOfBytes);
+	#endif /* OLED_SPI_MODE */
+}
+
+/*
+* _address_commands()
+* -------------------
+* Private function to build the three commands that point the SH1106 RAM address at a page
+* and column of the buffer.
 *
-* characterSpacing: The desired number of pixels between the characters stored in the buffer.
+* page: The page (row of 8 pixels) to write to next.
 *
-* screenOrientation: The desired orientation of the screen:
-*		0 = No rotation (normal orientation).
-*		1 = 90 degrees clockwise rotation.
-*		2 = 180 degrees clockwise rotation (upside down).
-*		3 = 270 degrees clockwise rotation.
+* column: The buffer column to write to next, the hardware offset is added here.
 *
-* NOTE: 
-*	- Not all characters can be represented in the buffer, only those defined in the font file.
-*	- No checks for valid x and y coordinates.
+* commands: Array of 3 bytes that the commands are stored in.
 */
-void OLED_draw_string(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t screenOrientation) {
-	if (fontSize == 8) {
-		_xbm_font_8_to_buffer(string, xPosition, yPosition, characterSpacing, screenOrientation);
-	} else if (fontSize == 16) {
-		_xbm_font_16_to_buffer(string, xPosition, yPosition, characterSpacing, screenOrientation);
-	} else if (fontSize == 20) {
-		_xbm_font_20_to_buffer(string, xPosition, yPosition, characterSpacing, screenOrientation);
-	} else if (fontSize == 25) {
-		_xbm_font_25_to_buffer(string, xPosition, yPosition, characterSpacing, screenOrientation);
-	}
+static void _address_commands(uint8_t page, uint8_t column, uint8_t commands[3]) {
+	column += OLED_COLUMN_OFFSET;
+	commands[0] = OLED_SET_PAGE_ADDR + page;
+	commands[1] = OLED_SET_LOWER_COLUMN_ADDR + (column & 0x0F);
+	commands[2] = OLED_SET_HIGHER_COLUMN_ADDR + ((column >> 4) & 0x0F);
 }
 
 /*
-* OLED_set_pixel()
-* ----------------
-* External function that sets a single pixel on the display buffer at the specified position.
-*
-* xCoordinate:	The x-coordinate of the pixel.
+* _set_page_and_column()
+* ----------------------
+* Private function to point the SH1106 RAM address at a page and column of the buffer.
+* The page address and both halves of the column address are sent in one transaction.
 *
-* yCoordinate:	The y-coordinate of the pixel.
+* page: The page (row of 8 pixels) to write to next.
 *
-* NOTE: No checks for valid x and y coordinates.
+* column: The buffer column to write to next.
 */
-void OLED_set_pixel(uint8_t xCoordinate, uint8_t yCoordinate) {
-	uint8_t page = yCoordinate / 8;
-	uint8_t column = xCoordinate;
-	uint8_t value = 1 << (yCoordinate - (yCoordinate / 8) * 8);
-	_oled_buffer[page][column] |= value;
+static void _set_page_and_column(uint8_t page, uint8_t column) {
+	uint8_t commands[3];
+	_address_commands(page, column, commands);
+	_multiple_command(commands, 3);
 }
 
+#ifndef OLED_PAGE_RENDERER
 /*
-* _bitread()
-* ---------
-* Private function that reads the specific value bit in a given byte and returns the bit.
-*
-* byte:	The byte from which to read the bit.
+* _send_span()
+* ------------
+* Private function to send a range of columns on one page of the buffer to the display.
 *
-* bit:	The position of the bit to read.
+* page: The page the columns are on.
 *
-* Return:	The value of the specific bit (0 or 1)
+* columnStart: The first column to send.
 *
-* REF:	This function is taken directly from an arduino library, do a quick google search and you will find it.
+* columnEnd: One past the last column to send.
 */
-static uint8_t _bitread(uint8_t byte, uint8_t bit) {
-	if (bit > 7) {
-		return 0;
-	}
+static void _send_span(uint8_t page, uint8_t columnStart, uint8_t columnEnd) {
+	_set_page_and_column(page, columnStart);
+	_send_data(&_oled_buffer[page][columnStart], columnEnd - columnStart);
 	
-	uint8_t result = 0x00;
-	
-	result |= (byte & (1 << bit)) >> bit;
-	return result;
+	#ifdef OLED_SHADOW_BUFFER
+		memcpy(&_oled_shadow[page][columnStart], &_oled_buffer[page][columnStart], columnEnd - columnStart);
+	#endif /* OLED_SHADOW_BUFFER */
 }
 
 /*
-* _xbm_font_8_to_buffer()
-* ---------------------------
-* Private function to draw a string in the buffer using an xbm font 8 pixels high and various widths. This function is
-* designed to use the font designed in XBM_FONT_8.h
-*
-* string: The string to be represented in the buffer.
-*
-* nxPosition:	The x-coordinate of the starting pixel of the string.
-*
-* yPosition:	The y-coordinate of the starting pixel of the string.
-*
-* characterSpacing: The desired number of pixels between the characters stored in the buffer.
-*	
-* screenOrientation: The desired orientation of the string:
-*	0 = No rotation (normal orientation).
-*	1 = 90 degrees clockwise rotation.
-*	2 = 180 degrees clockwise rotation (upside down).
-*	3 = 270 degrees clockwise rotation.
+* _claim_page()
+* -------------
+* Private function to move the flush on to a page. The changed range of the page is taken
+* over by the flush and the page is marked as clean, so anything drawn on the page while
+* the flush is in progress is kept for the next flush.
 *
-* NOTE: 
-*	- No checks for valid x and y coordinates.
-*	- XBM_FONT_8.h must be included
-*/
-static void _xbm_font_8_to_buffer(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation) {
-	uint8_t indexNumSize = (uint8_t)strlen(string);
-	uint8_t indexNums[indexNumSize];
-	uint8_t cursorPosition = xPosition;
-	
-	// This loop is used to map the index of each character in the string to the corresponding entry in the font array.
-	for (uint8_t i = 0; i < indexNumSize; i++) {
-		if ((string[i] >= 'A') && (string[i] <= 'Z')) {
-			indexNums[i] = (uint8_t)(string[i] - 65);
-		} else if ((string[i] >= 'a') && (string[i] <= 'z')) {
-			indexNums[i] = (uint8_t)(string[i] - 71);
-		} else if ((string[i] >= '0') && (string[i] <= '9')) {
-			indexNums[i] = (uint8_t)(string[i] + 4);
-		} else if ((string[i] >= '!') && (string[i] <= '%')) {
-			indexNums[i] = (uint8_t)(string[i] + 29);
-		} else if ((string[i] >= 39) && (string[i] <= ')')) {
-			indexNums[i] = (uint8_t)(string[i] + 28);
-		} else if ((string[i] >= '+') && (string[i] <= '/')) {
-			indexNums[i] = (uint8_t)(string[i] + 27);
-		} else if ((string[i] >= ':') && (string[i] <= ';')) {
-			indexNums[i] = (uint8_t)(string[i] + 17);
-		} else if (string[i] == '=') {
-			indexNums[i] = 77;
-		} else if (string[i] == '?') {
-			indexNums[i] = 78;
-		} else if (string[i] == 254) {
-			indexNums[i] = 79;
-		} else if (string[i] == 255) {
-			indexNums[i] = 80;
-		}
-	}
-	
-	for (uint8_t i = 0; i < indexNumSize; i++) {
+* page: The page the flush moves on to.
+*/
+static void _claim_page(uint8_t page) {
+	_flushPage = page;
+	_flushPageStart = _dirtyStart[page];
+	_flushPageEnd = _dirtyEnd[page];
+	_flushColumn = _flushPageStart;
+	
+	_dirtyStart[page] = OLED_WIDTH;
+	_dirtyEnd[page] = 0;
+}
+
+/*
+* _next_span()
+* ------------
+* Private function to find the next range of columns that needs to be sent to the display,
+* starting from _flushColumn on _flushPage. This is used by both the blocking and the
+* interrupt driven flush. With OLED_SHADOW_BUFFER defined the columns that already match
+* the display are skipped, and runs separated by no more than OLED_SHADOW_RUN_GAP matching
+* columns are sent as one since that is cheaper than addressing a new run.
+*
+* Return:	1 if a span was found, it starts at _flushColumn and ends at _flushSpanEnd.
+*			0 if there is nothing left to send.
+*/
+static uint8_t _next_span() {
+	while (1) {
+		#ifdef OLED_SHADOW_BUFFER
+			while ((_flushColumn < _flushPageEnd) && (_oled_buffer[_flushPage][_flushColumn] == _oled_shadow[_flushPage][_flushColumn])) {
+				_flushColumn++;
+			}
+			
+			if (_flushColumn < _flushPageEnd) {
+				_flushSpanEnd = _flushColumn + 1;
+				for (uint8_t column = _flushSpanEnd; (column < _flushPageEnd) && ((column - _flushSpanEnd) <= OLED_SHADOW_RUN_GAP); column++) {
+					if (_oled_buffer[_flushPage][column] != _oled_shadow[_flushPage][column]) {
+						_flushSpanEnd = column + 1;
+					}
+				}
+				return 1;
+			}
+		#else
+			if (_flushColumn < _flushPageEnd) {
+				_flushSpanEnd = _flushPageEnd;
+				return 1;
+			}
+		#endif /* OLED_SHADOW_BUFFER */
 		
-		if (string[i] == ' ') {
-			cursorPosition += 5;
-			continue;
+		if (_flushPage == (OLED_HEIGHT / 8) - 1) {
+			return 0;
 		}
-		
-		uint8_t* word = (uint8_t*)pgm_read_word(&(FONT_8[indexNums[i]]));
-		uint8_t characterWidth = pgm_read_byte(&(FONT_8_WIDTHS[indexNums[i]]));
-		uint8_t characterOffset = pgm_read_byte(&(FONT_8_Y_OFFSET[indexNums[i]]));
-		
-		OLED_draw_xbm(cursorPosition, yPosition + characterOffset, word, characterWidth, 8, screenOrientation);
-		cursorPosition += characterWidth + characterSpacing;
+		_claim_page(_flushPage + 1);
+	}
+}
+
+/*
+* OLED_display_buffer()
+* ---------------------
+* External function to display the content of the buffer on the OLED display.
+* Only the range of columns that changed on each page since the last call is sent,
+* streamed as one data transaction after its address has been set. With
+* OLED_SHADOW_BUFFER defined that range is further reduced to the columns that differ
+* from what was last sent.
+* If an interrupt driven flush is in progress this waits for it to finish first.
+* Nothing is sent while a roll started by OLED_roll_start() is in progress.
+*/
+void OLED_display_buffer() {
+	_wait_for_flush();
+	
+	if (_rollDirection != OLED_ROLL_NONE) {
+		return;
+	}
+	
+	_claim_page(0);
+	while (_next_span()) {
+		_send_span(_flushPage, _flushColumn, _flushSpanEnd);
+		_flushColumn = _flushSpanEnd;
 	}
 }
 
 /*
-* _xbm_font_16_to_buffer()
+* OLED_display_buffer_async()
 * ---------------------------
-* Private function to draw a string in the buffer using an xbm font 16 pixels high and various widths. This function is
-* designed to use the font designed in XBM_FONT_16.h
-*
-* string: The string to be represented in the buffer.
-*
-* xPosition:	The x-coordinate of the starting pixel of the image.
+* External function to start displaying the content of the buffer on the OLED display
+* without waiting for it to finish. The same data as OLED_display_buffer() is sent, but
+* as i2c transactions queued with i2c_post() so the main loop can keep running. Other
+* devices can queue their own transactions in between the spans, blocking i2c transfers
+* wait until the flush has finished.
 *
-* yPosition:	The y-coordinate of the starting pixel of the image.
+* callback: Function called from the TWI interrupt once the flush has finished, or 0 for none.
 *
-* characterSpacing: The desired number of pixels between the characters stored in the buffer.
-*
-* screenOrientation: The desired orientation of the string:
-*	0 = No rotation (normal orientation).
-*	1 = 90 degrees clockwise rotation.
-*	2 = 180 degrees clockwise rotation (upside down).
-*	3 = 270 degrees clockwise rotation.
-*
-* NOTE:
-*	- No checks for valid x and y coordinates.
-*	- XBM_FONT_16.h must be included
-*/
-static void _xbm_font_16_to_buffer(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation) {
-	uint8_t indexNumSize = (uint8_t)strlen(string);
-	uint8_t indexNums[indexNumSize];
-	uint8_t cursorPosition = xPosition;
-	
-	// This loop is used to map the index of each character in the string to the corresponding entry in the font array.
-	for (uint8_t i = 0; i < indexNumSize; i++) {
-		if ((string[i] >= 'A') && (string[i] <= 'Z')) {
-			indexNums[i] = (uint8_t)(string[i] - 65);
-		} else if ((string[i] >= 'a') && (string[i] <= 'z')) {
-			indexNums[i] = (uint8_t)(string[i] - 71);
-		} else if ((string[i] >= '0') && (string[i] <= '9')) {
-			indexNums[i] = (uint8_t)(string[i] + 4);
-		} else if ((string[i] >= '!') && (string[i] <= '%')) {
-			indexNums[i] = (uint8_t)(string[i] + 29);
-		} else if ((string[i] >= 39) && (string[i] <= ')')) {
-			indexNums[i] = (uint8_t)(string[i] + 28);
-		} else if ((string[i] >= '+') && (string[i] <= '/')) {
-			indexNums[i] = (uint8_t)(string[i] + 27);
-		} else if ((string[i] >= ':') && (string[i] <= ';')) {
-			indexNums[i] = (uint8_t)(string[i] + 17);
-		} else if (string[i] == '=') {
-			indexNums[i] = 77;
-		} else if (string[i] == '?') {
-			indexNums[i] = 78;
-		} else if (string[i] == 254) {
-			indexNums[i] = 79;
-		} else if (string[i] == 255) {
-			indexNums[i] = 80;
-	}
-	}
-	
-	for (uint8_t i = 0; i < indexNumSize; i++) {
+* NOTE: 
+*	-	Global interrupts must be enabled.
+*	-	With OLED_SPI_MODE defined the flush is short enough that it is done before
+*		returning and the callback is called straight away.
+*	-	OLED_clear_buffer() waits for the flush to finish. Drawing into the buffer without
+*		clearing it first while the flush is busy may show up part way through this frame.
+*		Each draw marks its columns as changed with interrupts disabled, so a page the
+*		flush claims at the same time keeps them and they are sent with the next flush.
+*/
+void OLED_display_buffer_async(void (*callback)(void)) {
+	#ifdef OLED_SPI_MODE
+		OLED_display_buffer();
+		if (callback) {
+			callback();
+		}
+	#else
+		_wait_for_flush();
 		
-		if (string[i] == ' ') {
-			cursorPosition += 10;
-			continue;
+		if (_rollDirection != OLED_ROLL_NONE) {
+			/* The roll sends the buffer */
+			if (callback) {
+				callback();
+			}
+			return;
 		}
 		
-		uint8_t* word = (uint8_t*)pgm_read_word(&(FONT_16[indexNums[i]]));
-		uint8_t characterWidth = pgm_read_byte(&(FONT_16_WIDTHS[indexNums[i]]));
-		uint8_t characterOffset = pgm_read_byte(&(FONT_16_Y_OFFSET[indexNums[i]]));
+		_claim_page(0);
+		if (!_next_span()) {
+			/* Nothing has changed */
+			if (callback) {
+				callback();
+			}
+			return;
+		}
 		
-		OLED_draw_xbm(cursorPosition, yPosition + characterOffset, word, characterWidth, 16, screenOrientation);
-		cursorPosition += characterWidth + characterSpacing;
-	}
+		_flushCallback = callback;
+		_flushBusy = 1;
+		_flushAddress.callback = _flush_address_sent;
+		_flushData.callback = _flush_data_sent;
+		_flush_post_span();
+	#endif /* OLED_SPI_MODE */
 }
 
 /*
-* _xbm_font_20_to_buffer()
-* ---------------------------
-* Private function to draw a string in the buffer using an xbm font 20 pixels high and various widths. This function is
-* designed to use the font designed in XBM_FONT_NUMBERS_20.h
-*
-* string: The string to be represented in the buffer.
-*
-* xPosition:	The x-coordinate of the starting pixel of the image.
+* OLED_flush_busy()
+* -----------------
+* External function to check if an interrupt driven flush is still in progress.
 *
-* yPosition:	The y-coordinate of the starting pixel of the image.
+* Return:	1 if the flush is still in progress.
+*			0 if the bus and buffer are free.
+*/
+uint8_t OLED_flush_busy() {
+	return _flushBusy;
+}
+
+/*
+* OLED_roll_start()
+* -----------------
+* External function to start replacing the frame on the display with the buffer by rolling
+* it in with OLED_scroll_to(). Each OLED_roll_step() moves the display OLED_ROLL_STEP_LINES
+* lines and each page of the buffer is sent once, as soon as all of the old rows in that page
+* have rolled off the screen. The whole roll costs one frame of data and a command byte per
+* step, rather than a frame for every step.
 *
-* characterSpacing: The desired number of pixels between the characters stored in the buffer.
+* direction: OLED_ROLL_UP or OLED_ROLL_DOWN.
 *
-* screenOrientation: The desired orientation of the string:
-*	0 = No rotation (normal orientation).
-*	1 = 90 degrees clockwise rotation.
-*	2 = 180 degrees clockwise rotation (upside down).
-*	3 = 270 degrees clockwise rotation.
+* NOTE: 
+*	-	Keep drawing into the buffer as normal, each page is sent as it is when it rolls on.
+*	-	OLED_display_buffer() and OLED_display_buffer_async() send nothing until the roll has
+*		finished, changes to pages that have already rolled on are sent by the next one after it.
+*	-	Rows of the new frame that roll on part way through a page show the old rows that
+*		rolled off the other edge until that page is sent, like a drum turning.
+*/
+void OLED_roll_start(uint8_t direction) {
+	_wait_for_flush();
+	
+	_rollDirection = direction;
+	_rollLines = 0;
+	_rollPagesSent = 0;
+}
+
+/*
+* OLED_roll_step()
+* ----------------
+* External function to move a roll started by OLED_roll_start() on by OLED_ROLL_STEP_LINES
+* lines. Call it at a regular interval until it returns 0.
 *
-* NOTE:
-*	- No checks for valid x and y coordinates.
-*	- XBM_FONT_NUMBERS_20.h must be included
+* Return:	1 if the roll is still in progress.
+*			0 if the roll has finished, or there was no roll.
 */
-static void _xbm_font_20_to_buffer(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation) {
-	uint8_t indexNumSize = (uint8_t)strlen(string);
-	uint8_t indexNums[indexNumSize];
-	uint8_t cursorPosition = xPosition;
+uint8_t OLED_roll_step() {
+	if (_rollDirection == OLED_ROLL_NONE) {
+		return 0;
+	}
 	
-	// This loop is used to map the index of each character in the string to the corresponding entry in the font array.
-	for (uint8_t i = 0; i < indexNumSize; i++) {
-		if ((string[i] >= '0') && (string[i] <= '9')) {
-			indexNums[i] = (uint8_t)(string[i] - 48);
-		}
+	_rollLines += OLED_ROLL_STEP_LINES;
+	if (_rollLines > OLED_HEIGHT) {
+		_rollLines = OLED_HEIGHT;
 	}
 	
-	for (uint8_t i = 0; i < indexNumSize; i++) {
-		
-		if (string[i] == ' ') {
-			cursorPosition += 14;
-			continue;
+	if (_rollDirection == OLED_ROLL_UP) {
+		OLED_scroll_to(_rollLines);
+	} else {
+		OLED_scroll_to(OLED_HEIGHT - _rollLines);
+	}
+	
+	// The RAM lines that rolled off one edge are the ones shown at the other, so a page can be
+	// replaced once all of its lines have rolled off. Rolling up frees the pages from the top.
+	while ((_rollPagesSent + 1) * 8 <= _rollLines) {
+		uint8_t page = _rollPagesSent;
+		if (_rollDirection == OLED_ROLL_DOWN) {
+			page = (OLED_HEIGHT / 8) - 1 - _rollPagesSent;
 		}
 		
-		uint8_t* word = (uint8_t*)pgm_read_word(&(FONT_20[indexNums[i]]));
-		uint8_t characterWidth = pgm_read_byte(&(FONT_20_WIDTHS[indexNums[i]]));
-		uint8_t characterOffset = pgm_read_byte(&(FONT_20_Y_OFFSET[indexNums[i]]));
-		
-		OLED_draw_xbm(cursorPosition, yPosition + characterOffset, word, characterWidth, 20, screenOrientation);
-		cursorPosition += characterWidth + characterSpacing;
+		_send_span(page, 0, OLED_WIDTH);
+		_dirtyStart[page] = OLED_WIDTH;
+		_dirtyEnd[page] = 0;
+		_rollPagesSent++;
 	}
+	
+	if (_rollLines == OLED_HEIGHT) {
+		_rollDirection = OLED_ROLL_NONE;
+		return 0;
+	}
+	return 1;
 }
 
 /*
-* _xbm_font_25_to_buffer()
-* ---------------------------
-* Private function to draw a string in the buffer using an xbm font 25 pixels high and various widths. This function is
-* designed to use the font designed in XBM_FONT_NUMBERS_25.h
-*
-* string: The string to be represented in the buffer.
-*
-* xPosition:	The x-coordinate of the starting pixel of the image.
-*
-* yPosition:	The y-coordinate of the starting pixel of the image.
-*
-* characterSpacing: The desired number of pixels between the characters stored in the buffer.
+* _wait_for_flush()
+* -----------------
+* Private function to wait for an interrupt driven flush to finish. A flush stuck on the bus
+* is failed by i2c_check_timeout(), so this does not wait forever.
+*/
+static void _wait_for_flush() {
+	while (_flushBusy) {
+		#ifndef OLED_SPI_MODE
+			i2c_check_timeout();
+		#endif /* OLED_SPI_MODE */
+	}
+}
+
+#ifndef OLED_SPI_MODE
+/*
+* _flush_post_span()
+* ------------------
+* Private function to queue the address and data transactions for the span starting at
+* _flushColumn and ending at _flushSpanEnd. The data is sent straight from the buffer.
+*/
+static void _flush_post_span() {
+	_address_commands(_flushPage, _flushColumn, _flushCommands);
+	_flushData.writeData = &_oled_buffer[_flushPage][_flushColumn];
+	_flushData.writeLength = _flushSpanEnd - _flushColumn;
+	
+	#ifdef OLED_SHADOW_BUFFER
+		memcpy(&_oled_shadow[_flushPage][_flushColumn], &_oled_buffer[_flushPage][_flushColumn], _flushSpanEnd - _flushColumn);
+	#endif /* OLED_SHADOW_BUFFER */
+	
+	if (i2c_post(&_flushAddress)) {
+		_flush_failed();
+	}
+}
+
+/*
+* _flush_address_sent()
+* ---------------------
+* Private function called from the TWI interrupt once the address of a span has been set,
+* to queue the data of the span.
 *
-* screenOrientation: The desired orientation of the string:
-*	0 = No rotation (normal orientation).
-*	1 = 90 degrees clockwise rotation.
-*	2 = 180 degrees clockwise rotation (upside down).
-*	3 = 270 degrees clockwise rotation.
+* transaction: The address transaction.
+*/
+static void _flush_address_sent(i2c_transaction_t* transaction) {
+	if ((transaction->status != I2C_TRANSACTION_DONE) || i2c_post(&_flushData)) {
+		_flush_failed();
+	}
+}
+
+/*
+* _flush_data_sent()
+* ------------------
+* Private function called from the TWI interrupt once the data of a span has been sent, to
+* move on to the next span or finish the flush.
 *
-* NOTE:
-*	- No checks for valid x and y coordinates.
-*	- XBM_FONT_NUMBERS_25.h must be included
+* transaction: The data transaction.
 */
-void _xbm_font_25_to_buffer(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation) {
-	uint8_t indexNumSize = (uint8_t)strlen(string);
-	uint8_t indexNums[indexNumSize];
-	uint8_t cursorPosition = xPosition;
-	
-	// This loop is used to map the index of each character in the string to the corresponding entry in the font array.
-	for (uint8_t i = 0; i < indexNumSize; i++) {
-		if ((string[i] >= '0') && (string[i] <= '9')) {
-			indexNums[i] = (uint8_t)(string[i] - 48);
-		} else if (string[i] == ':') {
-			indexNums[i] = 10;
-		}
+static void _flush_data_sent(i2c_transaction_t* transaction) {
+	if (transaction->status != I2C_TRANSACTION_DONE) {
+		_flush_failed();
+		return;
 	}
 	
-	for (uint8_t i = 0; i < indexNumSize; i++) {
-		
-		if (string[i] == ' ') {
-			cursorPosition += 14;
-			continue;
+	_flushColumn = _flushSpanEnd;
+	if (_next_span()) {
+		_flush_post_span();
+		return;
+	}
+	_flush_finished();
+}
+
+/*
+* _flush_failed()
+* ---------------
+* Private function to give up on the frame after a NAK, lost arbitration, bus error or timeout. The
+* page being sent is marked as changed again so it is resent with the next flush.
+*/
+static void _flush_failed() {
+	_mark_dirty(_flushPage, _flushPageStart, _flushPageEnd);
+	#ifdef OLED_SHADOW_BUFFER
+		for (uint8_t column = _flushPageStart; column < _flushPageEnd; column++) {
+			_oled_shadow[_flushPage][column] = ~_oled_buffer[_flushPage][column];
 		}
-		
-		uint8_t* word = (uint8_t*)pgm_read_word(&(FONT_25[indexNums[i]]));
-		uint8_t characterWidth = pgm_read_byte(&(FONT_25_WIDTHS[indexNums[i]]));
-		uint8_t characterOffset = pgm_read_byte(&(FONT_25_Y_OFFSET[indexNums[i]]));
-		
-		OLED_draw_xbm(cursorPosition, yPosition + characterOffset, word, characterWidth, 25, screenOrientation);
-		cursorPosition += characterWidth + characterSpacing;
+	#endif /* OLED_SHADOW_BUFFER */
+	_flush_finished();
+}
+
+/*
+* _flush_finished()
+* -----------------
+* Private function called at the end of an interrupt driven flush, successful or not.
+*/
+static void _flush_finished() {
+	_flushBusy = 0;
+	
+	if (_flushCallback) {
+		_flushCallback();
+	}
+}
+#endif /* OLED_SPI_MODE */
+
+#else
+/*
+* OLED_render()
+* -------------
+* External function to draw a frame and send it to the OLED display with the page renderer.
+* The frame is built one strip of OLED_STRIP_PAGES pages at a time. For each strip the
+* buffer is cleared, 'draw' is called to draw the whole frame and the strip is sent to the
+* display. The OLED_* draw functions work as normal inside 'draw', anything that falls
+* outside the strip being rendered is clipped.
+*
+* draw: Function that draws the frame, or 0 to clear the display.
+*
+* NOTE: 
+*	-	'draw' is called (OLED_HEIGHT / 8) / OLED_STRIP_PAGES times for each frame and must
+*		draw the same frame every time, so it should not change anything it draws from.
+*	-	The whole frame is sent every time, there is no record of what has changed.
+*	-	Drawing outside of 'draw' has no effect.
+*/
+void OLED_render(void (*draw)(void)) {
+	for (_stripPage = 0; _stripPage < OLED_HEIGHT / 8; _stripPage += OLED_STRIP_PAGES) {
+		OLED_clear_buffer();
+		if (draw) {
+			draw();
+		}
+		
+		for (uint8_t page = 0; page < OLED_STRIP_PAGES; page++) {
+			_set_page_and_column(_stripPage + page, 0);
+			_send_data(_oled_buffer[page], OLED_WIDTH);
+		}
+	}
+}
+#endif /* OLED_PAGE_RENDERER */
+
+/*
+* _strip_overlaps()
+* -----------------
+* Private function to check if a range of rows reaches the part of the screen held in the
+* buffer, so drawing that can not touch it is skipped early. Without OLED_PAGE_RENDERER
+* defined the buffer holds the whole screen.
+*
+* yTop: The top y-coordinate of the range, this can be negative.
+*
+* yBottom: One past the bottom y-coordinate of the range.
+*
+* Return:	1 if any of the rows are in the buffer.
+*			0 if none of them are.
+*/
+static uint8_t _strip_overlaps(int16_t yTop, int16_t yBottom) {
+	return (yTop < (OLED_BUFFER_FIRST_PAGE + OLED_BUFFER_PAGES) * 8) && (yBottom > OLED_BUFFER_FIRST_PAGE * 8);
+}
+
+/*
+* OLED_draw_string()
+* ------------------
+* External function to draw a string on the buffer in the correct position and orientation.
+*
+* string: The string to be represented in the buffer.
+*
+* xPosition:	The x-coordinate of the starting pixel of the string.
+*
+* yPosition:	The y-coordinate of the starting pixel of the string.
+*
+* fontSize: The height of the desired font (8, 16, 20 or 25).
+*
+* characterSpacing: The desired number of pixels between the characters stored in the buffer.
+*
+* screenOrientation: The desired orientation of the screen:
+*		0 = No rotation (normal orientation).
+*		1 = 90 degrees clockwise rotation.
+*		2 = 180 degrees clockwise rotation (upside down).
+*		3 = 270 degrees clockwise rotation.
+*
+* NOTE: 
+*	- Not all characters can be represented in the buffer, only those defined in the font file.
+*	- No checks for valid x and y coordinates.
+*/
+void OLED_draw_string(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t screenOrientation) {
+	const font_t* font = _font_for_size(fontSize);
+	
+	if (font) {
+		OLED_draw_string_font(font, string, xPosition, yPosition, characterSpacing, screenOrientation);
+	}
+}
+
+/*
+* OLED_draw_string_P()
+* --------------------
+* External function to draw a string stored in PROGMEM on the buffer, so string literals do not
+* need to be copied into SRAM. eg. OLED_draw_string_P(PSTR("Set Time"), 6, 2, 16, 2, 0);
+*
+* string: The string stored in PROGMEM.
+*
+* The other parameters are the same as OLED_draw_string().
+*/
+void OLED_draw_string_P(const char* string, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t screenOrientation) {
+	const font_t* font = _font_for_size(fontSize);
+	text_cursor_t text;
+	
+	if (font) {
+		_text_start(&text, font, xPosition, yPosition, characterSpacing, screenOrientation, 1);
+		_text_put_P(&text, string);
+	}
+}
+
+/*
+* OLED_draw_string_aligned()
+* --------------------------
+* External function to draw a string on the buffer lined up against an anchor point instead of
+* starting at it. The string is measured from the font width tables first.
+*
+* string: The string to be represented in the buffer.
+*
+* xPosition:	The x-coordinate of the anchor. Like every other coordinate it is before rotation,
+*				so the screen is OLED_WIDTH wide in orientations 0 and 2 and OLED_HEIGHT wide
+*				in orientations 1 and 3.
+*
+* yPosition:	The y-coordinate of the top of the string.
+*
+* fontSize: The height of the desired font (8, 16, 20 or 25).
+*
+* characterSpacing: The desired number of pixels between the characters stored in the buffer.
+*
+* alignment: Which part of the string is placed on the anchor:
+*		OLED_ALIGN_LEFT = The left edge, the same as OLED_draw_string().
+*		OLED_ALIGN_CENTER = The middle.
+*		OLED_ALIGN_RIGHT = The right edge, the last pixel is drawn at xPosition - 1.
+*
+* screenOrientation: The desired orientation of the screen:
+*		0 = No rotation (normal orientation).
+*		1 = 90 degrees clockwise rotation.
+*		2 = 180 degrees clockwise rotation (upside down).
+*		3 = 270 degrees clockwise rotation.
+*
+* NOTE: A string that does not fit left of the anchor is clipped at the edge of the screen.
+*/
+void OLED_draw_string_aligned(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation) {
+	const font_t* font = _font_for_size(fontSize);
+	
+	if (!font) {
+		return;
+	}
+	
+	uint8_t width = _string_metrics(font, string, 0xFF, characterSpacing, 0, 0);
+	
+	OLED_draw_string_font(font, string, _aligned_start(width, xPosition, alignment), yPosition, characterSpacing, screenOrientation);
+}
+
+/*
+* OLED_printf_P()
+* ---------------
+* External function to format a string and draw it on the buffer in one go. The characters go
+* straight to the font renderer as they are formatted, there is no string buffer and avr-libc's
+* vfprintf() is not used.
+*
+* xPosition, yPosition, fontSize, characterSpacing, alignment and screenOrientation are the same
+* as OLED_draw_string_aligned().
+*
+* format: The format string stored in PROGMEM, eg. PSTR("%02u:%02u"). It can contain:
+*		%d, %i, %u	= A signed or unsigned int, %ld, %li and %lu for a long.
+*		%x, %X		= An unsigned int in upper case hex, %lx and %lX for a long.
+*		%c			= A character.
+*		%s			= A string in SRAM.
+*		%S			= A string in PROGMEM.
+*		%%			= A '%'.
+*	Numbers can have a width, eg. %4d, which is padded with spaces or with zeros after
+*	the sign for %04d. A precision on a decimal number draws it as fixed point with that
+*	many decimal places, eg. %.1d draws 235 as 23.5 and -5 as -0.5. The precision is at
+*	most 9, a larger one is drawn as 9.
+*
+* NOTE: 
+*	-	Other conversions are drawn as they are.
+*	-	A centered or right aligned string is formatted twice, once to measure it.
+*/
+void OLED_printf_P(uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation, const char* format, ...) {
+	const font_t* font = _font_for_size(fontSize);
+	text_cursor_t text;
+	va_list args;
+	
+	if (!font) {
+		return;
+	}
+	
+	if (alignment != OLED_ALIGN_LEFT) {
+		_text_start(&text, font, 0, 0, characterSpacing, screenOrientation, 0);
+		va_start(args, format);
+		_text_format(&text, format, args);
+		va_end(args);
+		xPosition = _aligned_start(text.width, xPosition, alignment);
+	}
+	
+	_text_start(&text, font, xPosition, yPosition, characterSpacing, screenOrientation, 1);
+	va_start(args, format);
+	_text_format(&text, format, args);
+	va_end(args);
+}
+
+/*
+* _aligned_start()
+* ----------------
+* Private function to find where a string has to start so it is aligned on an anchor point.
+*
+* width: The width of the string in pixels.
+*
+* xPosition: The x-coordinate of the anchor.
+*
+* alignment: OLED_ALIGN_LEFT, OLED_ALIGN_CENTER or OLED_ALIGN_RIGHT.
+*
+* Return: The x-coordinate to draw the string from, clipped at the left edge of the screen.
+*/
+static uint8_t _aligned_start(uint8_t width, uint8_t xPosition, uint8_t alignment) {
+	if (alignment == OLED_ALIGN_CENTER) {
+		width /= 2;
+	} else if (alignment != OLED_ALIGN_RIGHT) {
+		width = 0;
+	}
+	
+	if (width > xPosition) {
+		width = xPosition;
+	}
+	return xPosition - width;
+}
+
+/*
+* OLED_measure_string()
+* ---------------------
+* External function to find the size of a string without drawing it, using the font width
+* and y-offset tables.
+*
+* string: The string to be measured.
+*
+* fontSize: The height of the font (8, 16, 20 or 25).
+*
+* characterSpacing: The number of pixels between the characters, as given to OLED_draw_string().
+*
+* width: Set to the width of the string in pixels, from its first to its last drawn column.
+*
+* height: Set to the height of the string in pixels, including characters drawn lower by their
+*		y-offset.
+*
+* NOTE: Either width or height can be 0 if it is not needed. Both are set to 0 for an unknown font.
+*/
+void OLED_measure_string(char* string, uint8_t fontSize, uint8_t characterSpacing, uint8_t* width, uint8_t* height) {
+	const font_t* font = _font_for_size(fontSize);
+	uint8_t stringWidth = 0;
+	uint8_t stringHeight = 0;
+	
+	if (font) {
+		stringWidth = _string_metrics(font, string, 0xFF, characterSpacing, 0, &stringHeight);
+	}
+	
+	if (width) {
+		*width = stringWidth;
+	}
+	if (height) {
+		*height = stringHeight;
+	}
+}
+
+/*
+* OLED_measure_string_P()
+* -----------------------
+* External function to find the size of a string stored in PROGMEM without drawing it.
+*
+* string: The string stored in PROGMEM.
+*
+* The other parameters are the same as OLED_measure_string().
+*/
+void OLED_measure_string_P(const char* string, uint8_t fontSize, uint8_t characterSpacing, uint8_t* width, uint8_t* height) {
+	const font_t* font = _font_for_size(fontSize);
+	text_cursor_t text;
+	
+	if (!font) {
+		OLED_measure_string("", fontSize, characterSpacing, width, height);
+		return;
+	}
+	
+	_text_start(&text, font, 0, 0, characterSpacing, 0, 0);
+	_text_put_P(&text, string);
+	
+	if (width) {
+		*width = text.width;
+	}
+	if (height) {
+		*height = text.lowest;
+	}
+}
+
+/*
+* OLED_measure_printf_P()
+* -----------------------
+* External function to find the size of a string formatted as OLED_printf_P() would draw it,
+* without drawing it.
+*
+* fontSize, characterSpacing, width and height are the same as OLED_measure_string().
+*
+* format: The format string stored in PROGMEM, the same as OLED_printf_P().
+*/
+void OLED_measure_printf_P(uint8_t fontSize, uint8_t characterSpacing, uint8_t* width, uint8_t* height, const char* format, ...) {
+	const font_t* font = _font_for_size(fontSize);
+	text_cursor_t text;
+	va_list args;
+	
+	if (!font) {
+		OLED_measure_string("", fontSize, characterSpacing, width, height);
+		return;
+	}
+	
+	_text_start(&text, font, 0, 0, characterSpacing, 0, 0);
+	va_start(args, format);
+	_text_format(&text, format, args);
+	va_end(args);
+	
+	if (width) {
+		*width = text.width;
+	}
+	if (height) {
+		*height = text.lowest;
+	}
+}
+
+/*
+* OLED_measure_character()
+* ------------------------
+* External function to find where one character of a string is drawn, relative to the start
+* of the string, without drawing it. Used to place highlights and cursors on a character.
+*
+* string: The string containing the character.
+*
+* index: The index of the character in the string.
+*
+* fontSize: The height of the font (8, 16, 20 or 25).
+*
+* characterSpacing: The number of pixels between the characters, as given to OLED_draw_string().
+*
+* xOffset: Set to the number of pixels from the start of the string to the left edge of the character.
+*
+* width: Set to the width of the character in pixels.
+*
+* NOTE: Either xOffset or width can be 0 if it is not needed.
+*/
+void OLED_measure_character(char* string, uint8_t index, uint8_t fontSize, uint8_t characterSpacing, uint8_t* xOffset, uint8_t* width) {
+	const font_t* font = _font_for_size(fontSize);
+	uint8_t characterStart = 0;
+	uint8_t characterEnd = 0;
+	
+	if (font) {
+		_string_metrics(font, string, index, characterSpacing, &characterStart, 0);
+		characterEnd = _string_metrics(font, string, index + 1, characterSpacing, 0, 0);
+	}
+	
+	if (xOffset) {
+		*xOffset = characterStart;
+	}
+	if (width) {
+		*width = (characterEnd > characterStart) ? characterEnd - characterStart : 0;
+	}
+}
+
+/*
+* _font_for_size()
+* ----------------
+* Private function to find the font descriptor used by OLED_draw_string() for a font size.
+*
+* fontSize: The height of the font.
+*
+* Return:	The descriptor of the font stored in PROGMEM.
+*			0 if there is no font of that height.
+*/
+static const font_t* _font_for_size(uint8_t fontSize) {
+	for (uint8_t i = 0; i < sizeof(_fonts) / sizeof(_fonts[0]); i++) {
+		const font_t* font = (const font_t*)pgm_read_word(&(_fonts[i]));
+		
+		if (pgm_read_byte(&(font->height)) == fontSize) {
+			return font;
+		}
+	}
+	return 0;
+}
+
+/*
+* _string_metrics()
+* -----------------
+* Private function to walk the first characters of a string the same way OLED_draw_string_font()
+* does, without drawing them.
+*
+* font: The descriptor of the font stored in PROGMEM.
+*
+* string: The string to be measured.
+*
+* numOfCharacters: The number of characters to measure, 0xFF for the whole string.
+*
+* characterSpacing: The number of pixels between the characters.
+*
+* cursor: If not 0, set to where the next character would be drawn, relative to the start.
+*
+* height: If not 0, set to the height of the measured characters including their y-offsets.
+*
+* Return:	The width of the measured characters in pixels.
+*/
+static uint8_t _string_metrics(const font_t* font, char* string, uint8_t numOfCharacters, uint8_t characterSpacing, uint8_t* cursor, uint8_t* height) {
+	text_cursor_t text;
+	
+	_text_start(&text, font, 0, 0, characterSpacing, 0, 0);
+	for (; (*string != '\0') && numOfCharacters; string++, numOfCharacters--) {
+		_text_put(&text, (uint8_t)*string);
+	}
+	
+	if (cursor) {
+		*cursor = text.cursor;
+	}
+	if (height) {
+		*height = text.lowest;
+	}
+	return text.width;
+}
+
+/*
+* OLED_draw_string_font()
+* -----------------------
+* External function to draw a string on the buffer with the font described by a font_t
+* descriptor, in the correct position and orientation.
+*
+* font: The descriptor of the font stored in PROGMEM, eg. &FONT_16_DESCRIPTOR.
+*
+* string: The string to be represented in the buffer.
+*
+* xPosition:	The x-coordinate of the starting pixel of the string.
+*
+* yPosition:	The y-coordinate of the starting pixel of the string.
+*
+* characterSpacing: The desired number of pixels between the characters stored in the buffer.
+*
+* screenOrientation: The desired orientation of the screen:
+*		0 = No rotation (normal orientation).
+*		1 = 90 degrees clockwise rotation.
+*		2 = 180 degrees clockwise rotation (upside down).
+*		3 = 270 degrees clockwise rotation.
+*
+* NOTE: 
+*	- Characters that are not in the font are skipped.
+*	- No checks for valid x and y coordinates.
+*/
+void OLED_draw_string_font(const font_t* font, char* string, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation) {
+	text_cursor_t text;
+	
+	_text_start(&text, font, xPosition, yPosition, characterSpacing, screenOrientation, 1);
+	for (; *string != '\0'; string++) {
+		_text_put(&text, (uint8_t)*string);
+	}
+}
+
+/*
+* _text_start()
+* -------------
+* Private function to set up a text cursor at the start of a string, so characters can be
+* drawn or measured one at a time with _text_put().
+*
+* text: The cursor to set up.
+*
+* font: The descriptor of the font stored in PROGMEM.
+*
+* xPosition, yPosition, characterSpacing and screenOrientation are the same as OLED_draw_string_font().
+*
+* draw: 1 to draw the characters, 0 to only measure them.
+*/
+static void _text_start(text_cursor_t* text, const font_t* font, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation, uint8_t draw) {
+	text->font = font;
+	text->xStart = xPosition;
+	text->yPosition = yPosition;
+	text->spacing = characterSpacing;
+	text->orientation = screenOrientation;
+	text->draw = draw;
+	text->cursor = 0;
+	text->width = 0;
+	text->lowest = 0;
+}
+
+/*
+* _text_put()
+* -----------
+* Private function to draw or measure the next character of a string and move the cursor past it.
+*
+* text: The cursor set up by _text_start().
+*
+* character: The character.
+*
+* NOTE: Characters that are not in the font are skipped.
+*/
+static void _text_put(text_cursor_t* text, uint8_t character) {
+	const font_t* font = text->font;
+	
+	if (character == ' ') {
+		text->cursor += pgm_read_byte(&(font->spaceAdvance));
+		text->width = text->cursor;
+		return;
+	}
+	
+	uint8_t index = _glyph_index(font, character);
+	if (index == FONT_NO_GLYPH) {
+		return;
+	}
+	
+	const uint8_t* widths = (const uint8_t*)pgm_read_word(&(font->widths));
+	const uint8_t* yOffsets = (const uint8_t*)pgm_read_word(&(font->yOffsets));
+	uint8_t height = pgm_read_byte(&(font->height));
+	uint8_t characterWidth = pgm_read_byte(&(widths[index]));
+	uint8_t characterOffset = pgm_read_byte(&(yOffsets[index]));
+	uint8_t xPosition = text->xStart + text->cursor;
+	uint8_t yPosition = text->yPosition + characterOffset;
+	
+	if (characterOffset + height > text->lowest) {
+		text->lowest = characterOffset + height;
+	}
+	text->width = text->cursor + characterWidth;
+	text->cursor = text->width + text->spacing;
+	
+	if (!text->draw) {
+		return;
+	}
+	
+	#ifdef OLED_PRE_ROTATED_FONTS
+		const uint8_t* const* rotated = (const uint8_t* const*)pgm_read_word(&(font->rotated));
+		const uint16_t* const* rotatedOffsets = (const uint16_t* const*)pgm_read_word(&(font->rotatedOffsets));
+		
+		if (rotated && _draw_pre_rotated(rotated, rotatedOffsets, index, xPosition, yPosition, characterWidth, height, text->orientation)) {
+			return;
+		}
+	#endif /* OLED_PRE_ROTATED_FONTS */
+	
+	#ifdef OLED_PACKED_FONTS
+		const uint8_t* packed = (const uint8_t*)pgm_read_word(&(font->packed));
+		
+		if (packed) {
+			const uint16_t* packedOffsets = (const uint16_t*)pgm_read_word(&(font->packedOffsets));
+			uint16_t offset = pgm_read_word(&(packedOffsets[index]));
+			uint8_t encoding = (offset & FONT_PACKED_RLE) ? OLED_PACKED_RLE : OLED_PACKED_BITS;
+			
+			_draw_packed_pixels(&packed[offset & ~FONT_PACKED_RLE], encoding, xPosition, yPosition, characterWidth, height, text->orientation);
+			return;
+		}
+	#endif /* OLED_PACKED_FONTS */
+	
+	const uint8_t* const* glyphs = (const uint8_t* const*)pgm_read_word(&(font->glyphs));
+	if (!glyphs) {
+		// Only kept pre-rotated, see OLED_NO_FALLBACK_FONT_x.
+		return;
+	}
+	const uint8_t* glyph = (const uint8_t*)pgm_read_word(&(glyphs[index]));
+	OLED_draw_xbm(xPosition, yPosition, glyph, characterWidth, height, text->orientation);
+}
+
+/*
+* _text_put_P()
+* -------------
+* Private function to draw or measure a string stored in PROGMEM with a text cursor.
+*
+* text: The cursor set up by _text_start().
+*
+* string: The string stored in PROGMEM.
+*/
+static void _text_put_P(text_cursor_t* text, const char* string) {
+	uint8_t character;
+	
+	while ((character = pgm_read_byte(string++)) != '\0') {
+		_text_put(text, character);
+	}
+}
+
+/*
+* _text_format()
+* --------------
+* Private function to draw or measure a format string for OLED_printf_P() with a text cursor.
+*
+* text: The cursor set up by _text_start().
+*
+* format: The format string stored in PROGMEM.
+*
+* args: The values for the conversions in the format string.
+*/
+static void _text_format(text_cursor_t* text, const char* format, va_list args) {
+	uint8_t character;
+	
+	while ((character = pgm_read_byte(format++)) != '\0') {
+		if (character != '%') {
+			_text_put(text, character);
+			continue;
+		}
+		
+		uint8_t zeroPad = 0;
+		uint8_t width = 0;
+		uint8_t decimals = 0;
+		uint8_t isLong = 0;
+		
+		character = pgm_read_byte(format++);
+		if (character == '0') {
+			zeroPad = 1;
+			character = pgm_read_byte(format++);
+		}
+		while ((character >= '0') && (character <= '9')) {
+			width = (width * 10) + (character - '0');
+			character = pgm_read_byte(format++);
+		}
+		if (character == '.') {
+			character = pgm_read_byte(format++);
+			while ((character >= '0') && (character <= '9')) {
+				decimals = (decimals * 10) + (character - '0');
+				character = pgm_read_byte(format++);
+			}
+		}
+		if (character == 'l') {
+			isLong = 1;
+			character = pgm_read_byte(format++);
+		}
+		
+		switch (character) {
+			case 'd':
+			case 'i': {
+				int32_t value = isLong ? va_arg(args, long) : va_arg(args, int);
+				uint8_t negative = (value < 0);
+				
+				_text_number(text, negative ? -(uint32_t)value : (uint32_t)value, negative, width, zeroPad, decimals, 0);
+				break;
+			}
+			
+			case 'u':
+			case 'x':
+			case 'X': {
+				uint32_t value = isLong ? va_arg(args, unsigned long) : va_arg(args, unsigned int);
+				
+				_text_number(text, value, 0, width, zeroPad, (character == 'u') ? decimals : 0, character != 'u');
+				break;
+			}
+			
+			case 'c':
+				_text_put(text, (uint8_t)va_arg(args, int));
+				break;
+			
+			case 's': {
+				char* string = va_arg(args, char*);
+				
+				for (; *string != '\0'; string++) {
+					_text_put(text, (uint8_t)*string);
+				}
+				break;
+			}
+			
+			case 'S':
+				_text_put_P(text, va_arg(args, const char*));
+				break;
+			
+			case '%':
+				_text_put(text, '%');
+				break;
+			
+			case '\0':
+				// The format string ended part way through a conversion
+				return;
+			
+			default:
+				_text_put(text, '%');
+				_text_put(text, character);
+				break;
+		}
+	}
+}
+
+/*
+* _text_number()
+* --------------
+* Private function to draw or measure a number for OLED_printf_P() with a text cursor. Decimal
+* digits are found by subtracting powers of ten, so no division is needed.
+*
+* text: The cursor set up by _text_start().
+*
+* value: The size of the number.
+*
+* negative: 1 to draw a '-' before the number.
+*
+* width: The least number of characters to draw, padded on the left.
+*
+* zeroPad: 1 to pad with zeros after the sign, 0 to pad with spaces before it.
+*
+* decimals: The number of digits after a decimal point, 0 for no decimal point. More than 9
+* is drawn as 9, as a 32-bit number has at most 10 digits.
+*
+* hex: 1 to draw the number in upper case hex, decimals is ignored.
+*/
+static void _text_number(text_cursor_t* text, uint32_t value, uint8_t negative, uint8_t width, uint8_t zeroPad, uint8_t decimals, uint8_t hex) {
+	uint8_t digits = 1;
+	
+	if (hex) {
+		decimals = 0;
+		while ((digits < 8) && (value >> (4 * digits))) {
+			digits++;
+		}
+	} else {
+		// _powersOfTen[] ends at 10^9, so the digits of a precision over 9 would read past it.
+		if (decimals > 9) {
+			decimals = 9;
+		}
+		while ((digits < 10) && (value >= pgm_read_dword(&(_powersOfTen[digits])))) {
+			digits++;
+		}
+		if (digits <= decimals) {
+			digits = decimals + 1;
+		}
+	}
+	
+	uint8_t length = digits + negative + (decimals ? 1 : 0);
+	
+	if (!zeroPad) {
+		for (; width > length; width--) {
+			_text_put(text, ' ');
+		}
+	}
+	if (negative) {
+		_text_put(text, '-');
+	}
+	for (; width > length; width--) {
+		_text_put(text, '0');
+	}
+	
+	while (digits--) {
+		uint8_t digit = 0;
+		
+		if (hex) {
+			digit = (value >> (4 * digits)) & 0x0F;
+			_text_put(text, (digit < 10) ? ('0' + digit) : ('A' + digit - 10));
+			continue;
+		}
+		
+		uint32_t power = pgm_read_dword(&(_powersOfTen[digits]));
+		while (value >= power) {
+			value -= power;
+			digit++;
+		}
+		_text_put(text, '0' + digit);
+		
+		if (decimals && (digits == decimals)) {
+			_text_put(text, '.');
+		}
+	}
+}
+
+/*
+* _glyph_index()
+* --------------
+* Private function to find the glyph of a character in a font.
+*
+* font: The descriptor of the font stored in PROGMEM.
+*
+* character: The character to find.
+*
+* Return:	The index of the glyph in the font's glyph, width and y-offset tables.
+*			FONT_NO_GLYPH if the font does not have the character.
+*/
+static uint8_t _glyph_index(const font_t* font, uint8_t character) {
+	uint8_t firstChar = pgm_read_byte(&(font->firstChar));
+	
+	if ((character >= firstChar) && (character <= pgm_read_byte(&(font->lastChar)))) {
+		const uint8_t* remap = (const uint8_t*)pgm_read_word(&(font->remap));
+		
+		if (remap) {
+			return pgm_read_byte(&(remap[character - firstChar]));
+		}
+		return character - firstChar;
+	}
+	
+	uint8_t firstSymbol = pgm_read_byte(&(font->firstSymbol));
+	if (firstSymbol && (character >= firstSymbol) && (character <= pgm_read_byte(&(font->lastSymbol)))) {
+		return pgm_read_byte(&(font->symbolIndex)) + (character - firstSymbol);
+	}
+	return FONT_NO_GLYPH;
+}
+
+/*
+* OLED_set_pixel()
+* ----------------
+* External function that sets a single pixel on the display buffer at the specified position.
+*
+* xCoordinate:	The x-coordinate of the pixel.
+*
+* yCoordinate:	The y-coordinate of the pixel.
+*
+* NOTE: 
+*	-	Pixels outside of the screen are not drawn.
+*	-	The coordinates are on the canvas, see OLED_set_canvas().
+*/
+void OLED_set_pixel(uint8_t xCoordinate, uint8_t yCoordinate) {
+	_canvas_pixel(xCoordinate, yCoordinate, OLED_DRAW_SET);
+}
+
+/*
+* OLED_draw_xbm()
+* ---------------
+* External function to draw an xbm image on the display buffer in the correct position.
+*
+* xPosition: The x-coordinate of the starting pixel of the image.
+*
+* yPositioin: The y-coordinate of the starting pixel of the image.
+*
+* xbm: The xbm image data stored as a PROGMEM array.
+*
+* width: The width of the xbm image.
+*
+* height: The height of the xbm image.
+*
+* screenOrientation: The desired orientation of the image:
+*	0 = No rotation (normal orientation).
+*	1 = 90 degrees clockwise rotation.
+*	2 = 180 degrees clockwise rotation (upside down).
+*	3 = 270 degrees clockwise rotation.
+*
+* NOTE:	
+*	-	The correct width and height must be given or the image will not be processed correctly. Also the xbm image must be
+*		stored as a PROGMEM array.
+*	-	Pixels that fall outside of the screen are not drawn.
+*/
+void OLED_draw_xbm(uint8_t xPosition, uint8_t yPosition, const uint8_t xbm[], uint8_t width, uint8_t height, uint8_t screenOrientation) {
+	// The number of bytes used horizontally in each row of the image. Rows are padded to a whole byte.
+	uint8_t rowBytes = (width + 7) / 8;
+	
+	// Mask for the last byte of each row so the padding bits are not drawn.
+	uint8_t lastByteMask = 0xFF;
+	if ((width % 8) != 0) {
+		lastByteMask = (1 << (width % 8)) - 1;
+	}
+	
+	// Rows of the screen the image can reach, rounded out to the whole bytes that are drawn.
+	int16_t rowBlocks = ((height + 7) / 8) * 8;
+	int16_t yTop = yPosition;
+	int16_t yBottom = yPosition + rowBlocks;
+	if (screenOrientation == 1) {
+		yTop = xPosition;
+		yBottom = xPosition + rowBytes * 8;
+	} else if (screenOrientation == 2) {
+		yTop = OLED_HEIGHT - (int16_t)yPosition - rowBlocks;
+		yBottom = OLED_HEIGHT - (int16_t)yPosition;
+	} else if (screenOrientation == 3) {
+		yTop = OLED_HEIGHT - (int16_t)xPosition - rowBytes * 8;
+		yBottom = OLED_HEIGHT - (int16_t)xPosition;
+	}
+	if (!_strip_overlaps(yTop, yBottom)) {
+		return;
+	}
+	
+	if (screenOrientation == 1 || screenOrientation == 3) {
+		// Each row of the image becomes a column on the screen, so each image byte is already 8 vertical pixels.
+		for (uint8_t row = 0; row < height; row++) {
+			const uint8_t* rowData = &xbm[(uint16_t)row * rowBytes];
+			
+			for (uint8_t byteIndex = 0; byteIndex < rowBytes; byteIndex++) {
+				uint8_t bits = pgm_read_byte(&(rowData[byteIndex]));
+				if (byteIndex == rowBytes - 1) {
+					bits &= lastByteMask;
+				}
+				
+				if (screenOrientation == 1) {
+					// 90 degrees
+					_or_column_byte(127 - (int16_t)(yPosition + row), xPosition + byteIndex * 8, bits);
+				} else {
+					// 270 degrees
+					_or_column_byte(yPosition + row, 56 - (int16_t)(xPosition + byteIndex * 8), _reverse_byte(bits));
+				}
+			}
+		}
+		
+	} else if (screenOrientation == 0 || screenOrientation == 2) {
+		// Blocks of 8 rows by 8 pixels are transposed into 8 column bytes.
+		uint8_t columns[8];
+		
+		for (uint16_t rowBlock = 0; rowBlock < height; rowBlock += 8) {
+			uint8_t blockRows = height - rowBlock;
+			if (blockRows > 8) {
+				blockRows = 8;
+			}
+			
+			for (uint8_t byteIndex = 0; byteIndex < rowBytes; byteIndex++) {
+				uint8_t mask = (byteIndex == rowBytes - 1) ? lastByteMask : 0xFF;
+				memset(columns, 0, sizeof(columns));
+				
+				for (uint8_t k = 0; k < blockRows; k++) {
+					uint8_t bits = pgm_read_byte(&(xbm[(rowBlock + k) * rowBytes + byteIndex])) & mask;
+					// Upside down images have their rows in the opposite order in each column byte.
+					uint8_t rowBit = (screenOrientation == 0) ? (1 << k) : (0x80 >> k);
+					
+					for (uint8_t j = 0; bits; j++) {
+						if (bits & 0x01) {
+							columns[j] |= rowBit;
+						}
+						bits >>= 1;
+					}
+				}
+				
+				for (uint8_t j = 0; j < 8; j++) {
+					int16_t xTarget = xPosition + byteIndex * 8 + j;
+					
+					if (screenOrientation == 0) {
+						// Normal orientation.
+						_or_column_byte(xTarget, yPosition + rowBlock, columns[j]);
+					} else {
+						// 180 degrees
+						_or_column_byte(127 - xTarget, 56 - (int16_t)(yPosition + rowBlock), columns[j]);
+					}
+				}
+			}
+		}
+	}
+}
+
+/*
+* OLED_draw_packed()
+* ------------------
+* External function to draw an image compressed by tools/pack_assets.py on the display buffer
+* in the correct position, eg. the images in XBM_symbols/XBM_SYMBOLS_PACKED.c.
+*
+* xPosition: The x-coordinate of the starting pixel of the image.
+*
+* yPosition: The y-coordinate of the starting pixel of the image.
+*
+* packed: The packed image stored as a PROGMEM array, starting with its width, height and
+* encoding.
+*
+* screenOrientation: The desired orientation of the image:
+*	0 = No rotation (normal orientation).
+*	1 = 90 degrees clockwise rotation.
+*	2 = 180 degrees clockwise rotation (upside down).
+*	3 = 270 degrees clockwise rotation.
+*
+* NOTE: Pixels that fall outside of the screen are not drawn.
+*/
+void OLED_draw_packed(uint8_t xPosition, uint8_t yPosition, const uint8_t packed[], uint8_t screenOrientation) {
+	uint8_t width = pgm_read_byte(&(packed[0]));
+	uint8_t height = pgm_read_byte(&(packed[1]));
+	uint8_t encoding = pgm_read_byte(&(packed[2]));
+	
+	_draw_packed_pixels(&packed[3], encoding, xPosition, yPosition, width, height, screenOrientation);
+}
+
+/*
+* _draw_packed_pixels()
+* ---------------------
+* Private function to decode packed pixels straight into the buffer. The pixels are stored
+* column by column, each column from top to bottom, as 1 bit per pixel (OLED_PACKED_BITS) or
+* as 4-bit run lengths (OLED_PACKED_RLE), see tools/pack_assets.py. The set pixels of each
+* column are collected into a run and drawn with one _fill_region() call, so nothing is
+* unpacked into RAM whatever the orientation.
+*
+* data: The packed pixels stored in PROGMEM.
+*
+* encoding: OLED_PACKED_BITS or OLED_PACKED_RLE.
+*
+* xPosition: The x-coordinate of the image before rotation, the same as OLED_draw_xbm().
+*
+* yPosition: The y-coordinate of the image before rotation, the same as OLED_draw_xbm().
+*
+* width: The width of the image.
+*
+* height: The height of the image.
+*
+* screenOrientation: The desired orientation of the image (0 - 3).
+*/
+static void _draw_packed_pixels(const uint8_t* data, uint8_t encoding, uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t screenOrientation) {
+	// Rows of the screen the image covers after rotation.
+	int16_t yTop = yPosition;
+	uint8_t rows = height;
+	if (screenOrientation == 1) {
+		yTop = xPosition;
+		rows = width;
+	} else if (screenOrientation == 2) {
+		yTop = OLED_HEIGHT - (int16_t)yPosition - height;
+	} else if (screenOrientation == 3) {
+		yTop = OLED_HEIGHT - (int16_t)xPosition - width;
+		rows = width;
+	}
+	if (screenOrientation > 3 || !_strip_overlaps(yTop, yTop + rows)) {
+		return;
+	}
+	
+	uint8_t column = 0;
+	uint8_t row = 0;
+	uint8_t spanStart = 0;		// Set pixels from spanStart to row are waiting to be drawn
+	uint8_t colour = 0;			// Colour of the next run, RLE only
+	uint8_t byte = 0;
+	uint8_t codesLeft = 0;		// Bits or nibbles of byte still to be read
+	
+	while (column < width) {
+		if (!codesLeft) {
+			byte = pgm_read_byte(data++);
+			codesLeft = (encoding == OLED_PACKED_RLE) ? 2 : 8;
+		}
+		codesLeft--;
+		
+		uint8_t length;
+		uint8_t runColour;
+		if (encoding == OLED_PACKED_RLE) {
+			length = byte & 0x0F;
+			byte >>= 4;
+			runColour = colour;
+			if (length != 15) {
+				colour ^= 1;
+			}
+		} else {
+			length = 1;
+			runColour = byte & 0x01;
+			byte >>= 1;
+		}
+		
+		// A run can carry on into the next columns.
+		while (length) {
+			uint8_t pixels = height - row;
+			if (pixels > length) {
+				pixels = length;
+			}
+			length -= pixels;
+			
+			if (!runColour) {
+				if (row > spanStart) {
+					_draw_packed_span(xPosition, yPosition, column, spanStart, row, screenOrientation);
+				}
+				spanStart = row + pixels;
+			}
+			row += pixels;
+			
+			if (row == height) {
+				if (row > spanStart) {
+					_draw_packed_span(xPosition, yPosition, column, spanStart, row, screenOrientation);
+				}
+				column++;
+				row = 0;
+				spanStart = 0;
+			}
+		}
+	}
+}
+
+/*
+* _draw_packed_span()
+* -------------------
+* Private function to set a run of pixels in one column of a packed image, rotated the same
+* way as OLED_draw_xbm().
+*
+* xPosition: The x-coordinate of the image before rotation.
+*
+* yPosition: The y-coordinate of the image before rotation.
+*
+* column: The column of the image the pixels are in.
+*
+* rowStart: The first row of the image in the run.
+*
+* rowEnd: One past the last row of the image in the run.
+*
+* screenOrientation: The desired orientation of the image (0 - 3).
+*/
+static void _draw_packed_span(uint8_t xPosition, uint8_t yPosition, uint8_t column, uint8_t rowStart, uint8_t rowEnd, uint8_t screenOrientation) {
+	int16_t x = (int16_t)xPosition + column;
+	
+	if (screenOrientation == 0) {
+		// Normal orientation.
+		_fill_region(x, x + 1, yPosition + rowStart, yPosition + rowEnd, OLED_DRAW_SET);
+	} else if (screenOrientation == 1) {
+		// 90 degrees, the column becomes a row.
+		_fill_region(OLED_WIDTH - (int16_t)yPosition - rowEnd, OLED_WIDTH - (int16_t)yPosition - rowStart, x, x + 1, OLED_DRAW_SET);
+	} else if (screenOrientation == 2) {
+		// 180 degrees
+		_fill_region(OLED_WIDTH - x - 1, OLED_WIDTH - x, OLED_HEIGHT - (int16_t)yPosition - rowEnd, OLED_HEIGHT - (int16_t)yPosition - rowStart, OLED_DRAW_SET);
+	} else {
+		// 270 degrees, the column becomes a row.
+		_fill_region(yPosition + rowStart, yPosition + rowEnd, OLED_HEIGHT - x - 1, OLED_HEIGHT - x, OLED_DRAW_SET);
+	}
+}
+
+/*
+* _or_column_byte()
+* -----------------
+* Private function to set 8 vertical pixels on the display buffer. The pixels can start part
+* way through a page, in which case they are split over two pages. Pixels outside of the screen
+* are not drawn.
+*
+* xPosition: The x-coordinate of the column.
+*
+* yTop: The y-coordinate of the pixel for bit 0, this can be negative.
+*
+* bits: The pixels to be set, bit 0 is the top pixel.
+*/
+static void _or_column_byte(int16_t xPosition, int16_t yTop, uint8_t bits) {
+	if (!bits || xPosition < 0 || xPosition >= OLED_WIDTH || yTop <= -8 || yTop >= OLED_HEIGHT) {
+		return;
+	}
+	
+	if (yTop < 0) {
+		bits >>= -yTop;
+		yTop = 0;
+	}
+	
+	uint8_t column = xPosition;
+	uint8_t page = yTop / 8;
+	uint8_t shift = yTop % 8;
+	
+	_draw_byte(page, column, bits << shift, OLED_DRAW_SET);
+	if (shift && page < (OLED_HEIGHT / 8) - 1) {
+		_draw_byte(page + 1, column, bits >> (8 - shift), OLED_DRAW_SET);
+	}
+}
+
+/*
+* _draw_byte()
+* ------------
+* Private function to set, clear or invert pixels of a single byte in the display buffer,
+* marking the column as changed only if the byte actually changes. Pixels outside of the
+* clip region are not drawn.
+*
+* page: The page of the byte.
+*
+* column: The column of the byte.
+*
+* mask: The pixels to be drawn.
+*
+* drawMode: OLED_DRAW_SET, OLED_DRAW_CLEAR or OLED_DRAW_XOR.
+*/
+static void _draw_byte(uint8_t page, uint8_t column, uint8_t mask, uint8_t drawMode) {
+	uint8_t bufferPage = page - OLED_BUFFER_FIRST_PAGE;
+	
+	// Pages outside of the strip being rendered wrap around to a large bufferPage.
+	if ((bufferPage >= OLED_BUFFER_PAGES) || (column < _clipLeft) || (column >= _clipRight)) {
+		return;
+	}
+	mask &= _clipMasks[page];
+	
+	uint8_t current = _oled_buffer[bufferPage][column];
+	uint8_t value;
+	
+	if (drawMode == OLED_DRAW_CLEAR) {
+		value = current & ~mask;
+	} else if (drawMode == OLED_DRAW_XOR) {
+		value = current ^ mask;
+	} else {
+		value = current | mask;
+	}
+	
+	if (value != current) {
+		_oled_buffer[bufferPage][column] = value;
+		_mark_dirty(page, column, column + 1);
+	}
+}
+
+/*
+* _draw_pixel()
+* -------------
+* Private function to set, clear or invert a single pixel. Pixels outside of the screen are
+* not drawn.
+*
+* xCoordinate: The x-coordinate of the pixel, this can be negative.
+*
+* yCoordinate: The y-coordinate of the pixel, this can be negative.
+*
+* drawMode: OLED_DRAW_SET, OLED_DRAW_CLEAR or OLED_DRAW_XOR.
+*/
+static void _draw_pixel(int16_t xCoordinate, int16_t yCoordinate, uint8_t drawMode) {
+	if ((xCoordinate < 0) || (xCoordinate >= OLED_WIDTH) || (yCoordinate < 0) || (yCoordinate >= OLED_HEIGHT)) {
+		return;
+	}
+	_draw_byte(yCoordinate / 8, xCoordinate, 1 << (yCoordinate % 8), drawMode);
+}
+
+/*
+* _fill_region()
+* --------------
+* Private function to set, clear or invert every pixel in a rectangular region. This is the
+* span fill behind the lines, rectangles, circles and inversions. Each page of the region is
+* drawn a whole byte at a time with a mask of the rows that fall in it, and the columns that
+* changed are marked once per page.
+*
+* xLeft: The left x-coordinate of the region.
+*
+* xRight: One past the right x-coordinate of the region.
+*
+* yTop: The top y-coordinate of the region.
+*
+* yBottom: One past the bottom y-coordinate of the region.
+*
+* drawMode: OLED_DRAW_SET, OLED_DRAW_CLEAR or OLED_DRAW_XOR.
+*
+* NOTE: The coordinates can be off the screen or negative, anything outside of the screen or
+* the clip region is not drawn.
+*/
+static void _fill_region(int16_t xLeft, int16_t xRight, int16_t yTop, int16_t yBottom, uint8_t drawMode) {
+	if (!_clip_region(&xLeft, &xRight, &yTop, &yBottom)) {
+		return;
+	}
+	
+	uint8_t firstPage = yTop / 8;
+	uint8_t lastPage = (yBottom - 1) / 8;
+	
+	for (uint8_t page = firstPage; page <= lastPage; page++) {
+		uint8_t mask = _page_mask(page, yTop, yBottom);
+		
+		// value = ((current | setBits) & ~clearBits) ^ xorBits, so there is no branch per column.
+		uint8_t setBits = (drawMode == OLED_DRAW_SET) ? mask : 0x00;
+		uint8_t clearBits = (drawMode == OLED_DRAW_CLEAR) ? mask : 0x00;
+		uint8_t xorBits = (drawMode == OLED_DRAW_XOR) ? mask : 0x00;
+		uint8_t changedStart = OLED_WIDTH;
+		uint8_t changedEnd = 0;
+		
+		uint8_t* row = _oled_buffer[page - OLED_BUFFER_FIRST_PAGE];
+		
+		for (uint8_t column = xLeft; column < xRight; column++) {
+			uint8_t current = row[column];
+			uint8_t value = ((current | setBits) & ~clearBits) ^ xorBits;
+			
+			if (value != current) {
+				row[column] = value;
+				if (changedStart == OLED_WIDTH) {
+					changedStart = column;
+				}
+				changedEnd = column + 1;
+			}
+		}
+		_mark_dirty(page, changedStart, changedEnd);
+	}
+}
+
+/*
+* _clip_region()
+* --------------
+* Private function to cut a rectangular region down to the part that can be drawn, inside
+* the clip region and, with OLED_PAGE_RENDERER defined, the strip being rendered.
+*
+* xLeft, xRight, yTop, yBottom: The region, the right and bottom are one past it. Changed
+* to the part of the region that can be drawn.
+*
+* Return:	1 if some of the region can be drawn.
+*			0 if none of it can.
+*/
+static uint8_t _clip_region(int16_t* xLeft, int16_t* xRight, int16_t* yTop, int16_t* yBottom) {
+	int16_t yMin = OLED_BUFFER_FIRST_PAGE * 8;
+	int16_t yMax = (OLED_BUFFER_FIRST_PAGE + OLED_BUFFER_PAGES) * 8;
+	
+	if (yMin < _clipTop) {
+		yMin = _clipTop;
+	}
+	if (yMax > _clipBottom) {
+		yMax = _clipBottom;
+	}
+	
+	if (*xLeft < _clipLeft) {
+		*xLeft = _clipLeft;
+	}
+	if (*yTop < yMin) {
+		*yTop = yMin;
+	}
+	if (*xRight > _clipRight) {
+		*xRight = _clipRight;
+	}
+	if (*yBottom > yMax) {
+		*yBottom = yMax;
+	}
+	return (*xLeft < *xRight) && (*yTop < *yBottom);
+}
+
+/*
+* _page_mask()
+* ------------
+* Private function to find the rows of a region that fall in one page.
+*
+* page: A page between the first and last page of the region.
+*
+* yTop: The top y-coordinate of the region.
+*
+* yBottom: One past the bottom y-coordinate of the region.
+*
+* Return: The rows as the bits of a buffer byte.
+*/
+static uint8_t _page_mask(uint8_t page, int16_t yTop, int16_t yBottom) {
+	uint8_t mask = 0xFF;
+	
+	// Only the rows of the region in the first and last pages.
+	if (page == yTop / 8) {
+		mask &= (uint8_t)(0xFF << (yTop % 8));
+	}
+	if (page == (yBottom - 1) / 8) {
+		mask &= (uint8_t)(0xFF >> (7 - ((yBottom - 1) % 8)));
 	}
+	return mask;
 }
 
 /*
-* OLED_draw_xbm()
+* _reverse_byte()
 * ---------------
-* External function to draw an xbm image on the display buffer in the correct position.
+* Private function to reverse the order of the bits in a byte.
 *
-* xPosition: The x-coordinate of the starting pixel of the image.
+* byte: The byte to be reversed.
 *
-* yPositioin: The y-coordinate of the starting pixel of the image.
+* Return:	The reversed byte, bit 0 swapped with bit 7 and so on.
+*/
+static uint8_t _reverse_byte(uint8_t byte) {
+	byte = (byte >> 4) | (byte << 4);
+	byte = ((byte >> 2) & 0x33) | ((byte & 0x33) << 2);
+	byte = ((byte >> 1) & 0x55) | ((byte & 0x55) << 1);
+	return byte;
+}
+
+#ifdef OLED_PRE_ROTATED_FONTS
+/*
+* _draw_pre_rotated()
+* -------------------
+* Private function to draw a glyph from the pre-rotated font tables generated by
+* tools/rotate_fonts.py. The glyph is already page packed in the requested orientation so
+* its bytes are copied into the buffer, shifted if it does not start on a page boundary.
 *
-* xbm: The xbm image data stored as a PROGMEM array.
+* rotated: The FONT_x_ROTATED table of the font.
 *
-* width: The width of the xbm image.
+* rotatedOffsets: The FONT_x_ROTATED_OFFSETS table of the font.
 *
-* height: The height of the xbm image.
+* index: The index of the glyph in the font.
 *
-* screenOrientation: The desired orientation of the image:
-*	0 = No rotation (normal orientation).
-*	1 = 90 degrees clockwise rotation.
-*	2 = 180 degrees clockwise rotation (upside down).
-*	3 = 270 degrees clockwise rotation.
+* xPosition: The x-coordinate of the glyph before rotation, the same as OLED_draw_xbm().
 *
-* NOTE:	
-*	-	The correct width and height must be given or the image will not be processed correctly. Also the xbm image must be
-*		stored as a PROGMEM array.
-	-	No checks for valid x and y coordinated.
+* yPosition: The y-coordinate of the glyph before rotation, the same as OLED_draw_xbm().
+*
+* width: The width of the glyph.
+*
+* height: The height of the glyph.
+*
+* screenOrientation: The desired orientation of the glyph (0 - 3).
+*
+* Return:	1 if the glyph was drawn.
+*			0 if the orientation was not generated for this font, use OLED_draw_xbm() instead.
 */
-void OLED_draw_xbm(uint8_t xPosition, uint8_t yPosition, const uint8_t xbm[], uint8_t width, uint8_t height, uint8_t screenOrientation) {
-	uint8_t originalWidth = width;
-	
-	//	The XBM image needs to be drawn in horizontal sections of 8 pixels. If the width of an XBM image is not a multiple of 8 then the 
-	//	irrelevant pixels must be trimmed from the image. This is what the adjustedWidth variable below is used for.
-	uint8_t adjustedWidth = width; 
+static uint8_t _draw_pre_rotated(const uint8_t* const rotated[], const uint16_t* const rotatedOffsets[], uint8_t index, uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t screenOrientation) {
+	if (screenOrientation > 3) {
+		return 0;
+	}
 	
-	// The number of bytes used horizontally in each row of the image.
-	// This variable is used to determine which bits need to be trimmed (if any) to display the image.
-	uint8_t multipleBytes;	
+	const uint8_t* glyph = (const uint8_t*)pgm_read_word(&(rotated[screenOrientation]));
+	if (!glyph) {
+		return 0;
+	}
+	const uint16_t* offsets = (const uint16_t*)pgm_read_word(&(rotatedOffsets[screenOrientation]));
+	glyph += pgm_read_word(&(offsets[index]));
 	
-	uint8_t raw_X_calclulation;	// x-coordinate of a pixel in the image before orientation adjustments.
-	uint8_t raw_Y_calclulation;	// y-coordinate of a pixel in the image before orientation adjustments.
-	uint8_t targetX;			// x-coordinate of a pixel in the image after orientation adjustments.
-	uint8_t targetY;			// y-coordinate of a pixel in the image after orientation adjustments.
+	// Top left corner and size of the glyph on the screen after rotation.
+	int16_t xOrigin;
+	int16_t yOrigin;
+	uint8_t columns = width;
+	uint8_t rows = height;
 	
-	if (width == 8) {
-		multipleBytes = 0;	// Means only one byte needed per row.
+	if (screenOrientation == 0) {
+		// Normal orientation.
+		xOrigin = xPosition;
+		yOrigin = yPosition;
+	} else if (screenOrientation == 1) {
+		// 90 degrees
+		xOrigin = OLED_WIDTH - (int16_t)yPosition - height;
+		yOrigin = xPosition;
+		columns = height;
+		rows = width;
+	} else if (screenOrientation == 2) {
+		// 180 degrees
+		xOrigin = OLED_WIDTH - (int16_t)xPosition - width;
+		yOrigin = OLED_HEIGHT - (int16_t)yPosition - height;
 	} else {
-		 multipleBytes = width / 8;	// Multiple bytes needed per row.
+		// 270 degrees
+		xOrigin = yPosition;
+		yOrigin = OLED_HEIGHT - (int16_t)xPosition - width;
+		columns = height;
+		rows = width;
 	}
 	
-	if ((width % 8) != 0) {
-		width = ((width / 8 + 1)) * 8;	// If the width is not a multiple of 8 then adjust the width variable so that it is.
-		// eg, a width of 28 would correspond to an actual width of 32.
-	}
-	
-	uint8_t trim = 0;
-	for (uint16_t i = 0; i < width * height / 8; i++) {
-		uint8_t byteColumn = pgm_read_byte(&(xbm[i]));
-		if (multipleBytes > 0) {
-			// If trim == multiple bytes then calculate how many bits need to be trimmed off the byte if the width is not a multiple of 8.
-			if (trim == multipleBytes) {	
-				trim = -1;	// set trim to -1 because it will be incremented back to zero at the end of the if statement.
-				adjustedWidth = originalWidth - (multipleBytes * 8);
-			} else {
-				adjustedWidth = 8;	// Otherwise no bits need to be trimmed and display the entire byte.
-			}
-		}
-		trim++;
-		
-		for (uint8_t j = 0; j < adjustedWidth; j++) {
-			if (_bitread(byteColumn, j)) {
-				
-				raw_X_calclulation = (i * 8 + j) % width + xPosition;
-				raw_Y_calclulation = (8 * i / (width)) + yPosition;
-				
-				if (screenOrientation == 0) {
-					// Normal orientation.
-					targetX = raw_X_calclulation;
-					targetY = raw_Y_calclulation;
-					
-				} else if (screenOrientation == 1) {				
-					// 90 degrees
-					targetX = 127 - raw_Y_calclulation;
-					targetY = raw_X_calclulation;
-					
-				} else if (screenOrientation == 2) {
-					// 180 degrees
-					targetX = 127 - raw_X_calclulation;
-					targetY = 63 - raw_Y_calclulation;
-					
-				} else if (screenOrientation == 3) {
-					// 270 degrees
-					targetX = raw_Y_calclulation;
-					targetY = 63 - raw_X_calclulation;
-					
-				} else {
-					// Invalid orientation used.
-					targetX = 0;
-					targetY = 0;
-					
-				}
-				OLED_set_pixel(targetX, targetY);
-			}
+	if (!_strip_overlaps(yOrigin, yOrigin + rows)) {
+		return 1;
+	}
+	
+	for (uint8_t page = 0; page < (rows + 7) / 8; page++) {
+		for (uint8_t column = 0; column < columns; column++) {
+			_or_column_byte(xOrigin + column, yOrigin + page * 8, pgm_read_byte(glyph++));
 		}
 	}
+	return 1;
 }
-
+#endif /* OLED_PRE_ROTATED_FONTS */
 
 /*
 * OLED_screen_off()
@@ -652,11 +2293,12 @@ void OLED_screen_on() {
 * External function to invert every pixel in the display buffer.
 */
 void OLED_invert_buffer() {
-	for (uint8_t i = 0; i < OLED_HEIGHT / 8; i++) {
+	for (uint8_t i = 0; i < OLED_BUFFER_PAGES; i++) {
 		for (uint8_t j = 0; j < OLED_WIDTH; j++) {
 			_oled_buffer[i][j] ^= 0xFF;
 		}
 	}
+	_mark_all_dirty();
 }
 
 /*
@@ -667,12 +2309,13 @@ void OLED_invert_buffer() {
 * xCoordinate: The x-coordinate of the pixel.
 *
 * yCoordinate: The y-coordinate of the pixel.
+*
+* NOTE: 
+*	-	Pixels outside of the screen are not drawn.
+*	-	The coordinates are on the canvas, see OLED_set_canvas().
 */
 void OLED_clear_pixel(uint8_t xCoordinate, uint8_t yCoordinate) {
-	uint8_t page = yCoordinate / 8;
-	uint8_t column = xCoordinate;
-	uint8_t value = ~(1 << (yCoordinate - (yCoordinate / 8) * 8));
-	_oled_buffer[page][column] &= value;
+	_canvas_pixel(xCoordinate, yCoordinate, OLED_DRAW_CLEAR);
 }
 
 /*
@@ -683,28 +2326,11 @@ void OLED_clear_pixel(uint8_t xCoordinate, uint8_t yCoordinate) {
 * yTop:	The top y-coordinate of the horizontal region to be inverted.
 *
 * yBottom: The bottom y-coordinate of the horizontal region to be inverted.
+*
+* NOTE: The region goes across the whole width of the canvas, see OLED_set_canvas().
 */
 void OLED_invert_horizontal(uint8_t yTop, uint8_t yBottom) {
-	uint8_t xPos;
-	uint8_t yPos;
-	
-	for (uint8_t i = 0; i < OLED_HEIGHT / 8; i++) {
-		for (uint8_t j = 0; j < OLED_WIDTH; j++) {
-			for (uint8_t k = 0; k < 8; k++) {
-				xPos = j;
-				yPos = (i * 8) + k;
-				
-				if ((yPos >= yTop) && (yPos < yBottom)) {
-					if (_bitread(_oled_buffer[i][j], k)) {
-						OLED_clear_pixel(xPos, yPos);
-					} else {
-						OLED_set_pixel(xPos, yPos);
-					}
-				}
-				
-			}
-		}
-	}
+	OLED_invert_rectangle(0, OLED_CANVAS_WIDTH(_canvasOrientation), yTop, yBottom);
 }
 
 /*
@@ -715,27 +2341,11 @@ void OLED_invert_horizontal(uint8_t yTop, uint8_t yBottom) {
 * xLeft: The left x-coordinate of the vertical region to be inverted.
 *
 * xRight: The right x-coordinate of the vertical region to be inverted.
+*
+* NOTE: The region goes down the whole height of the canvas, see OLED_set_canvas().
 */
 void OLED_invert_vertical(uint8_t xLeft, uint8_t xRight) {
-	uint8_t xPos;
-	uint8_t yPos;
-	
-	for (uint8_t i = 0; i < OLED_HEIGHT / 8; i++) {
-		for (uint8_t j = 0; j < OLED_WIDTH; j++) {
-			for (uint8_t k = 0; k < 8; k++) {
-				xPos = j;
-				yPos = (i * 8) + k;
-				
-				if ((xPos >= xLeft) && (xPos < xRight)) {
-					if (_bitread(_oled_buffer[i][j], k)) {
-						OLED_clear_pixel(xPos, yPos);
-					} else {
-						OLED_set_pixel(xPos, yPos);
-					}
-				}
-			}
-		}
-	}
+	OLED_invert_rectangle(xLeft, xRight, 0, OLED_CANVAS_HEIGHT(_canvasOrientation));
 }
 
 /*
@@ -750,29 +2360,337 @@ void OLED_invert_vertical(uint8_t xLeft, uint8_t xRight) {
 * yTop: The top y-coordinate of the rectangular region to be inverted.
 *
 * yBottom: The bottom y-coordinate of the rectangular region to be inverted.
+*
+* NOTE:	
+*	-	xRight and yBottom are not inverted, the region is xLeft to xRight - 1 and yTop
+*		to yBottom - 1. Anything past the edge of the screen is ignored.
+*	-	Only the pages and columns inside the region are touched, see _fill_region().
+*	-	The coordinates are on the canvas, see OLED_set_canvas().
 */
 void OLED_invert_rectangle(uint8_t xLeft, uint8_t xRight, uint8_t yTop, uint8_t yBottom) {
-	uint8_t xPos;
-	uint8_t yPos;
+	_canvas_fill(xLeft, xRight, yTop, yBottom, OLED_DRAW_XOR);
+}
+
+/*
+* OLED_clear_rectangle()
+* ----------------------
+* External function to clear the pixels within a rectangular region of the OLED display.
+*
+* xLeft: The left x-coordinate of the rectangular region to be cleared.
+*
+* xRight: One past the right x-coordinate of the rectangular region to be cleared.
+*
+* yTop: The top y-coordinate of the rectangular region to be cleared.
+*
+* yBottom: One past the bottom y-coordinate of the rectangular region to be cleared.
+*
+* NOTE: The region is the same as OLED_invert_rectangle(), on the canvas.
+*/
+void OLED_clear_rectangle(uint8_t xLeft, uint8_t xRight, uint8_t yTop, uint8_t yBottom) {
+	_canvas_fill(xLeft, xRight, yTop, yBottom, OLED_DRAW_CLEAR);
+}
+
+/*
+* OLED_draw_background()
+* ----------------------
+* External function to replace the whole buffer with a background made by
+* tools/make_backgrounds.py. Use it instead of OLED_clear_buffer() at the start of a frame
+* with parts that never change, so they are copied from flash instead of drawn again.
+*
+* background: The background stored in PROGMEM. Each page is a list of runs of columns, a
+* run is its first column, its number of columns and then a byte for each column. A first
+* column of OLED_BACKGROUND_END_OF_PAGE ends the page, the columns outside of the runs are
+* blank.
+*
+* NOTE: 
+*	-	Only the columns that change are marked as changed, the same as OLED_clear_buffer().
+*	-	If an interrupt driven flush is in progress this waits for it to finish first.
+*	-	With OLED_PAGE_RENDERER defined this copies the pages of the strip being rendered.
+*	-	The clip region is ignored.
+*/
+void OLED_draw_background(const uint8_t background[]) {
+	#ifndef OLED_PAGE_RENDERER
+		_wait_for_flush();	/* Wait for an interrupt driven flush to finish with the buffer */
+	#endif /* OLED_PAGE_RENDERER */
 	
-	for (uint8_t i = 0; i < OLED_HEIGHT / 8; i++) {
-		for (uint8_t j = 0; j < OLED_WIDTH; j++) {
-			for (uint8_t k = 0; k < 8; k++) {
-				xPos = j;
-				yPos = (i * 8) + k;
+	for (uint8_t page = 0; page < OLED_BUFFER_PAGES; page++) {
+		const uint8_t* data = _background_page(background, OLED_BUFFER_FIRST_PAGE + page);
+		uint8_t* row = _oled_buffer[page];
+		uint8_t changedStart = OLED_WIDTH;
+		uint8_t changedEnd = 0;
+		uint8_t column = 0;
+		uint8_t runStart;
+		
+		while (column < OLED_WIDTH) {
+			uint8_t runEnd = OLED_WIDTH;
+			
+			// Blank columns up to the next run, then the run itself.
+			runStart = pgm_read_byte(data);
+			if (runStart == OLED_BACKGROUND_END_OF_PAGE) {
+				runStart = OLED_WIDTH;
+			} else {
+				runEnd = runStart + pgm_read_byte(data + 1);
+				data += 2;
+			}
+			
+			for (; column < runEnd; column++) {
+				uint8_t value = (column < runStart) ? 0x00 : pgm_read_byte(data++);
 				
-				if ((xPos >= xLeft) && (xPos < xRight) && (yPos >= yTop) && (yPos < yBottom)) {
-					if (_bitread(_oled_buffer[i][j], k)) {
-						OLED_clear_pixel(xPos, yPos);
-					} else {
-						OLED_set_pixel(xPos, yPos);
+				if (row[column] != value) {
+					row[column] = value;
+					if (changedStart == OLED_WIDTH) {
+						changedStart = column;
+					}
+					changedEnd = column + 1;
+				}
+			}
+		}
+		_mark_dirty(OLED_BUFFER_FIRST_PAGE + page, changedStart, changedEnd);
+	}
+}
+
+/*
+* OLED_restore_background()
+* -------------------------
+* External function to put back the pixels of a background in a rectangular region, like
+* OLED_clear_rectangle() but the region ends up as it is in the background instead of blank.
+*
+* background: The background stored in PROGMEM, see OLED_draw_background().
+*
+* xLeft: The left x-coordinate of the region.
+*
+* xRight: One past the right x-coordinate of the region.
+*
+* yTop: The top y-coordinate of the region.
+*
+* yBottom: One past the bottom y-coordinate of the region.
+*
+* NOTE: Anything outside of the clip region is not changed.
+*/
+void OLED_restore_background(const uint8_t background[], uint8_t xLeft, uint8_t xRight, uint8_t yTop, uint8_t yBottom) {
+	int16_t left = xLeft;
+	int16_t right = xRight;
+	int16_t top = yTop;
+	int16_t bottom = yBottom;
+	
+	_fill_region(left, right, top, bottom, OLED_DRAW_CLEAR);
+	if (!_clip_region(&left, &right, &top, &bottom)) {
+		return;
+	}
+	
+	uint8_t firstPage = top / 8;
+	uint8_t lastPage = (bottom - 1) / 8;
+	
+	for (uint8_t page = firstPage; page <= lastPage; page++) {
+		const uint8_t* data = _background_page(background, page);
+		uint8_t* row = _oled_buffer[page - OLED_BUFFER_FIRST_PAGE];
+		uint8_t mask = _page_mask(page, top, bottom);
+		uint8_t changedStart = OLED_WIDTH;
+		uint8_t changedEnd = 0;
+		uint8_t runStart;
+		
+		// The region is blank now, so only the set pixels of the runs that overlap it are copied.
+		while ((runStart = pgm_read_byte(data)) != OLED_BACKGROUND_END_OF_PAGE) {
+			uint8_t runEnd = runStart + pgm_read_byte(data + 1);
+			data += 2;
+			
+			for (uint8_t column = (runStart > left) ? runStart : left; (column < runEnd) && (column < right); column++) {
+				uint8_t bits = pgm_read_byte(&(data[column - runStart])) & mask;
+				
+				if (bits) {
+					row[column] |= bits;
+					if (changedStart == OLED_WIDTH) {
+						changedStart = column;
 					}
+					changedEnd = column + 1;
 				}
 			}
+			data += runEnd - runStart;
+		}
+		_mark_dirty(page, changedStart, changedEnd);
+	}
+}
+
+/*
+* _background_page()
+* ------------------
+* Private function to find the runs of a page in a background.
+*
+* background: The background stored in PROGMEM, see OLED_draw_background().
+*
+* page: The page of the screen.
+*
+* Return: The first run of the page in PROGMEM.
+*/
+static const uint8_t* _background_page(const uint8_t* background, uint8_t page) {
+	for (; page; page--) {
+		while (pgm_read_byte(background) != OLED_BACKGROUND_END_OF_PAGE) {
+			background += 2 + pgm_read_byte(background + 1);
+		}
+		background++;
+	}
+	return background;
+}
+
+/*
+* OLED_set_clip()
+* ---------------
+* External function to limit all drawing to a rectangular region of the screen. Anything the
+* draw functions would put outside of the region is left as it is, so part of the screen can
+* be cleared and redrawn without touching its surroundings.
+*
+* xLeft: The left x-coordinate of the region.
+*
+* xRight: One past the right x-coordinate of the region.
+*
+* yTop: The top y-coordinate of the region.
+*
+* yBottom: One past the bottom y-coordinate of the region.
+*
+* NOTE: 
+*	-	OLED_clear_buffer() and OLED_invert_buffer() still affect the whole buffer.
+*	-	The region stays in place until OLED_reset_clip() is called.
+*	-	The region is on the screen, it is not turned by OLED_set_canvas().
+*/
+void OLED_set_clip(uint8_t xLeft, uint8_t xRight, uint8_t yTop, uint8_t yBottom) {
+	if (xRight > OLED_WIDTH) {
+		xRight = OLED_WIDTH;
+	}
+	if (yBottom > OLED_HEIGHT) {
+		yBottom = OLED_HEIGHT;
+	}
+	
+	_clipLeft = xLeft;
+	_clipRight = xRight;
+	_clipTop = yTop;
+	_clipBottom = yBottom;
+	
+	for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
+		uint8_t mask = 0x00;
+		for (uint8_t bit = 0; bit < 8; bit++) {
+			uint8_t row = page * 8 + bit;
+			if ((row >= yTop) && (row < yBottom)) {
+				mask |= (1 << bit);
+			}
 		}
+		_clipMasks[page] = mask;
+	}
+}
+
+/*
+* OLED_reset_clip()
+* -----------------
+* External function to allow drawing on the whole screen again after OLED_set_clip().
+*/
+void OLED_reset_clip() {
+	OLED_set_clip(0, OLED_WIDTH, 0, OLED_HEIGHT);
+}
+
+/*
+* OLED_set_canvas()
+* -----------------
+* External function to turn the coordinates given to the pixel, line, rectangle, inversion
+* and circle functions to a screen orientation, so a whole frame can be drawn the way up the
+* clock is held. Set it once before drawing the frame.
+*
+* screenOrientation: The orientation of the canvas, the same as OLED_draw_xbm():
+*	0 = No rotation, the canvas is the screen.
+*	1 = 90 degrees clockwise rotation.
+*	2 = 180 degrees clockwise rotation (upside down).
+*	3 = 270 degrees clockwise rotation.
+*
+* NOTE: 
+*	-	The canvas is OLED_CANVAS_WIDTH() by OLED_CANVAS_HEIGHT() pixels, 64 by 128 when
+*		turned by 90 or 270 degrees.
+*	-	Strings and images still take their own screenOrientation.
+*	-	The clip region and OLED_restore_background() are on the screen, not the canvas.
+*/
+void OLED_set_canvas(uint8_t screenOrientation) {
+	_canvasOrientation = screenOrientation & 0x03;
+}
+
+/*
+* OLED_get_canvas()
+* -----------------
+* External function to get the orientation set by OLED_set_canvas().
+*
+* Return: The orientation of the canvas, 0 to 3.
+*/
+uint8_t OLED_get_canvas() {
+	return _canvasOrientation;
+}
+
+/*
+* _canvas_region()
+* ----------------
+* Private function to move a region of the canvas to where it is on the screen. A turned
+* rectangle is still a rectangle, so the draw functions move their regions once and then fill
+* them a byte at a time the same as on an unturned canvas.
+*
+* xLeft, xRight, yTop, yBottom: The region on the canvas, the right and bottom are one past
+* it. Changed to the region on the screen.
+*/
+static void _canvas_region(int16_t* xLeft, int16_t* xRight, int16_t* yTop, int16_t* yBottom) {
+	int16_t left = *xLeft;
+	int16_t right = *xRight;
+	int16_t top = *yTop;
+	int16_t bottom = *yBottom;
+	
+	switch (_canvasOrientation) {
+		case OLED_CLOCKWISE_90:
+			*xLeft = OLED_WIDTH - bottom;
+			*xRight = OLED_WIDTH - top;
+			*yTop = left;
+			*yBottom = right;
+			break;
+		case OLED_CLOCKWISE_180:
+			*xLeft = OLED_WIDTH - right;
+			*xRight = OLED_WIDTH - left;
+			*yTop = OLED_HEIGHT - bottom;
+			*yBottom = OLED_HEIGHT - top;
+			break;
+		case OLED_CLOCKWISE_270:
+			*xLeft = top;
+			*xRight = bottom;
+			*yTop = OLED_HEIGHT - right;
+			*yBottom = OLED_HEIGHT - left;
+			break;
 	}
 }
 
+/*
+* _canvas_fill()
+* --------------
+* Private function to draw a region of the canvas with _fill_region().
+*
+* xLeft, xRight, yTop, yBottom: The region on the canvas, the right and bottom are one past it.
+*
+* drawMode: OLED_DRAW_SET, OLED_DRAW_CLEAR or OLED_DRAW_XOR.
+*/
+static void _canvas_fill(int16_t xLeft, int16_t xRight, int16_t yTop, int16_t yBottom, uint8_t drawMode) {
+	_canvas_region(&xLeft, &xRight, &yTop, &yBottom);
+	_fill_region(xLeft, xRight, yTop, yBottom, drawMode);
+}
+
+/*
+* _canvas_pixel()
+* ---------------
+* Private function to draw a pixel of the canvas with _draw_pixel().
+*
+* xCoordinate: The x-coordinate of the pixel on the canvas.
+*
+* yCoordinate: The y-coordinate of the pixel on the canvas.
+*
+* drawMode: OLED_DRAW_SET, OLED_DRAW_CLEAR or OLED_DRAW_XOR.
+*/
+static void _canvas_pixel(int16_t xCoordinate, int16_t yCoordinate, uint8_t drawMode) {
+	int16_t xRight = xCoordinate + 1;
+	int16_t yBottom = yCoordinate + 1;
+	
+	_canvas_region(&xCoordinate, &xRight, &yCoordinate, &yBottom);
+	_draw_pixel(xCoordinate, yCoordinate, drawMode);
+}
+
 /*
 * OLED_draw_horizontal_line()
 * ---------------------------
@@ -780,16 +2698,22 @@ void OLED_invert_rectangle(uint8_t xLeft, uint8_t xRight, uint8_t yTop, uint8_t
 *
 * xStart: The starting x-coordinate of the horizontal line.
 *
-* xEnd: The ending x-coordinate of the horizontal line.
+* xEnd: The ending x-coordinate of the horizontal line (not drawn).
 *
 * yPosition: The y-coordinate at which the horizontal line will be drawn.
 *
-* NOTE: No checks for valid positioning of the line.
+* drawMode:
+*	-	OLED_DRAW_SET = Set the pixels.
+*	-	OLED_DRAW_CLEAR = Clear the pixels.
+*	-	OLED_DRAW_XOR = Invert the pixels.
+*
+* NOTE: 
+*	-	Any part of the line off the screen is not drawn.
+*	-	The coordinates are on the canvas, see OLED_set_canvas(). On a turned canvas the line
+*		goes down the screen.
 */
-void OLED_draw_horizontal_line(uint8_t xStart, uint8_t xEnd, uint8_t yPosition) {
-	for (uint8_t i = xStart; i < xEnd; i++) {
-		OLED_set_pixel(i, yPosition);
-	}
+void OLED_draw_horizontal_line(uint8_t xStart, uint8_t xEnd, uint8_t yPosition, uint8_t drawMode) {
+	_canvas_fill(xStart, xEnd, yPosition, yPosition + 1, drawMode);
 }
 
 /*
@@ -799,17 +2723,22 @@ void OLED_draw_horizontal_line(uint8_t xStart, uint8_t xEnd, uint8_t yPosition)
 *
 * yStart: The starting y-coordinate of the vertical line.
 *
-* yEnd: The ending y-coordinate of the vertical line.
+* yEnd: The ending y-coordinate of the vertical line (not drawn).
 *
 * xPosition: The x-coordinate at which the vertical line will be drawn.
 *
+* drawMode:
+*	-	OLED_DRAW_SET = Set the pixels.
+*	-	OLED_DRAW_CLEAR = Clear the pixels.
+*	-	OLED_DRAW_XOR = Invert the pixels.
 *
-* NOTE: No checks for valid positioning of the line.
+* NOTE: 
+*	-	Any part of the line off the screen is not drawn.
+*	-	The coordinates are on the canvas, see OLED_set_canvas(). On a turned canvas the line
+*		goes across the screen.
 */
-void OLED_draw_vertical_line(uint8_t yStart, uint8_t yEnd, uint8_t xPosition) {
-	for (uint8_t i = yStart; i < yEnd; i++) {
-		OLED_set_pixel(xPosition, i);
-	}
+void OLED_draw_vertical_line(uint8_t yStart, uint8_t yEnd, uint8_t xPosition, uint8_t drawMode) {
+	_canvas_fill(xPosition, xPosition + 1, yStart, yEnd, drawMode);
 }
 
 /*
@@ -821,30 +2750,45 @@ void OLED_draw_vertical_line(uint8_t yStart, uint8_t yEnd, uint8_t xPosition) {
 *
 * yPosition: The y-coordinate of the top left corner of the rectangle.
 *
-* width: The width of the rectangle.
+* width: The width of the rectangle. The right edge is drawn at xPosition + width.
 *
-* height: The height of the rectangle.
+* height: The height of the rectangle. The bottom edge is drawn at yPosition + height - 1.
 *
 * filled:
 *	-	0 = Not filled (outline).
 *	-	1 = Filled (solid).
 *
+* drawMode:
+*	-	OLED_DRAW_SET = Set the pixels.
+*	-	OLED_DRAW_CLEAR = Clear the pixels.
+*	-	OLED_DRAW_XOR = Invert the pixels.
 *
-*	NOTE: No checks for valid positioning of the rectangle.
+* NOTE: 
+*	-	Every pixel is drawn exactly once, so OLED_DRAW_XOR does not cancel out at the corners.
+*	-	Any part of the rectangle off the screen is not drawn.
+*	-	The coordinates are on the canvas, see OLED_set_canvas(). Each edge is turned as a
+*		whole, so the edges are still filled a byte at a time.
 */
-void OLED_draw_rectangle(uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t filled) {
-	OLED_draw_horizontal_line(xPosition, xPosition + width, yPosition);
-	OLED_draw_horizontal_line(xPosition, xPosition + width, yPosition + height - 1);
+void OLED_draw_rectangle(uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t filled, uint8_t drawMode) {
+	int16_t xRight = xPosition + width + 1;
+	int16_t yBottom = yPosition + height;
 	
-	OLED_draw_vertical_line(yPosition, yPosition + height, xPosition);
-	OLED_draw_vertical_line(yPosition, yPosition + height, xPosition + width);
+	if (height == 0) {
+		return;
+	}
 	
-	if (filled) {
-		for (uint8_t i = yPosition + 1; i < yPosition + height - 1; i++) {
-			OLED_draw_horizontal_line(xPosition, xPosition + width, i);
-		}
+	if (filled || height <= 2) {
+		_canvas_fill(xPosition, xRight, yPosition, yBottom, drawMode);
+		return;
 	}
 	
+	// Top and bottom edges, then the sides between them.
+	_canvas_fill(xPosition, xRight, yPosition, yPosition + 1, drawMode);
+	_canvas_fill(xPosition, xRight, yBottom - 1, yBottom, drawMode);
+	_canvas_fill(xPosition, xPosition + 1, yPosition + 1, yBottom - 1, drawMode);
+	if (width) {
+		_canvas_fill(xRight - 1, xRight, yPosition + 1, yBottom - 1, drawMode);
+	}
 }
 
 /*
@@ -863,53 +2807,148 @@ void OLED_draw_rectangle(uint8_t xPosition, uint8_t yPosition, uint8_t width, ui
 *	-	0 = Not filled (outline).
 *	-	1 = Filled (solid).
 *
-* NOTE: No checks for valid positioning of the circle.
+* drawMode:
+*	-	OLED_DRAW_SET = Set the pixels.
+*	-	OLED_DRAW_CLEAR = Clear the pixels.
+*	-	OLED_DRAW_XOR = Invert the pixels.
+*
+* NOTE: 
+*	-	A filled circle is drawn as one horizontal span per row and an outline visits each
+*		pixel once, so OLED_DRAW_XOR inverts every pixel exactly once.
+*	-	Any part of the circle off the screen is not drawn.
+*	-	The coordinates are on the canvas, see OLED_set_canvas(). The center must be on the
+*		canvas.
 */
-void OLED_draw_circle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t filled) {
-	int8_t x = radius;	
-	int8_t y = 0;		
+void OLED_draw_circle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t filled, uint8_t drawMode) {
+	int16_t x = radius;	
+	int16_t y = 0;		
 	int16_t p = 1 - x;
+	
+	// A circle is the same turned any way, so only its center is moved onto the screen.
+	int16_t left = xCenter;
+	int16_t right = xCenter + 1;
+	int16_t top = yCenter;
+	int16_t bottom = yCenter + 1;
+	_canvas_region(&left, &right, &top, &bottom);
+	xCenter = left;
+	yCenter = top;
+	
+	// An outline that is all on the screen and in the clip region skips the checks per pixel.
+	uint8_t clipped = 1;
+	#ifndef OLED_PAGE_RENDERER
+		clipped = (xCenter < _clipLeft + radius) || (xCenter + radius >= _clipRight) ||
+				(yCenter < _clipTop + radius) || (yCenter + radius >= _clipBottom);
+	#endif /* OLED_PAGE_RENDERER */
 
-	if (filled) {
-		while (x >= y) {
-			// Draw horizontal lines for each scan line within the circle
-			for (uint8_t i = xCenter - x; i <= xCenter + x; i++) {
-				OLED_set_pixel(i, yCenter + y);
-				OLED_set_pixel(i, yCenter - y);
+	while (x >= y) {
+		if (filled) {
+			// The rows at +-y are only reached once, at their widest.
+			_fill_region(xCenter - x, xCenter + x + 1, yCenter + y, yCenter + y + 1, drawMode);
+			if (y) {
+				_fill_region(xCenter - x, xCenter + x + 1, yCenter - y, yCenter - y + 1, drawMode);
 			}
-
-			for (uint8_t i = xCenter - y; i <= xCenter + y; i++) {
-				OLED_set_pixel(i, yCenter + x);
-				OLED_set_pixel(i, yCenter - x);
+		} else {
+			_circle_points(xCenter, yCenter, x, y, drawMode, clipped);
+		}
+		
+		int16_t lastY = y;
+		y++;
+		
+		if (p < 0) {
+			p += 2 * y + 1;
+		} else {
+			/* 
+			This is the last step at this x so the rows at +-x are as wide as they get. When
+			x == lastY those rows are the +-y rows above and are already drawn.
+			*/
+			if (filled && (x != lastY)) {
+				_fill_region(xCenter - lastY, xCenter + lastY + 1, yCenter + x, yCenter + x + 1, drawMode);
+				_fill_region(xCenter - lastY, xCenter + lastY + 1, yCenter - x, yCenter - x + 1, drawMode);
 			}
+			x--;
+			p += 2 * (y - x) + 1;
+		}
+	}
+}
 
-			y++;
-			if (p < 0) {
-				p += 2 * y + 1;
-			} else {
-				x--;
-				p += 2 * (y - x) + 1;
-			}
+/*
+* _circle_points()
+* ----------------
+* Private function to draw the points of a circle outline mirrored into all 8 octants for one
+* step of the Midpoint Circle Algorithm. Points that land on top of each other on the axes and
+* diagonals are only drawn once.
+*
+* xCenter: The x-coordinate of the center of the circle.
+*
+* yCenter: The y-coordinate of the center of the circle.
+*
+* x: The x offset of the point from the center.
+*
+* y: The y offset of the point from the center.
+*
+* drawMode: OLED_DRAW_SET, OLED_DRAW_CLEAR or OLED_DRAW_XOR.
+*
+* clipped: 1 if some of the circle may be off the screen or outside the clip region.
+*/
+static void _circle_points(uint8_t xCenter, uint8_t yCenter, uint8_t x, uint8_t y, uint8_t drawMode, uint8_t clipped) {
+	uint8_t a = x;
+	uint8_t b = y;
+	
+	// Setting or clearing a pixel twice does no harm, so only OLED_DRAW_XOR needs the points
+	// that land on top of each other left out.
+	if (!clipped && (drawMode != OLED_DRAW_XOR)) {
+		uint8_t value = (drawMode == OLED_DRAW_SET) ? 0xFF : 0x00;
+		
+		_outline_pixel(xCenter + x, yCenter + y, value);
+		_outline_pixel(xCenter + y, yCenter + x, value);
+		_outline_pixel(xCenter - y, yCenter + x, value);
+		_outline_pixel(xCenter - x, yCenter + y, value);
+		_outline_pixel(xCenter - x, yCenter - y, value);
+		_outline_pixel(xCenter - y, yCenter - x, value);
+		_outline_pixel(xCenter + y, yCenter - x, value);
+		_outline_pixel(xCenter + x, yCenter - y, value);
+		return;
+	}
+	
+	for (uint8_t octantPair = 0; octantPair < 2; octantPair++) {
+		_draw_pixel(xCenter + a, yCenter + b, drawMode);
+		if (a) {
+			_draw_pixel(xCenter - a, yCenter + b, drawMode);
 		}
-	} else {
-		while (x >= y) {
-			OLED_set_pixel(xCenter + x, yCenter + y);
-			OLED_set_pixel(xCenter + y, yCenter + x);
-			OLED_set_pixel(xCenter - y, yCenter + x);
-			OLED_set_pixel(xCenter - x, yCenter + y);
-			OLED_set_pixel(xCenter - x, yCenter - y);
-			OLED_set_pixel(xCenter - y, yCenter - x);
-			OLED_set_pixel(xCenter + y, yCenter - x);
-			OLED_set_pixel(xCenter + x, yCenter - y);
-
-			y++;
-			
-			if (p < 0) {
-				p += 2 * y + 1;
-			} else {
-				x--;
-				p += 2 * (y - x) + 1;
+		if (b) {
+			_draw_pixel(xCenter + a, yCenter - b, drawMode);
+			if (a) {
+				_draw_pixel(xCenter - a, yCenter - b, drawMode);
 			}
 		}
-	}	
-}
\ No newline at end of file
+		
+		if (x == y) {
+			break;
+		}
+		a = y;
+		b = x;
+	}
+}
+
+/*
+* _outline_pixel()
+* ----------------
+* Private function to set or clear a single pixel of a circle outline that is on the screen
+* and in the clip region, without the checks _draw_pixel() makes. The column is marked as
+* changed only if the pixel changes.
+*
+* column: The column of the pixel.
+*
+* row: The row of the pixel.
+*
+* value: 0xFF to set the pixel, 0x00 to clear it.
+*/
+static void _outline_pixel(uint8_t column, uint8_t row, uint8_t value) {
+	uint8_t page = row / 8;
+	uint8_t mask = 1 << (row % 8);
+	
+	if ((_oled_buffer[page][column] ^ value) & mask) {
+		_oled_buffer[page][column] ^= mask;
+		_mark_dirty(page, column, column + 1);
+	}
+}
@@ -4,7 +4,8 @@
  * Author: Tom
  * Date: 10/11/2023
  * AVR Library for 128x64 SH1106 OLED Display Module. This lib
- * requires the Peter Fleury i2cmaster interface.
+ * requires the Peter Fleury i2cmaster interface, or
+ * Atmega328p_SPI.h by me when using the 4-wire SPI interface.
  * I have created 4 fonts for the screen so far.
  * This was written specifically for the atmega328p MCU. 
  **************************************************************
@@ -15,9 +16,32 @@
  * data for the screen.
  * OLED_display_buffer() - Display the pixel data buffer on the
  * sh1106.
+ * OLED_display_buffer_async() - Start displaying the pixel data
+ * buffer on the sh1106 using the TWI interrupt.
+ * OLED_flush_busy() - Check if the interrupt driven display of
+ * the buffer is still in progress.
+ * OLED_render() - Draw and display a frame a strip at a time
+ * with the page renderer.
  * OLED_draw_string() - Draw a string in the buffer.
+ * OLED_draw_string_P() - Draw a string stored in PROGMEM in
+ * the buffer.
+ * OLED_draw_string_font() - Draw a string in the buffer with
+ * a font descriptor.
+ * OLED_draw_string_aligned() - Draw a string in the buffer
+ * aligned left, center or right on a point.
+ * OLED_printf_P() - Format a string with a PROGMEM format and
+ * draw it in the buffer.
+ * OLED_measure_string() - Get the width and height of a string.
+ * OLED_measure_string_P() - Get the width and height of a
+ * string stored in PROGMEM.
+ * OLED_measure_printf_P() - Get the width and height of a
+ * string formatted as OLED_printf_P() draws it.
+ * OLED_measure_character() - Get the position and width of a
+ * character in a string.
  * OLED_set_pixel() - Set a pixel in the buffer at a position.
  * OLED_draw_xbm() - Draw an XBM image file to the screen.
+ * OLED_draw_packed() - Draw an image compressed by
+ * tools/pack_assets.py to the screen.
  * OLED_screen_off()
  * OLED_screen_on()
  * OLED_invert_buffer() - Invert all data in the buffer.
@@ -28,22 +52,148 @@
  * of the buffer.
  * OLED_invert_rectangle() - Invert pixels on the buffer in a
  * rectangular region.
+ * OLED_clear_rectangle() - Clear pixels on the buffer in a
+ * rectangular region.
+ * OLED_draw_background() - Replace the buffer with a background
+ * made by tools/make_backgrounds.py.
+ * OLED_restore_background() - Put back the pixels of a background
+ * in a rectangular region.
+ * OLED_set_clip() - Limit drawing to a rectangular region.
+ * OLED_reset_clip() - Allow drawing on the whole screen again.
+ * OLED_set_canvas() - Turn the coordinates of the draw functions
+ * to a screen orientation.
+ * OLED_get_canvas() - Get the orientation of the canvas.
  * OLED_draw_horizontal_line() - Draw a horizontal line on the scren.
  * OLED_draw_vertical_line() - Draw a vertical line on the screen.
  * OLED_draw_rectangle() - Draw a rectangle on the screen.
  * OLED_draw_circle() - Draw a circle on the screen.
  * OLED_display_invert() - Invert the display.
+ * OLED_scroll_to() - Move the picture up the display without
+ * sending it again.
+ * OLED_roll_start() - Start rolling the old frame off the
+ * display and the buffer on.
+ * OLED_roll_step() - Move a roll on by one step.
  **************************************************************
 */
 
 #ifndef SH1106_H_
 #define SH1106_H_
 
+#include "XBM_fonts/XBM_FONT.h"
+
 #define OLED_WIDTH	128
 #define OLED_HEIGHT	64
 
+/* defined = 4-wire SPI, undefined = I2C */
+/* #define OLED_SPI_MODE */
+
 #define OLED_I2C_BITRATE 450000L
 
+/* 
+4-wire SPI pins on PORTB, MOSI and SCK are the hardware SPI pins. The RES pin of the
+module must be tied to a reset circuit. 
+*/
+#define OLED_SPI_CS_PIN		0	/* Chip select (active low) */
+#define OLED_SPI_DC_PIN		1	/* Data (high) or command (low) */
+#define OLED_SPI_CLOCK_RATE	A328P_SPI_CLOCK_DIV2	/* F_CPU / 2 = 8MHz */
+
+/* The SH1106 has 132 columns of RAM, the visible 128 start at this column.
+The horizontal offset will vary depending on the hardware. */
+#define OLED_COLUMN_OFFSET 2
+
+/* 
+defined = Keep a copy of the last frame sent to the display and only send the columns
+that differ from it. This costs another 1KB of SRAM.
+*/
+/* #define OLED_SHADOW_BUFFER */
+
+/* Matching columns allowed inside one run before it is split into two transactions */
+#ifndef OLED_SHADOW_RUN_GAP
+	#define OLED_SHADOW_RUN_GAP 6
+#endif /* OLED_SHADOW_RUN_GAP */
+
+/* 
+defined = Page renderer. The 1KB buffer is replaced by a strip of OLED_STRIP_PAGES pages
+and frames are drawn with OLED_render(), which calls a draw function once for each strip
+and sends each strip as soon as it is drawn. OLED_display_buffer(),
+OLED_display_buffer_async() and OLED_flush_busy() are not available and
+OLED_SHADOW_BUFFER has no effect.
+This is a library option only. The roll clock screens, the roll animations and the widgets
+all draw into the full buffer, so the firmware must be built without it and main.c
+stops the build if it is defined. The library on its own is checked with it
+by tools/oled_host_test.py page, which compares OLED_render() frames with the same frames
+drawn into the full buffer.
+*/
+/* #define OLED_PAGE_RENDERER */
+
+/* Pages in each strip, 1 = 128 bytes of SRAM or 2 = 256 bytes and half the draw calls */
+#ifndef OLED_STRIP_PAGES
+	#define OLED_STRIP_PAGES 1
+#endif /* OLED_STRIP_PAGES */
+
+/* 
+defined = Draw text from the pre-rotated glyphs in XBM_fonts/XBM_FONTS_ROTATED.c instead of
+rotating each glyph at runtime. Orientations that were not generated for a font still fall
+back to its packed or XBM glyphs, see OLED_NO_FALLBACK_FONT_x below. Regenerate the tables with tools/rotate_fonts.py, listing only the
+orientations in use to save flash.
+*/
+#define OLED_PRE_ROTATED_FONTS
+
+/* 
+defined = Draw the fonts listed in XBM_fonts/XBM_FONTS_PACKED.h that have OLED_PACKED_FONT_x
+defined from their compressed glyphs instead of the XBM glyphs. Pre-rotated glyphs are still used first when they exist. The XBM
+glyphs of a packed font are no longer referenced and are removed by the linker. Regenerate
+the tables with tools/pack_assets.py, listing only the fonts worth the extra decode time.
+*/
+#define OLED_PACKED_FONTS
+
+/*
+Glyphs each font is drawn from in an orientation it has no pre-rotated glyphs for:
+	OLED_PACKED_FONT_x defined		= The packed glyphs in XBM_fonts/XBM_FONTS_PACKED.c, when
+									OLED_PACKED_FONTS is defined.
+	OLED_NO_FALLBACK_FONT_x defined	= None, text in that orientation is measured but not drawn.
+									Only with OLED_PRE_ROTATED_FONTS.
+	Neither							= The XBM glyphs.
+The roll clock only draws the 8px font at 180 and 270 degrees, the 16px font at 0 and 90
+degrees and the 25px font at 0 degrees, all of them pre-rotated, and never draws the 20px
+font, so with OLED_PRE_ROTATED_FONTS no font keeps glyphs it would never read.
+*/
+#ifdef OLED_PRE_ROTATED_FONTS
+	#define OLED_NO_FALLBACK_FONT_8
+	#define OLED_NO_FALLBACK_FONT_16
+	#define OLED_NO_FALLBACK_FONT_20
+	#define OLED_NO_FALLBACK_FONT_25
+#else
+	#define OLED_PACKED_FONT_16
+	#define OLED_PACKED_FONT_20
+	#define OLED_PACKED_FONT_25
+#endif /* OLED_PRE_ROTATED_FONTS */
+
+/* Encoding of an image compressed by tools/pack_assets.py */
+#define OLED_PACKED_BITS	0x00	/* 1 bit per pixel */
+#define OLED_PACKED_RLE		0x01	/* 4-bit run lengths */
+
+/* How the line, rectangle and circle functions draw their pixels */
+#define OLED_DRAW_SET	0x00	/* Set the pixels */
+#define OLED_DRAW_CLEAR	0x01	/* Clear the pixels */
+#define OLED_DRAW_XOR	0x02	/* Invert the pixels */
+
+/* Direction for OLED_roll_start() */
+#define OLED_ROLL_NONE	0x00
+#define OLED_ROLL_UP	0x01	/* The old frame leaves through the top and the new frame follows it */
+#define OLED_ROLL_DOWN	0x02	/* The old frame leaves through the bottom and the new frame follows it */
+
+/* Display lines moved by each OLED_roll_step(), 1 - 64 */
+#define OLED_ROLL_STEP_LINES 4
+
+/* First column of a run that ends a page of a background, see OLED_draw_background() */
+#define OLED_BACKGROUND_END_OF_PAGE 0xFF
+
+/* Alignment for OLED_draw_string_aligned() */
+#define OLED_ALIGN_LEFT		0x00
+#define OLED_ALIGN_CENTER	0x01
+#define OLED_ALIGN_RIGHT	0x02
+
 #define OLED_NUMBER_OF_INITIALISATION_COMMANDS 19
 
 #define OLED_CLOCKWISE_0	0
@@ -51,6 +201,10 @@
 #define OLED_CLOCKWISE_180	2
 #define OLED_CLOCKWISE_270	3
 
+/* Size of the canvas turned to a screen orientation, see OLED_set_canvas() */
+#define OLED_CANVAS_WIDTH(screenOrientation)	(((screenOrientation) & 0x01) ? OLED_HEIGHT : OLED_WIDTH)
+#define OLED_CANVAS_HEIGHT(screenOrientation)	(((screenOrientation) & 0x01) ? OLED_WIDTH : OLED_HEIGHT)
+
 #define OLED_ADDR			0x3C
 #define OLED_COMMAND_MODE	0x00
 #define OLED_DATA_MODE		0x40
@@ -78,10 +232,27 @@
 
 void OLED_init();
 void OLED_clear_buffer();
-void OLED_display_buffer();
+#ifdef OLED_PAGE_RENDERER
+	void OLED_render(void (*draw)(void));
+#else
+	void OLED_display_buffer();
+	void OLED_display_buffer_async(void (*callback)(void));
+	uint8_t OLED_flush_busy();
+	void OLED_roll_start(uint8_t direction);
+	uint8_t OLED_roll_step();
+#endif /* OLED_PAGE_RENDERER */
 void OLED_draw_string(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t screenOrientation);
+void OLED_draw_string_font(const font_t* font, char* string, uint8_t xPosition, uint8_t yPosition, uint8_t characterSpacing, uint8_t screenOrientation);
+void OLED_draw_string_P(const char* string, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t screenOrientation);
+void OLED_draw_string_aligned(char* string, uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation);
+void OLED_printf_P(uint8_t xPosition, uint8_t yPosition, uint8_t fontSize, uint8_t characterSpacing, uint8_t alignment, uint8_t screenOrientation, const char* format, ...);
+void OLED_measure_string(char* string, uint8_t fontSize, uint8_t characterSpacing, uint8_t* width, uint8_t* height);
+void OLED_measure_string_P(const char* string, uint8_t fontSize, uint8_t characterSpacing, uint8_t* width, uint8_t* height);
+void OLED_measure_printf_P(uint8_t fontSize, uint8_t characterSpacing, uint8_t* width, uint8_t* height, const char* format, ...);
+void OLED_measure_character(char* string, uint8_t index, uint8_t fontSize, uint8_t characterSpacing, uint8_t* xOffset, uint8_t* width);
 void OLED_set_pixel(uint8_t xCoordinate, uint8_t yCoordinate);
 void OLED_draw_xbm(uint8_t xPosition, uint8_t yPosition, const uint8_t xbm[], uint8_t width, uint8_t height, uint8_t screenOrientation);
+void OLED_draw_packed(uint8_t xPosition, uint8_t yPosition, const uint8_t packed[], uint8_t screenOrientation);
 void OLED_screen_off();
 void OLED_screen_on();
 void OLED_invert_buffer();
@@ -89,10 +260,18 @@ void OLED_clear_pixel(uint8_t xCoordinate, uint8_t yCoordinate);
 void OLED_invert_horizontal(uint8_t yTop, uint8_t yBottom);
 void OLED_invert_vertical(uint8_t xLeft, uint8_t xRight);
 void OLED_invert_rectangle(uint8_t xLeft, uint8_t xRight, uint8_t yTop, uint8_t yBottom);
-void OLED_draw_horizontal_line(uint8_t xStart, uint8_t xEnd, uint8_t yPosition);
-void OLED_draw_vertical_line(uint8_t yStart, uint8_t yEnd, uint8_t xPosition);
-void OLED_draw_rectangle(uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t filled);
-void OLED_draw_circle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t filled);
+void OLED_clear_rectangle(uint8_t xLeft, uint8_t xRight, uint8_t yTop, uint8_t yBottom);
+void OLED_draw_background(const uint8_t background[]);
+void OLED_restore_background(const uint8_t background[], uint8_t xLeft, uint8_t xRight, uint8_t yTop, uint8_t yBottom);
+void OLED_set_clip(uint8_t xLeft, uint8_t xRight, uint8_t yTop, uint8_t yBottom);
+void OLED_reset_clip();
+void OLED_set_canvas(uint8_t screenOrientation);
+uint8_t OLED_get_canvas();
+void OLED_draw_horizontal_line(uint8_t xStart, uint8_t xEnd, uint8_t yPosition, uint8_t drawMode);
+void OLED_draw_vertical_line(uint8_t yStart, uint8_t yEnd, uint8_t xPosition, uint8_t drawMode);
+void OLED_draw_rectangle(uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t filled, uint8_t drawMode);
+void OLED_draw_circle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t filled, uint8_t drawMode);
 void OLED_display_invert(uint8_t invert);
+void OLED_scroll_to(uint8_t line);
 
 #endif /* SH1106_H_ */
\ No newline at end of file
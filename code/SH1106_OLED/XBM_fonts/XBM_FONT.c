@@ -0,0 +1,28 @@
+/*
+ **************************************************************
+ * XBM_FONT.c
+ * Data shared by the XBM font descriptors.
+ **************************************************************
+*/
+
+#include <avr/pgmspace.h>
+#include "XBM_FONT.h"
+
+#define NONE FONT_NO_GLYPH
+
+/* 
+Glyph index of each character from '!' to 'z' in the text fonts. The glyphs are stored as
+A-Z, a-z, 0-9 and then the punctuation.
+*/
+const uint8_t FONT_TEXT_REMAP[] PROGMEM =
+{
+	62, 63, 64, 65, 66, NONE, 67, 68, 69, NONE,	/* '!' - '*' */
+	70, 71, 72, 73, 74, 52, 53, 54, 55, 56,		/* '+' - '4' */
+	57, 58, 59, 60, 61, 75, 76, NONE, 77, NONE,	/* '5' - '>' */
+	78, NONE, 0, 1, 2, 3, 4, 5, 6, 7,			/* '?' - 'H' */
+	8, 9, 10, 11, 12, 13, 14, 15, 16, 17,		/* 'I' - 'R' */
+	18, 19, 20, 21, 22, 23, 24, 25, NONE, NONE,	/* 'S' - 92 */
+	NONE, NONE, NONE, NONE, 26, 27, 28, 29, 30, 31,	/* ']' - 'f' */
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41,		/* 'g' - 'p' */
+	42, 43, 44, 45, 46, 47, 48, 49, 50, 51		/* 'q' - 'z' */
+};
@@ -0,0 +1,44 @@
+/*
+ **************************************************************
+ * XBM_FONT.h
+ * Font descriptor used by the SH1106 library to draw strings
+ * with any of the XBM fonts. Each font file provides one of
+ * these in PROGMEM, so a new font only needs its data and a
+ * descriptor. tools/compile_assets.py generates both from a
+ * BDF font. The BDF sources of these fonts are in tools/fonts.
+ **************************************************************
+*/
+
+#ifndef XBM_FONT_H_
+#define XBM_FONT_H_
+
+#include <avr/pgmspace.h>
+
+/* Entry in a remap table for a character that has no glyph in the font */
+#define FONT_NO_GLYPH 0xFF
+
+/* Set in a packedOffsets entry when the glyph is run length encoded rather than bit packed */
+#define FONT_PACKED_RLE 0x8000
+
+typedef struct {
+	uint8_t firstChar;						/* First character in the remap table */
+	uint8_t lastChar;						/* Last character in the remap table */
+	const uint8_t* remap;					/* Glyph index of each character from firstChar to lastChar, 0 = glyphs are in character order */
+	uint8_t firstSymbol;					/* First symbol character above lastChar (eg. degrees symbols), 0 = none */
+	uint8_t lastSymbol;						/* Last symbol character */
+	uint8_t symbolIndex;					/* Glyph index of firstSymbol, the rest follow in order */
+	uint8_t height;							/* Height of every glyph in pixels */
+	uint8_t spaceAdvance;					/* Pixels the cursor moves for a space */
+	const uint8_t* const* glyphs;			/* XBM image of each glyph */
+	const uint8_t* widths;					/* Width of each glyph in pixels */
+	const uint8_t* yOffsets;				/* Pixels each glyph is drawn below the top of the string */
+	const uint8_t* const* rotated;			/* FONT_x_ROTATED table from XBM_FONTS_ROTATED.h, 0 = none */
+	const uint16_t* const* rotatedOffsets;	/* FONT_x_ROTATED_OFFSETS table from XBM_FONTS_ROTATED.h, 0 = none */
+	const uint8_t* packed;					/* FONT_x_PACKED glyphs from XBM_FONTS_PACKED.h, 0 = draw the XBM glyphs */
+	const uint16_t* packedOffsets;			/* Offset of each glyph in packed, FONT_PACKED_RLE set if it is run length encoded */
+} font_t;
+
+/* Remap table for the text fonts (FONT_8 and FONT_16) from '!' to 'z' */
+extern const uint8_t FONT_TEXT_REMAP[] PROGMEM;
+
+#endif /* XBM_FONT_H_ */
@@ -0,0 +1,156 @@
+/*
+ **************************************************************
+ * XBM_FONTS_PACKED.c
+ * Compressed glyphs for the XBM fonts, used by the SH1106
+ * library when OLED_PACKED_FONTS and the option of the font,
+ * eg. OLED_PACKED_FONT_16, are defined, see SH1106.h.
+ * Generated by tools/pack_assets.py, do not edit. Regenerate
+ * after changing an image with:
+ * python3 tools/pack_assets.py --fonts 16 20 25
+ * Total size: 1787 bytes of flash.
+ **************************************************************
+*/
+
+#include <avr/pgmspace.h>
+#include "../SH1106.h"
+#include "XBM_FONTS_PACKED.h"
+
+#if FONT_16_IS_PACKED
+
+const uint8_t FONT_16_PACKED[] PROGMEM =
+{
+	0xe2,0xf1,0x33,0x82,0x42,0x82,0x42,0x82,0x42,0x82,0x42,0x82,0x33,0x92,0x0f,0xe2,
+	0xf0,0x4f,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x56,0x42,0x34,0xe1,0x43,
+	0x62,0x02,0xc2,0xe3,0x31,0x5a,0x4c,0x4c,0x4c,0x5c,0x3a,0x31,0x38,0x23,0x28,0x02,
+	0xf0,0x4f,0x4c,0x4c,0x4c,0x4c,0x5c,0x3a,0xe1,0xc3,0x02,0xf0,0x4f,0x24,0x46,0x24,
+	0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x4c,0x2c,0xf0,0x4f,0x24,0x28,0x24,
+	0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x2e,0x0e,0xc2,0xe3,0x31,0x5a,0x4c,
+	0x26,0x44,0x26,0x44,0x26,0x54,0x25,0x33,0x31,0x74,0x23,0x64,0x02,0xf0,0x2f,0x26,
+	0x2e,0x2e,0x2e,0x2e,0x2e,0xf8,0x2f,0x20,0x4c,0x4c,0x4c,0xfc,0x6f,0x4c,0x4c,0x4c,
+	0x2c,0x2c,0x3e,0x3e,0x4e,0x4c,0x4c,0x4c,0xfb,0x13,0x2e,0xf0,0x2f,0x26,0x4d,0x6b,
+	0x39,0x32,0x37,0x34,0x35,0x36,0x33,0x78,0x4a,0xf0,0x2f,0x2e,0x2e,0x2e,0x2e,0x2e,
+	0x2e,0x2e,0x2e,0xf0,0x6f,0x5d,0x5d,0x4d,0x5e,0x5b,0x49,0x5a,0x59,0x4a,0xfc,0x2f,
+	0xf0,0x5f,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0xfe,0x5f,0xc2,0xe3,0x31,0x5a,0x4c,0x4c,
+	0x4c,0x5c,0x3a,0xe1,0xc3,0x02,0xf0,0x4f,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,
+	0x28,0x34,0x36,0xa5,0x87,0x06,0xa2,0xc5,0x33,0x38,0x22,0x2a,0x22,0x2a,0x22,0x48,
+	0x22,0x98,0x58,0xc1,0x21,0xa2,0x22,0xf0,0x4f,0x24,0x28,0x24,0x28,0x24,0x28,0x24,
+	0x28,0x24,0x38,0x42,0xf8,0x20,0x24,0x08,0x3c,0x30,0x7e,0x70,0xe7,0xe0,0xc3,0xc0,
+	0xc3,0xc0,0xc3,0xc0,0xc3,0xc0,0xc7,0xe1,0x8e,0x7f,0x0c,0x3f,0x20,0x2e,0x2e,0x2e,
+	0xfe,0x4f,0x2e,0x2e,0x2e,0x0e,0xe0,0xf2,0xe0,0xe3,0xe2,0xe2,0xe2,0xd2,0x3f,0xe1,
+	0x02,0x40,0x8c,0x8c,0x6c,0x0f,0xd3,0x83,0x66,0x48,0x88,0xc4,0xc0,0xd4,0x0f,0xc4,
+	0x84,0xa5,0x85,0xb5,0xe5,0xc5,0xf5,0x40,0xfc,0x32,0x4c,0x40,0x98,0x56,0x33,0x34,
+	0x37,0x32,0x69,0x6a,0x39,0x32,0x37,0x34,0x53,0x96,0x48,0x40,0x6c,0x4e,0x3e,0x9e,
+	0x97,0x36,0x4b,0x68,0x4a,0x0c,0x20,0x79,0x88,0x37,0x42,0x36,0x43,0x35,0x44,0x34,
+	0x45,0x33,0x46,0x32,0x87,0x78,0x29,0x86,0xa7,0x35,0x36,0x24,0x28,0x24,0x28,0x24,
+	0x37,0x24,0x36,0x35,0x34,0xb7,0xa6,0xf0,0x2f,0x24,0x28,0x24,0x28,0x24,0x28,0x24,
+	0x28,0x24,0x28,0x34,0x36,0xa5,0x87,0x02,0x86,0xa7,0x35,0x36,0x24,0x28,0x24,0x28,
+	0x24,0x28,0x24,0x28,0x34,0x36,0x35,0x34,0x27,0x24,0x02,0x86,0xa7,0x35,0x36,0x24,
+	0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0xf8,0x4f,0xc0,0x3f,0xe0,0x7f,0x70,0xe3,
+	0x30,0xc3,0x30,0xc3,0x30,0xc3,0x30,0xc3,0x70,0xe3,0xe0,0x73,0xc0,0x33,0x26,0x2e,
+	0xea,0xf1,0x33,0x82,0x42,0x82,0x42,0x82,0x42,0x82,0x62,0x24,0x83,0x33,0x31,0x34,
+	0x53,0x26,0x44,0x26,0x44,0x26,0x44,0x26,0x44,0x26,0xf3,0x13,0x2e,0xf0,0x2f,0x24,
+	0x2e,0x2e,0x2e,0x2e,0x3e,0xbe,0xa6,0xcc,0xff,0xcc,0xff,0x2c,0x3e,0x25,0x37,0x24,
+	0x57,0xb2,0x21,0xa2,0x02,0xf0,0x2f,0x24,0x24,0x28,0x24,0x28,0x24,0x28,0x34,0x27,
+	0x44,0x36,0x62,0x66,0x32,0x46,0x24,0xf0,0x2f,0xc4,0xc4,0x24,0x2e,0x2e,0x3e,0xbe,
+	0xb5,0x34,0x2d,0x2e,0x3e,0xbe,0xa6,0xc4,0xc4,0x24,0x2e,0x2e,0x2e,0x2e,0x3e,0xbe,
+	0xa6,0x86,0xa7,0x35,0x36,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x34,0x36,0xa5,
+	0x87,0x02,0xf0,0x4f,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x34,0x36,0xa5,
+	0x87,0x06,0x82,0xa7,0x35,0x36,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,
+	0xf4,0x2f,0xc4,0xc4,0x36,0x3c,0x3c,0x2d,0x2e,0x2e,0x0a,0xc0,0xc0,0xe0,0xc1,0xf0,
+	0xc3,0x30,0xc3,0x30,0xc3,0x30,0xc3,0x30,0xc3,0x30,0xe7,0x30,0x7e,0x30,0x3c,0x24,
+	0x2e,0xea,0xf2,0x50,0x72,0x43,0x82,0x42,0x82,0x42,0x82,0x02,0xa4,0xb6,0x3e,0x2e,
+	0x2e,0x2e,0x2e,0x2d,0xc5,0xc4,0x44,0x6c,0x5e,0x5d,0x0f,0xe2,0xa2,0x95,0x75,0xa6,
+	0x84,0x84,0x98,0x5e,0x5b,0x39,0x4b,0x59,0x5b,0x4e,0x3e,0x0f,0xb5,0x45,0x79,0x48,
+	0x24,0x28,0x34,0x36,0x35,0x34,0x37,0x32,0x69,0x6a,0x39,0x32,0x37,0x34,0x35,0x36,
+	0x24,0x28,0x40,0x7a,0x29,0x33,0x37,0x34,0x35,0x96,0x87,0x37,0x3c,0x5a,0x4b,0x0c,
+	0x30,0xf0,0x30,0xf8,0x30,0xdc,0x30,0xce,0x30,0xc7,0xb0,0xc3,0xf0,0xc1,0xf0,0xc0,
+	0xc2,0xe3,0x31,0x35,0x52,0x35,0x44,0x34,0x45,0x33,0x46,0x32,0x87,0x37,0xe1,0xc3,
+	0x02,0x2e,0x23,0x29,0x32,0x29,0x31,0xfa,0x4f,0x2e,0x2e,0x2e,0x2e,0x0c,0xf0,0x0e,
+	0xf8,0x07,0xdc,0x03,0xce,0x03,0xc7,0x83,0xc3,0xc3,0xc1,0xe7,0xc0,0x7e,0xc0,0x3c,
+	0xc0,0x22,0x28,0x33,0x38,0x31,0x5a,0x4c,0x24,0x46,0x24,0x46,0x24,0x56,0x42,0x34,
+	0xe1,0x43,0x62,0x02,0x46,0x5b,0x3a,0x21,0x39,0x22,0x38,0x23,0x37,0x24,0xf6,0x2f,
+	0x28,0x2e,0x06,0xff,0x3c,0xff,0x7c,0xc3,0xe0,0xc3,0xc0,0xc3,0xc0,0xc3,0xc0,0xc3,
+	0xc0,0xc3,0xe1,0x83,0x7f,0x03,0x3f,0xfc,0x3f,0xfe,0x7f,0xc7,0xe1,0xc3,0xc0,0xc3,
+	0xc0,0xc3,0xc0,0xc3,0xc0,0xc7,0xe1,0x8e,0x7f,0x0c,0x3f,0x20,0x2e,0x2e,0xa6,0xb5,
+	0x34,0x27,0x33,0x28,0x32,0x29,0x31,0x5a,0x4b,0x0c,0x3c,0x3f,0xfe,0x7f,0xe7,0xe1,
+	0xc3,0xc0,0xc3,0xc0,0xc3,0xc0,0xc3,0xc0,0xe7,0xe1,0xfe,0x7f,0x3c,0x3f,0x3c,0x30,
+	0x7e,0x70,0xe7,0xe0,0xc3,0xc0,0xc3,0xc0,0xc3,0xc0,0xc3,0xc0,0xc3,0xe0,0xfe,0x7f,
+	0xfc,0x3f,0xc0,0xe2,0x22,0x60,0x6a,0xff,0x6c,0x6a,0x0a,0x24,0x24,0x28,0x24,0xe5,
+	0xe2,0x25,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0xe5,0xe2,0x25,0x24,0x28,0x24,0x04,
+	0x30,0x0c,0x78,0x1c,0xcc,0x38,0xcc,0x30,0xff,0xff,0xff,0xff,0x8c,0x33,0x1c,0x32,
+	0x38,0x1e,0x30,0x0c,0x30,0x6a,0x88,0x56,0x59,0x59,0x59,0x59,0x4a,0x59,0x3b,0x3d,
+	0x60,0x6a,0x0a,0x84,0xa7,0x35,0x36,0x33,0x38,0x31,0x5a,0x2c,0x20,0x5c,0x3a,0x31,
+	0x38,0x33,0x36,0xa5,0x87,0x04,0x28,0x2e,0x2e,0x2e,0xaa,0xa6,0x2a,0x2e,0x2e,0x2e,
+	0x06,0x4c,0x4c,0x28,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x06,0x2d,0x4d,
+	0x4c,0x2d,0x01,0x3d,0x5b,0x59,0x59,0x59,0x59,0x68,0x4a,0x0c,0x18,0x18,0x3c,0x3c,
+	0x3c,0x3c,0x18,0x18,0x18,0xf8,0x3c,0xfc,0x3c,0xfc,0x18,0xf8,0x30,0x0c,0x30,0x0c,
+	0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,0x30,0x0c,
+	0x42,0x5b,0x3a,0x2d,0x2b,0x21,0x36,0x61,0x36,0x61,0x25,0x24,0x31,0x33,0x78,0x6a,
+	0x08,0x42,0x2b,0x22,0x29,0x24,0x18,0x16,0x18,0x16,0x28,0x24,0x29,0x22,0x4b,0xff,
+	0xce,0xe3,0x31,0x5a,0x4c,0x4c,0x4c,0x5c,0x3a,0x31,0x38,0x23,0x28,0x02,0x42,0x6b,
+	0x39,0x32,0x28,0x24,0x28,0x24,0x38,0x32,0x69,0x4b,0xff,0xfc,0x4f,0x24,0x28,0x24,
+	0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x2e,0x0e,
+};
+
+const uint16_t FONT_16_PACKED_OFFSETS[] PROGMEM =
+{
+	0x8000, 0x8010, 0x8022, 0x8030, 0x803b, 0x804b, 0x805b, 0x806d, 0x8077, 0x8081, 0x808b, 0x8099, 0x80a3, 0x80b0, 0x80ba, 0x80c6, 0x80d6, 0x80e7, 0x00f8, 0x810c, 0x8116, 0x8121, 0x812c, 0x813b, 0x814b, 0x8156, 0x8167, 0x8177, 0x8188, 0x819b, 0x01aa, 0x81be, 0x81ca, 0x81dd, 0x01e7, 0x81eb, 0x81f5, 0x8207, 0x8209, 0x8217, 0x8221, 0x8232, 0x8242, 0x8252, 0x025b, 0x826f, 0x827c, 0x8286, 0x8291, 0x82a0, 0x82b2, 0x02c0, 0x82d0, 0x82e1, 0x02ed, 0x8301, 0x8314, 0x0323, 0x0337, 0x834b, 0x035a, 0x036e, 0x8382, 0x8385, 0x838b, 0x03a0, 0x83b4, 0x83c0, 0x83c3, 0x83cc, 0x83d6, 0x83e1, 0x83e3, 0x83ee, 0x83f3, 0x03fc, 0x0404, 0x040c, 0x8420, 0x8431, 0x844e
+};
+
+#endif /* FONT_16_IS_PACKED */
+
+#if FONT_20_IS_PACKED
+
+const uint8_t FONT_20_PACKED[] PROGMEM =
+{
+	0xf2,0x31,0x3f,0x31,0x37,0x54,0x37,0x46,0x36,0x47,0x35,0x48,0x34,0x49,0x33,0x4a,
+	0x32,0x8b,0x3b,0xf1,0x33,0x1f,0x02,0x3f,0x42,0xc2,0x32,0xc3,0x22,0xd3,0x12,0xe3,
+	0xff,0xfc,0x23,0x3f,0xf2,0x23,0x3f,0xf2,0x23,0x32,0x5a,0x41,0x99,0x3a,0x42,0x3a,
+	0x43,0x39,0x44,0x38,0x45,0x37,0x46,0x36,0x47,0x35,0x58,0x33,0x29,0x71,0x2a,0x52,
+	0x2b,0x32,0x3a,0x43,0x4a,0x31,0x5e,0x1f,0x64,0x82,0x64,0x82,0x64,0x82,0x64,0x82,
+	0x64,0x82,0x45,0x64,0x13,0x3f,0x63,0x82,0x02,0x67,0x7d,0x3c,0x23,0x3b,0x24,0x3a,
+	0x25,0x39,0x26,0x38,0x27,0xf7,0xaf,0x2b,0x3f,0xf2,0x23,0x07,0x90,0x45,0x92,0x55,
+	0x21,0x25,0x58,0x25,0x49,0x25,0x49,0x25,0x49,0x25,0x49,0x25,0x49,0x25,0x49,0x35,
+	0x57,0xb6,0x21,0x97,0x02,0xf2,0x31,0x3f,0x31,0x34,0x57,0x25,0x49,0x25,0x49,0x25,
+	0x49,0x25,0x49,0x25,0x49,0x25,0x59,0x34,0x37,0x31,0xb4,0x23,0x95,0x02,0x20,0x3f,
+	0xf2,0x23,0x3f,0x82,0x7c,0x6d,0x93,0x52,0xa3,0x42,0xb3,0x32,0xc3,0x22,0xd3,0xe6,
+	0xf5,0x52,0x92,0xf3,0x13,0x33,0x74,0x55,0x92,0x54,0x92,0x54,0x92,0x54,0x92,0x54,
+	0x92,0x54,0x92,0x35,0x74,0x13,0x3f,0x53,0x92,0x02,0x52,0x29,0x73,0x38,0x31,0x33,
+	0x58,0x25,0x49,0x25,0x49,0x25,0x49,0x25,0x49,0x25,0x49,0x25,0x59,0x33,0x38,0xf1,
+	0x33,0x1f,0x02,
+};
+
+const uint16_t FONT_20_PACKED_OFFSETS[] PROGMEM =
+{
+	0x8000, 0x8017, 0x8029, 0x8041, 0x8059, 0x806c, 0x8085, 0x809e, 0x80b1, 0x80ca
+};
+
+#endif /* FONT_20_IS_PACKED */
+
+#if FONT_25_IS_PACKED
+
+const uint8_t FONT_25_PACKED[] PROGMEM =
+{
+	0xf2,0x36,0x8f,0xf1,0x7e,0x73,0x77,0x93,0x66,0xa3,0x56,0xb3,0x46,0xc3,0x27,0xc3,
+	0xef,0xf1,0x38,0x6f,0x02,0x7f,0x43,0xf2,0x31,0x33,0x1f,0x23,0xf3,0x32,0x31,0x3f,
+	0xff,0xff,0x3f,0x7f,0xf3,0x37,0x7f,0xf3,0x37,0x32,0x9b,0x41,0xfa,0x90,0xae,0x54,
+	0x96,0x64,0x86,0x74,0x76,0x84,0x66,0x94,0x47,0xa4,0xbe,0x13,0xc9,0x23,0xd7,0x03,
+	0x42,0x4d,0x53,0x5d,0x61,0xad,0x2f,0x67,0xa3,0x66,0xa3,0x66,0xa3,0x66,0xa3,0x47,
+	0x85,0xef,0xf1,0x38,0x37,0x2b,0x85,0x1f,0xf9,0xa0,0x4e,0x34,0x4d,0x35,0x4c,0x36,
+	0x4c,0x36,0xfc,0xff,0xff,0xa0,0xf3,0x37,0x0c,0xc0,0x47,0xc2,0x57,0xc1,0x97,0x36,
+	0x79,0x36,0x6a,0x36,0x6a,0x36,0x6a,0x36,0x6a,0x36,0x79,0xf6,0x74,0x1e,0x83,0x2c,
+	0xf2,0x36,0x8f,0xf1,0x5e,0x93,0x67,0xa3,0x66,0xa3,0x66,0xa3,0x66,0xa3,0x57,0x93,
+	0x3a,0x1f,0x51,0xe4,0x43,0xc5,0x02,0x30,0x7f,0xf3,0x37,0xfa,0x90,0x1f,0xf7,0x63,
+	0xc4,0x53,0xd4,0x43,0xe4,0x33,0xf4,0x90,0x1f,0xf8,0x72,0x3f,0x72,0xb3,0x93,0xd1,
+	0xf1,0x4e,0x85,0x67,0xa3,0x66,0xa3,0x66,0xa3,0x66,0xa3,0x47,0x85,0xef,0x91,0xd1,
+	0x73,0xb3,0x02,0x72,0x2f,0xf9,0xb0,0x4e,0x43,0x3e,0x35,0x3e,0x35,0x3e,0x35,0x3e,
+	0x35,0x3e,0x35,0xfe,0x1a,0x9f,0xf2,0x08,0x35,0x39,0x59,0x57,0x58,0x57,0x39,0x39,
+	0x05,
+};
+
+const uint16_t FONT_25_PACKED_OFFSETS[] PROGMEM =
+{
+	0x8000, 0x8015, 0x8029, 0x8040, 0x8056, 0x8069, 0x8080, 0x8097, 0x80ac, 0x80c3, 0x80d8
+};
+
+#endif /* FONT_25_IS_PACKED */
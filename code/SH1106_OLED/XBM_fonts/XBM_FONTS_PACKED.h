@@ -0,0 +1,46 @@
+/*
+ **************************************************************
+ * XBM_FONTS_PACKED.h
+ * Compressed glyphs for the XBM fonts, used by the SH1106
+ * library when OLED_PACKED_FONTS and the option of the font,
+ * eg. OLED_PACKED_FONT_16, are defined, see SH1106.h.
+ * Generated by tools/pack_assets.py, do not edit. Regenerate
+ * after changing an image with:
+ * python3 tools/pack_assets.py --fonts 16 20 25
+ * Total size: 1787 bytes of flash.
+ **************************************************************
+*/
+
+#ifndef XBM_FONTS_PACKED_H_
+#define XBM_FONTS_PACKED_H_
+
+/* The font options, the fonts include this before SH1106.h */
+#include "../SH1106.h"
+
+#define FONT_8_IS_PACKED	0	/* 1 = glyphs in FONT_8_PACKED, 0 = XBM glyphs */
+
+#if defined(OLED_PACKED_FONTS) && defined(OLED_PACKED_FONT_16)
+#define FONT_16_IS_PACKED	1	/* 1 = glyphs in FONT_16_PACKED, 0 = XBM glyphs */
+#else
+#define FONT_16_IS_PACKED	0
+#endif
+extern const uint8_t FONT_16_PACKED[] PROGMEM;
+extern const uint16_t FONT_16_PACKED_OFFSETS[] PROGMEM;
+
+#if defined(OLED_PACKED_FONTS) && defined(OLED_PACKED_FONT_20)
+#define FONT_20_IS_PACKED	1	/* 1 = glyphs in FONT_20_PACKED, 0 = XBM glyphs */
+#else
+#define FONT_20_IS_PACKED	0
+#endif
+extern const uint8_t FONT_20_PACKED[] PROGMEM;
+extern const uint16_t FONT_20_PACKED_OFFSETS[] PROGMEM;
+
+#if defined(OLED_PACKED_FONTS) && defined(OLED_PACKED_FONT_25)
+#define FONT_25_IS_PACKED	1	/* 1 = glyphs in FONT_25_PACKED, 0 = XBM glyphs */
+#else
+#define FONT_25_IS_PACKED	0
+#endif
+extern const uint8_t FONT_25_PACKED[] PROGMEM;
+extern const uint16_t FONT_25_PACKED_OFFSETS[] PROGMEM;
+
+#endif /* XBM_FONTS_PACKED_H_ */
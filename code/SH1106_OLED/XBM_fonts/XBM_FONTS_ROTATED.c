@@ -0,0 +1,495 @@
+/*
+ **************************************************************
+ * XBM_FONTS_ROTATED.c
+ * Pre-rotated, page-packed glyphs for the XBM fonts, used by
+ * the SH1106 library when OLED_PRE_ROTATED_FONTS is defined.
+ * Generated by tools/rotate_fonts.py, do not edit. Regenerate
+ * after changing a font with:
+ * python3 tools/rotate_fonts.py --orientations 8:1,2,3 16:0,1 20: 25:0
+ * Total size: 6923 bytes of flash.
+ **************************************************************
+*/
+
+#include <avr/pgmspace.h>
+#include "../SH1106.h"
+#include "XBM_FONTS_ROTATED.h"
+
+#ifdef OLED_PRE_ROTATED_FONTS
+
+const uint8_t FONT_8_ROTATED_1[] PROGMEM =
+{
+	0x11,0x11,0x11,0x11,0x1f,0x11,0x11,0x0e,0x0f,0x11,0x11,0x11,0x0f,0x11,0x11,0x0f,
+	0x0e,0x11,0x01,0x01,0x01,0x01,0x11,0x0e,0x0f,0x11,0x11,0x11,0x11,0x11,0x11,0x0f,
+	0x1f,0x01,0x01,0x01,0x0f,0x01,0x01,0x1f,0x01,0x01,0x01,0x01,0x0f,0x01,0x01,0x1f,
+	0x0e,0x11,0x11,0x1d,0x01,0x01,0x11,0x0e,0x11,0x11,0x11,0x11,0x1f,0x11,0x11,0x11,
+	0x1f,0x04,0x04,0x04,0x04,0x04,0x04,0x1f,0x0e,0x11,0x10,0x10,0x10,0x10,0x10,0x1c,
+	0x11,0x11,0x09,0x05,0x03,0x05,0x09,0x11,0x1f,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x41,0x41,0x49,0x49,0x55,0x55,0x63,0x63,0x31,0x31,0x29,0x29,0x25,0x25,0x23,0x23,
+	0x0e,0x11,0x11,0x11,0x11,0x11,0x11,0x0e,0x01,0x01,0x0f,0x11,0x11,0x11,0x11,0x0f,
+	0x18,0x0e,0x11,0x11,0x11,0x11,0x11,0x0e,0x11,0x11,0x11,0x11,0x0f,0x11,0x11,0x0f,
+	0x0e,0x11,0x10,0x10,0x0e,0x01,0x11,0x0e,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x1f,
+	0x0e,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x04,0x04,0x0a,0x0a,0x0a,0x11,0x11,0x11,
+	0x22,0x22,0x55,0x55,0x49,0x49,0x41,0x41,0x11,0x11,0x0a,0x04,0x04,0x0a,0x11,0x11,
+	0x04,0x04,0x04,0x04,0x0a,0x0a,0x11,0x11,0x1f,0x01,0x02,0x04,0x04,0x08,0x10,0x1f,
+	0x16,0x19,0x11,0x11,0x11,0x0e,0x00,0x00,0x0f,0x11,0x11,0x11,0x11,0x0f,0x01,0x01,
+	0x0e,0x11,0x01,0x01,0x11,0x0e,0x00,0x00,0x1e,0x11,0x11,0x11,0x11,0x1e,0x10,0x10,
+	0x0e,0x11,0x01,0x1f,0x11,0x0e,0x00,0x00,0x02,0x02,0x02,0x02,0x0f,0x02,0x02,0x0c,
+	0x0e,0x11,0x10,0x1e,0x11,0x11,0x11,0x1e,0x11,0x11,0x11,0x11,0x11,0x0f,0x01,0x01,
+	0x01,0x01,0x01,0x01,0x01,0x00,0x01,0x00,0x02,0x05,0x04,0x04,0x04,0x06,0x00,0x04,
+	0x11,0x09,0x0f,0x11,0x11,0x0f,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x49,0x49,0x49,0x49,0x49,0x37,0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x0f,0x00,0x00,
+	0x0e,0x11,0x11,0x11,0x11,0x0e,0x00,0x00,0x01,0x01,0x0f,0x11,0x11,0x11,0x11,0x0f,
+	0x10,0x10,0x1e,0x11,0x11,0x11,0x11,0x1e,0x01,0x01,0x01,0x01,0x03,0x0d,0x00,0x00,
+	0x0f,0x10,0x10,0x0e,0x01,0x1e,0x00,0x00,0x0c,0x02,0x02,0x02,0x02,0x0f,0x02,0x02,
+	0x1e,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x04,0x04,0x0a,0x0a,0x11,0x11,0x00,0x00,
+	0x22,0x22,0x55,0x55,0x49,0x49,0x00,0x00,0x11,0x0a,0x04,0x04,0x0a,0x11,0x00,0x00,
+	0x02,0x02,0x04,0x04,0x0a,0x0a,0x11,0x11,0x0f,0x01,0x02,0x04,0x08,0x0f,0x00,0x00,
+	0x0e,0x11,0x11,0x13,0x15,0x19,0x11,0x0e,0x1f,0x04,0x04,0x04,0x04,0x05,0x06,0x04,
+	0x1f,0x01,0x02,0x04,0x08,0x10,0x11,0x0e,0x0e,0x11,0x10,0x10,0x0c,0x10,0x11,0x0e,
+	0x08,0x08,0x08,0x1f,0x09,0x0a,0x0c,0x08,0x0e,0x11,0x11,0x10,0x0f,0x01,0x01,0x1f,
+	0x0e,0x11,0x11,0x11,0x0f,0x01,0x11,0x0e,0x02,0x02,0x02,0x02,0x04,0x08,0x10,0x1f,
+	0x0e,0x11,0x11,0x11,0x0e,0x11,0x11,0x0e,0x0e,0x11,0x10,0x10,0x1e,0x11,0x11,0x0e,
+	0x01,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x05,0x05,
+	0x00,0x12,0x3f,0x12,0x12,0x3f,0x12,0x00,0x04,0x0e,0x15,0x0c,0x06,0x15,0x0e,0x04,
+	0x19,0x1a,0x02,0x04,0x08,0x0b,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,
+	0x04,0x02,0x01,0x01,0x01,0x01,0x02,0x04,0x01,0x02,0x04,0x04,0x04,0x04,0x02,0x01,
+	0x00,0x04,0x04,0x1f,0x04,0x04,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x01,0x01,0x02,0x02,0x04,0x04,0x08,0x08,0x00,0x03,0x03,0x00,0x00,0x03,0x03,0x00,
+	0x03,0x03,0x03,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x1f,0x00,0x00,0x1f,0x00,0x00,
+	0x04,0x00,0x04,0x0c,0x10,0x11,0x11,0x0e,0xc0,0x20,0x20,0x20,0x26,0x29,0x29,0xc6,
+	0x01,0x02,0x00,0x00,0x00,0x00,0x02,0x01,0x20,0x20,0x20,0x20,0xe6,0x29,0x29,0xe6,
+	0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x03,
+};
+
+const uint16_t FONT_8_ROTATED_1_OFFSETS[] PROGMEM =
+{
+	0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120, 128, 136, 144, 152, 160, 168, 176, 184, 192, 200, 208, 216, 224, 232, 240, 248, 256, 264, 272, 280, 288, 296, 304, 312, 320, 328, 336, 344, 352, 360, 368, 376, 384, 392, 400, 408, 416, 424, 432, 440, 448, 456, 464, 472, 480, 488, 496, 504, 512, 520, 528, 536, 544, 552, 560, 568, 576, 584, 592, 600, 608, 616, 624, 632, 648
+};
+
+const uint8_t FONT_8_ROTATED_2[] PROGMEM =
+{
+	0x7f,0x90,0x90,0x90,0x7f,0x6e,0x91,0x91,0x91,0xff,0x42,0x81,0x81,0x81,0x7e,0x7e,
+	0x81,0x81,0x81,0xff,0x81,0x91,0x91,0x91,0xff,0x80,0x90,0x90,0x90,0xff,0x4e,0x89,
+	0x89,0x81,0x7e,0xff,0x10,0x10,0x10,0xff,0x81,0x81,0xff,0x81,0x81,0xfe,0x81,0x81,
+	0x01,0x02,0x83,0x44,0x28,0x10,0xff,0x01,0x01,0x01,0x01,0xff,0xff,0xc0,0x30,0x0c,
+	0x30,0xc0,0xff,0xff,0x03,0x0c,0x30,0xc0,0xff,0x7e,0x81,0x81,0x81,0x7e,0x78,0x84,
+	0x84,0x84,0xff,0x7d,0x83,0x82,0x82,0x7c,0x6f,0x90,0x90,0x90,0xff,0x4e,0x91,0x91,
+	0x91,0x62,0x80,0x80,0xff,0x80,0x80,0xfe,0x01,0x01,0x01,0xfe,0xe0,0x1c,0x03,0x1c,
+	0xe0,0xfc,0x03,0x0c,0x30,0x0c,0x03,0xfc,0xc3,0x24,0x18,0x24,0xc3,0xc0,0x30,0x0f,
+	0x30,0xc0,0xc1,0xa1,0x99,0x85,0x83,0x1f,0x22,0x21,0x21,0x1e,0x1e,0x21,0x21,0x21,
+	0xff,0x12,0x21,0x21,0x21,0x1e,0xff,0x21,0x21,0x21,0x1e,0x1a,0x29,0x29,0x29,0x1e,
+	0x90,0x90,0x7f,0x10,0xfe,0x89,0x89,0x89,0x72,0x1f,0x20,0x20,0x20,0xff,0x5f,0xbe,
+	0x21,0x02,0x19,0x26,0x24,0x24,0xff,0xff,0x1f,0x20,0x20,0x1f,0x20,0x20,0x3f,0x1f,
+	0x20,0x20,0x20,0x3f,0x1e,0x21,0x21,0x21,0x1e,0x78,0x84,0x84,0x84,0xff,0xff,0x84,
+	0x84,0x84,0x78,0x20,0x20,0x10,0x3f,0x26,0x29,0x29,0x29,0x11,0x21,0x21,0xfe,0x20,
+	0x3f,0x01,0x01,0x01,0x3e,0x30,0x0c,0x03,0x0c,0x30,0x3c,0x03,0x0c,0x30,0x0c,0x03,
+	0x3c,0x21,0x12,0x0c,0x12,0x21,0xc0,0x30,0x0c,0x33,0xc0,0x31,0x29,0x25,0x23,0x7e,
+	0xa1,0x91,0x89,0x7e,0x01,0x01,0xff,0x41,0x21,0x61,0x91,0x89,0x85,0x43,0x6e,0x91,
+	0x91,0x81,0x42,0x08,0xff,0x48,0x28,0x18,0x8e,0x91,0x91,0x91,0xf6,0x4e,0x91,0x91,
+	0x91,0x7e,0xc0,0xa0,0x90,0x8f,0x80,0x6e,0x91,0x91,0x91,0x6e,0x7e,0x91,0x91,0x91,
+	0x62,0xfd,0xe0,0x00,0xe0,0x24,0x7e,0x24,0x24,0x7e,0x24,0x24,0x4a,0xff,0x52,0x24,
+	0x43,0x33,0x08,0x66,0x61,0xe0,0x81,0x42,0x3c,0x3c,0x42,0x81,0x08,0x08,0x3e,0x08,
+	0x08,0x03,0x08,0x08,0x08,0x08,0x08,0x03,0x03,0xc0,0x30,0x0c,0x03,0x66,0x66,0x67,
+	0x67,0x24,0x24,0x24,0x24,0x24,0x70,0x88,0x8d,0x80,0x60,0x42,0x81,0x81,0x81,0x7e,
+	0x00,0x60,0x90,0x90,0x60,0x80,0x90,0x90,0x90,0xff,0x00,0x60,0x90,0x90,0x60,
+};
+
+const uint16_t FONT_8_ROTATED_2_OFFSETS[] PROGMEM =
+{
+	0, 5, 10, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 67, 73, 78, 83, 88, 93, 98, 103, 108, 113, 120, 125, 130, 135, 140, 145, 150, 155, 160, 164, 169, 174, 175, 178, 183, 184, 191, 196, 201, 206, 211, 215, 220, 224, 229, 234, 241, 246, 251, 255, 260, 265, 270, 275, 280, 285, 290, 295, 300, 305, 306, 309, 315, 320, 325, 326, 329, 332, 337, 338, 343, 345, 349, 351, 353, 358, 363, 373
+};
+
+const uint8_t FONT_8_ROTATED_3[] PROGMEM =
+{
+	0x0e,0x11,0x11,0x1f,0x11,0x11,0x11,0x11,0x1e,0x11,0x11,0x1e,0x11,0x11,0x11,0x1e,
+	0x0e,0x11,0x10,0x10,0x10,0x10,0x11,0x0e,0x1e,0x11,0x11,0x11,0x11,0x11,0x11,0x1e,
+	0x1f,0x10,0x10,0x1e,0x10,0x10,0x10,0x1f,0x1f,0x10,0x10,0x1e,0x10,0x10,0x10,0x10,
+	0x0e,0x11,0x10,0x10,0x17,0x11,0x11,0x0e,0x11,0x11,0x11,0x1f,0x11,0x11,0x11,0x11,
+	0x1f,0x04,0x04,0x04,0x04,0x04,0x04,0x1f,0x07,0x01,0x01,0x01,0x01,0x01,0x11,0x0e,
+	0x11,0x12,0x14,0x18,0x14,0x12,0x11,0x11,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1f,
+	0x63,0x63,0x55,0x55,0x49,0x49,0x41,0x41,0x31,0x31,0x29,0x29,0x25,0x25,0x23,0x23,
+	0x0e,0x11,0x11,0x11,0x11,0x11,0x11,0x0e,0x1e,0x11,0x11,0x11,0x11,0x1e,0x10,0x10,
+	0x0e,0x11,0x11,0x11,0x11,0x11,0x0e,0x03,0x1e,0x11,0x11,0x1e,0x11,0x11,0x11,0x11,
+	0x0e,0x11,0x10,0x0e,0x01,0x01,0x11,0x0e,0x1f,0x04,0x04,0x04,0x04,0x04,0x04,0x04,
+	0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x0e,0x11,0x11,0x11,0x0a,0x0a,0x0a,0x04,0x04,
+	0x41,0x41,0x49,0x49,0x55,0x55,0x22,0x22,0x11,0x11,0x0a,0x04,0x04,0x0a,0x11,0x11,
+	0x11,0x11,0x0a,0x0a,0x04,0x04,0x04,0x04,0x1f,0x01,0x02,0x04,0x04,0x08,0x10,0x1f,
+	0x00,0x00,0x0e,0x11,0x11,0x11,0x13,0x0d,0x10,0x10,0x1e,0x11,0x11,0x11,0x11,0x1e,
+	0x00,0x00,0x0e,0x11,0x10,0x10,0x11,0x0e,0x01,0x01,0x0f,0x11,0x11,0x11,0x11,0x0f,
+	0x00,0x00,0x0e,0x11,0x1f,0x10,0x11,0x0e,0x03,0x04,0x04,0x0f,0x04,0x04,0x04,0x04,
+	0x0f,0x11,0x11,0x11,0x0f,0x01,0x11,0x0e,0x10,0x10,0x1e,0x11,0x11,0x11,0x11,0x11,
+	0x00,0x01,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x03,0x01,0x01,0x01,0x05,0x02,
+	0x10,0x10,0x1e,0x11,0x11,0x1e,0x12,0x11,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x00,0x00,0x76,0x49,0x49,0x49,0x49,0x49,0x00,0x00,0x1e,0x11,0x11,0x11,0x11,0x11,
+	0x00,0x00,0x0e,0x11,0x11,0x11,0x11,0x0e,0x1e,0x11,0x11,0x11,0x11,0x1e,0x10,0x10,
+	0x0f,0x11,0x11,0x11,0x11,0x0f,0x01,0x01,0x00,0x00,0x0b,0x0c,0x08,0x08,0x08,0x08,
+	0x00,0x00,0x0f,0x10,0x0e,0x01,0x01,0x1e,0x04,0x04,0x0f,0x04,0x04,0x04,0x04,0x03,
+	0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x0f,0x00,0x00,0x11,0x11,0x0a,0x0a,0x04,0x04,
+	0x00,0x00,0x49,0x49,0x55,0x55,0x22,0x22,0x00,0x00,0x11,0x0a,0x04,0x04,0x0a,0x11,
+	0x11,0x11,0x0a,0x0a,0x04,0x04,0x08,0x08,0x00,0x00,0x0f,0x01,0x02,0x04,0x08,0x0f,
+	0x0e,0x11,0x13,0x15,0x19,0x11,0x11,0x0e,0x04,0x0c,0x14,0x04,0x04,0x04,0x04,0x1f,
+	0x0e,0x11,0x01,0x02,0x04,0x08,0x10,0x1f,0x0e,0x11,0x01,0x06,0x01,0x01,0x11,0x0e,
+	0x02,0x06,0x0a,0x12,0x1f,0x02,0x02,0x02,0x1f,0x10,0x10,0x1e,0x01,0x11,0x11,0x0e,
+	0x0e,0x11,0x10,0x1e,0x11,0x11,0x11,0x0e,0x1f,0x01,0x02,0x04,0x08,0x08,0x08,0x08,
+	0x0e,0x11,0x11,0x0e,0x11,0x11,0x11,0x0e,0x0e,0x11,0x11,0x0f,0x01,0x01,0x11,0x0e,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x01,0x05,0x05,0x05,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x12,0x3f,0x12,0x12,0x3f,0x12,0x00,0x04,0x0e,0x15,0x0c,0x06,0x15,0x0e,0x04,
+	0x00,0x19,0x1a,0x02,0x04,0x08,0x0b,0x13,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,
+	0x01,0x02,0x04,0x04,0x04,0x04,0x02,0x01,0x04,0x02,0x01,0x01,0x01,0x01,0x02,0x04,
+	0x00,0x00,0x04,0x04,0x1f,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,
+	0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,
+	0x01,0x01,0x02,0x02,0x04,0x04,0x08,0x08,0x00,0x03,0x03,0x00,0x00,0x03,0x03,0x00,
+	0x00,0x03,0x03,0x00,0x00,0x03,0x03,0x03,0x00,0x00,0x1f,0x00,0x00,0x1f,0x00,0x00,
+	0x0e,0x11,0x11,0x01,0x06,0x04,0x00,0x04,0x8e,0x51,0x50,0x90,0x10,0x10,0x11,0x0e,
+	0x01,0x02,0x02,0x01,0x00,0x00,0x00,0x00,0x9f,0x50,0x50,0x9e,0x10,0x10,0x10,0x10,
+	0x01,0x02,0x02,0x01,0x00,0x00,0x00,0x00,
+};
+
+const uint16_t FONT_8_ROTATED_3_OFFSETS[] PROGMEM =
+{
+	0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120, 128, 136, 144, 152, 160, 168, 176, 184, 192, 200, 208, 216, 224, 232, 240, 248, 256, 264, 272, 280, 288, 296, 304, 312, 320, 328, 336, 344, 352, 360, 368, 376, 384, 392, 400, 408, 416, 424, 432, 440, 448, 456, 464, 472, 480, 488, 496, 504, 512, 520, 528, 536, 544, 552, 560, 568, 576, 584, 592, 600, 608, 616, 624, 632, 648
+};
+
+const uint8_t* const FONT_8_ROTATED[] PROGMEM =
+{
+	0, FONT_8_ROTATED_1, FONT_8_ROTATED_2, FONT_8_ROTATED_3
+};
+
+const uint16_t* const FONT_8_ROTATED_OFFSETS[] PROGMEM =
+{
+	0, FONT_8_ROTATED_1_OFFSETS, FONT_8_ROTATED_2_OFFSETS, FONT_8_ROTATED_3_OFFSETS
+};
+
+const uint8_t FONT_16_ROTATED_0[] PROGMEM =
+{
+	0xfc,0xfe,0xc7,0xc3,0xc3,0xc3,0xc3,0xc7,0xfe,0xfc,0xff,0xff,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xff,0xff,0xff,0xff,0xc3,0xc3,0xc3,0xc3,0xc3,0xe7,0xfe,0x3c,0xff,0xff,
+	0xc0,0xc0,0xc0,0xc0,0xc0,0xe1,0x7f,0x3f,0xfc,0xfe,0x07,0x03,0x03,0x03,0x03,0x07,
+	0x0e,0x0c,0x3f,0x7f,0xe0,0xc0,0xc0,0xc0,0xc0,0xe0,0x70,0x30,0xff,0xff,0x03,0x03,
+	0x03,0x03,0x03,0x07,0xfe,0xfc,0xff,0xff,0xc0,0xc0,0xc0,0xc0,0xc0,0xe0,0x7f,0x3f,
+	0xff,0xff,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0x03,0x03,0xff,0xff,0xc0,0xc0,0xc0,0xc0,
+	0xc0,0xc0,0xc0,0xc0,0xff,0xff,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0x03,0x03,0xff,0xff,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfe,0x07,0x03,0x03,0x03,0x03,0x07,
+	0x0e,0x0c,0x3f,0x7f,0xe0,0xc0,0xc3,0xc3,0xc3,0xe3,0x7f,0x3f,0xff,0xff,0xc0,0xc0,
+	0xc0,0xc0,0xc0,0xc0,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+	0x03,0x03,0x03,0x03,0xff,0xff,0x03,0x03,0x03,0x03,0xc0,0xc0,0xc0,0xc0,0xff,0xff,
+	0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0xff,0xff,0x30,0x70,
+	0xe0,0xc0,0xc0,0xc0,0xc0,0xe0,0x7f,0x3f,0xff,0xff,0xc0,0xe0,0xf0,0x38,0x1c,0x0e,
+	0x07,0x03,0xff,0xff,0x00,0x01,0x03,0x07,0x0e,0x1c,0xf8,0xf0,0xff,0xff,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+	0xff,0xff,0x0f,0x3e,0xf8,0xe0,0x80,0x80,0xe0,0xf8,0x3e,0x0f,0xff,0xff,0xff,0xff,
+	0x00,0x00,0x00,0x01,0x0f,0x0f,0x01,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x07,0x1e,
+	0x78,0xe0,0x80,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x01,0x07,0x1e,
+	0x78,0xe0,0xff,0xff,0xfc,0xfe,0x07,0x03,0x03,0x03,0x03,0x07,0xfe,0xfc,0x3f,0x7f,
+	0xe0,0xc0,0xc0,0xc0,0xc0,0xe0,0x7f,0x3f,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x07,
+	0xfe,0xfc,0xff,0xff,0x0c,0x0c,0x0c,0x0c,0x0c,0x0e,0x07,0x03,0xfc,0xfe,0x07,0x03,
+	0x03,0x03,0x03,0x07,0xfe,0xfc,0x0f,0x1f,0x38,0x30,0x30,0x3c,0xfc,0xf8,0xdf,0xcf,
+	0xff,0xff,0xc3,0xc3,0xc3,0xc3,0xc3,0xe7,0xfe,0x3c,0xff,0xff,0x00,0x00,0x00,0x00,
+	0x00,0x01,0xff,0xff,0x3c,0x7e,0xe7,0xc3,0xc3,0xc3,0xc3,0xc7,0x8e,0x0c,0x30,0x70,
+	0xe0,0xc0,0xc0,0xc0,0xc0,0xe1,0x7f,0x3f,0x03,0x03,0x03,0x03,0xff,0xff,0x03,0x03,
+	0x03,0x03,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xff,0xff,0x3f,0x7f,0xe0,0xc0,0xc0,0xc0,0xc0,0xe0,0x7f,0x3f,
+	0x0f,0xff,0xf0,0x00,0x00,0x00,0x00,0xf0,0xff,0x0f,0x00,0x00,0x0f,0x3f,0xe0,0xe0,
+	0x3f,0x0f,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x80,0xf0,0xf0,0x80,0x00,0x00,0x00,
+	0xff,0xff,0x0f,0x1f,0xf0,0xf0,0x1f,0x0f,0x01,0x01,0x0f,0x1f,0xf0,0xf0,0x1f,0x0f,
+	0x0f,0x1f,0x38,0x70,0xe0,0xe0,0x70,0x38,0x1f,0x0f,0xf0,0xf8,0x1c,0x0e,0x07,0x07,
+	0x0e,0x1c,0xf8,0xf0,0x0f,0x3f,0xf0,0xc0,0x80,0x80,0xc0,0xf0,0x3f,0x0f,0x00,0x00,
+	0x00,0x01,0xff,0xff,0x01,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x83,0xc3,0xe3,0x73,
+	0x3f,0x1f,0xf8,0xfc,0xce,0xc7,0xc3,0xc1,0xc0,0xc0,0xc0,0xc0,0xc0,0xe0,0x70,0x30,
+	0x30,0x30,0x30,0x70,0xe0,0xc0,0x3f,0x7f,0xe0,0xc0,0xc0,0xe0,0x70,0x38,0xff,0xff,
+	0xff,0xff,0x30,0x30,0x30,0x30,0x30,0x70,0xe0,0xc0,0xff,0xff,0xc0,0xc0,0xc0,0xc0,
+	0xc0,0xe0,0x7f,0x3f,0xc0,0xe0,0x70,0x30,0x30,0x30,0x30,0x70,0xe0,0xc0,0x3f,0x7f,
+	0xe0,0xc0,0xc0,0xc0,0xc0,0xe0,0x70,0x30,0xc0,0xe0,0x70,0x30,0x30,0x30,0x30,0x30,
+	0xff,0xff,0x3f,0x7f,0xe0,0xc0,0xc0,0xc0,0xc0,0xc0,0xff,0xff,0xc0,0xe0,0x70,0x30,
+	0x30,0x30,0x30,0x70,0xe0,0xc0,0x3f,0x7f,0xe3,0xc3,0xc3,0xc3,0xc3,0xe3,0x73,0x33,
+	0xc0,0xc0,0xfc,0xfe,0xc7,0xc3,0xc3,0xc3,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,
+	0xfc,0xfe,0x87,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0x30,0x71,0xe3,0xc3,0xc3,0xc3,
+	0xc3,0xe3,0x7f,0x3f,0xff,0xff,0x30,0x30,0x30,0x30,0x30,0x70,0xe0,0xc0,0xff,0xff,
+	0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xcc,0xcc,0xff,0xff,0x00,0x00,0x30,0x30,
+	0xf3,0xf3,0x30,0x70,0xe0,0xe0,0x7f,0x3f,0xff,0xff,0x30,0x30,0x30,0x30,0x30,0x70,
+	0xe0,0xc0,0xff,0xff,0x0c,0x0c,0x0c,0x1c,0x3c,0x7e,0xe7,0xc3,0xff,0xff,0xff,0xff,
+	0xf0,0xf0,0x30,0x30,0x30,0x70,0xe0,0xe0,0x70,0x30,0x30,0x70,0xe0,0xc0,0xff,0xff,
+	0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xf0,0xf0,0x30,0x30,
+	0x30,0x30,0x30,0x70,0xe0,0xc0,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+	0xc0,0xe0,0x70,0x30,0x30,0x30,0x30,0x70,0xe0,0xc0,0x3f,0x7f,0xe0,0xc0,0xc0,0xc0,
+	0xc0,0xe0,0x7f,0x3f,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x07,0xfe,0xfc,0xff,0xff,
+	0x0c,0x0c,0x0c,0x0c,0x0c,0x0e,0x07,0x03,0xfc,0xfe,0x07,0x03,0x03,0x03,0x03,0x03,
+	0xff,0xff,0x03,0x07,0x0e,0x0c,0x0c,0x0c,0x0c,0x0c,0xff,0xff,0xf0,0xf0,0xc0,0xe0,
+	0x70,0x30,0x30,0x30,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0xc0,0xe0,0xf0,0x30,
+	0x30,0x30,0x30,0x30,0x30,0x30,0xc0,0xc1,0xc3,0xc3,0xc3,0xc3,0xc3,0xe7,0x7e,0x3c,
+	0x30,0x30,0xff,0xff,0x30,0x30,0x30,0x30,0x00,0x00,0x3f,0x7f,0xe0,0xc0,0xc0,0xc0,
+	0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xf0,0x3f,0x7f,0xe0,0xc0,0xc0,0xc0,
+	0xc0,0x60,0xff,0xff,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xf0,0x00,0x03,
+	0x1f,0x7c,0xc0,0xc0,0x7c,0x1f,0x03,0x00,0xf0,0xf0,0x00,0x00,0x00,0x80,0xf0,0xf0,
+	0x80,0x00,0x00,0x00,0xf0,0xf0,0x0f,0x1f,0xf8,0xf8,0x0e,0x07,0x01,0x01,0x07,0x0e,
+	0xf8,0xf8,0x1f,0x0f,0x30,0x70,0xe0,0xc0,0x80,0x80,0xc0,0xe0,0x70,0x30,0xc0,0xe0,
+	0x70,0x39,0x1f,0x1f,0x39,0x70,0xe0,0xc0,0x0f,0x1f,0x38,0x70,0xe0,0xe0,0x70,0x38,
+	0x1f,0x0f,0xc0,0xc0,0xe0,0x70,0x3f,0x1f,0x00,0x00,0x00,0x00,0x30,0x30,0x30,0x30,
+	0x30,0xb0,0xf0,0xf0,0xf0,0xf8,0xdc,0xce,0xc7,0xc3,0xc1,0xc0,0xfc,0xfe,0x07,0x83,
+	0xc3,0xe3,0x73,0x3f,0xfe,0xfc,0x3f,0x7f,0xe7,0xc3,0xc1,0xc0,0xc0,0xe0,0x7f,0x3f,
+	0x00,0x18,0x1c,0x0e,0xff,0xff,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xff,0xff,
+	0xc0,0xc0,0xc0,0xc0,0x0c,0x0e,0x07,0x03,0x03,0x83,0xc3,0xe7,0x7e,0x3c,0xf0,0xf8,
+	0xdc,0xce,0xc7,0xc3,0xc1,0xc0,0xc0,0xc0,0x0c,0x0e,0x07,0x03,0xc3,0xc3,0xc3,0xe7,
+	0xfe,0x3c,0x30,0x70,0xe0,0xc0,0xc0,0xc0,0xc0,0xe1,0x7f,0x3f,0xc0,0xe0,0x70,0x38,
+	0x1c,0x0e,0xff,0xff,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0x03,0x03,
+	0xff,0xff,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0x83,0x03,0x3c,0x7c,0xe0,0xc0,0xc0,0xc0,
+	0xc0,0xe1,0x7f,0x3f,0xfc,0xfe,0xc7,0xc3,0xc3,0xc3,0xc3,0xc7,0x8e,0x0c,0x3f,0x7f,
+	0xe1,0xc0,0xc0,0xc0,0xc0,0xe1,0x7f,0x3f,0x03,0x03,0x03,0x83,0xc3,0xe3,0x73,0x3b,
+	0x1f,0x0f,0x00,0x00,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x3c,0xfe,0xe7,0xc3,
+	0xc3,0xc3,0xc3,0xe7,0xfe,0x3c,0x3f,0x7f,0xe1,0xc0,0xc0,0xc0,0xc0,0xe1,0x7f,0x3f,
+	0x3c,0x7e,0xe7,0xc3,0xc3,0xc3,0xc3,0xc3,0xfe,0xfc,0x30,0x70,0xe0,0xc0,0xc0,0xc0,
+	0xc0,0xe0,0x7f,0x3f,0xff,0xff,0xcf,0xcf,0x3f,0x3f,0x00,0x00,0x3f,0x3f,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x30,0x30,0xfe,0xfe,0x30,0x30,0x30,0x30,0xfe,0xfe,0x30,0x30,
+	0x0c,0x0c,0x7f,0x7f,0x0c,0x0c,0x0c,0x0c,0x7f,0x7f,0x0c,0x0c,0x30,0x78,0xcc,0xcc,
+	0xff,0xff,0x8c,0x1c,0x38,0x30,0x0c,0x1c,0x38,0x30,0xff,0xff,0x33,0x32,0x1e,0x0c,
+	0x07,0x07,0x07,0x80,0xe0,0xf8,0x3e,0x0f,0x03,0x00,0xe0,0xf8,0x3e,0x0f,0x03,0x00,
+	0x00,0xe0,0xe0,0xe0,0x3f,0x3f,0x00,0x00,0xf0,0xf8,0x1c,0x0e,0x07,0x03,0x0f,0x1f,
+	0x38,0x70,0xe0,0xc0,0x03,0x07,0x0e,0x1c,0xf8,0xf0,0xc0,0xe0,0x70,0x38,0x1f,0x0f,
+	0x00,0x00,0x00,0x00,0xf0,0xf0,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x3f,0x3f,
+	0x03,0x03,0x03,0x03,0x00,0x00,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,
+	0x60,0xf0,0xf0,0x60,0x00,0x00,0x00,0x80,0xe0,0xf8,0x3f,0x0f,0xe0,0xf8,0x3e,0x0f,
+	0x03,0x00,0x00,0x00,0x18,0x3c,0x3c,0x18,0x18,0x3c,0x3c,0x18,0x18,0x3c,0x3c,0x18,
+	0xf8,0xfc,0xfc,0xf8,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x0c,0x0c,
+	0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x3c,0x3e,0x07,0x03,0x03,0x03,0x83,0xc7,
+	0xfe,0xfc,0x00,0x00,0x00,0x60,0xf7,0xf7,0x61,0x01,0x00,0x00,0x3c,0x66,0xc3,0x81,
+	0x81,0xc3,0x66,0x3c,0x00,0x00,0xfc,0xfe,0x07,0x03,0x03,0x03,0x03,0x07,0x0e,0x0c,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x7f,0xe0,0xc0,0xc0,0xc0,
+	0xc0,0xe0,0x70,0x30,0x3c,0x7e,0xe7,0xc3,0xc3,0xe7,0x7e,0x3c,0x00,0x00,0xff,0xff,
+	0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint16_t FONT_16_ROTATED_0_OFFSETS[] PROGMEM =
+{
+	0, 20, 40, 60, 80, 100, 120, 140, 160, 180, 200, 220, 240, 268, 292, 312, 332, 352, 372, 392, 412, 432, 452, 480, 500, 520, 540, 560, 580, 600, 620, 640, 656, 676, 696, 700, 712, 732, 736, 764, 784, 804, 824, 844, 860, 880, 896, 916, 936, 964, 984, 1004, 1020, 1040, 1060, 1080, 1100, 1120, 1140, 1160, 1180, 1200, 1220, 1224, 1236, 1260, 1280, 1300, 1304, 1316, 1328, 1348, 1352, 1372, 1380, 1396, 1404, 1412, 1432, 1452, 1492
+};
+
+const uint8_t FONT_16_ROTATED_1[] PROGMEM =
+{
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0x03,0x03,0x03,0x87,0xfe,0xfc,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,
+	0xff,0xff,0x83,0x03,0x03,0x03,0x03,0x83,0xff,0xff,0x83,0x03,0x03,0x83,0xff,0xff,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x01,0x03,0x03,0x03,0x03,0x01,0x00,
+	0xfc,0xfe,0x87,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x87,0xfe,0xfc,
+	0x00,0x01,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x01,0x00,
+	0xff,0xff,0x83,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x83,0xff,0xff,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,
+	0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0x03,0x03,0x03,0x03,0xff,0xff,
+	0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0x03,0x03,0x03,0x03,0xff,0xff,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,
+	0xfc,0xfe,0x87,0x03,0x03,0x03,0xf3,0xf3,0x03,0x03,0x03,0x03,0x03,0x87,0xfe,0xfc,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x03,0x03,0x01,0x00,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0xff,0xff,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0xff,0xff,
+	0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,
+	0xfc,0xfe,0x87,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xf0,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0x03,0x03,0x03,0x83,0xc3,0xe3,0x73,0x3b,0x1f,0x1f,0x3b,0x73,0xe3,0xc3,0x83,0x03,
+	0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,
+	0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x03,0x03,0xc3,0xc3,0xc3,0xe3,0xf3,0x33,0x3b,0x1b,0x1f,0x0f,0x0f,0x07,
+	0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x33,0x33,0x37,0x36,0x3e,0x3c,0x3c,0x38,
+	0x03,0x03,0x03,0x83,0x83,0xc3,0xc3,0x63,0x63,0x33,0x33,0x1b,0x1b,0x0f,0x0f,0x07,
+	0x0e,0x0f,0x0f,0x0d,0x0d,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,
+	0xfc,0xfe,0x87,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x87,0xfe,0xfc,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,
+	0x03,0x03,0x03,0x03,0xff,0xff,0x83,0x03,0x03,0x03,0x03,0x03,0x03,0x83,0xff,0xff,
+	0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,
+	0xc0,0xc0,0xfc,0xfe,0xe7,0x63,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x87,0xfe,0xfc,
+	0x03,0x03,0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x83,0xff,0xff,0x83,0x03,0x03,0x83,0xff,0xff,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x01,0x03,0x03,0x03,0x03,0x01,0x00,
+	0xfc,0xfe,0x87,0x03,0x00,0x00,0x00,0x80,0xfc,0xfe,0x07,0x03,0x03,0x87,0xfe,0xfc,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x03,0x03,0x01,0x00,
+	0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0xff,0xff,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,
+	0xfc,0xfe,0x87,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0x30,0x30,0x78,0x48,0xcc,0xcc,0xcc,0xcc,0x86,0x86,0x86,0x86,0x03,0x03,0x03,0x03,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x03,0x03,0x03,0x03,
+	0x0c,0x0c,0x0c,0x1e,0x33,0x33,0x33,0xf3,0xe3,0xc3,0xc3,0xc3,0x03,0x03,0x03,0x03,
+	0x0c,0x0c,0x0c,0x1e,0x33,0x33,0x33,0x33,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+	0x03,0x03,0x03,0x87,0xce,0xfc,0x78,0x30,0x30,0x78,0xfc,0xce,0x87,0x03,0x03,0x03,
+	0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,
+	0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x78,0xfc,0xcc,0x86,0x86,0x03,0x03,0x03,0x03,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x03,0x03,0x03,0x03,
+	0xff,0xff,0x03,0x03,0x07,0x0e,0x1c,0x38,0x70,0xe0,0xc0,0x80,0x00,0x00,0xff,0xff,
+	0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,0x03,
+	0x3c,0x7e,0xe7,0xc3,0x83,0x03,0x03,0x03,0x03,0x87,0xfe,0xfc,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,
+	0xff,0xff,0x83,0x03,0x03,0x03,0x03,0x03,0x03,0x83,0xff,0xff,0x03,0x03,0x03,0x03,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,
+	0xfc,0xfe,0x87,0x03,0x03,0x03,0x03,0x03,0x03,0x87,0xfe,0xfc,0x00,0x00,0x00,0x00,
+	0x00,0x01,0x03,0x03,0x00,0x00,0x00,0x00,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,
+	0xfc,0xfe,0x07,0x03,0x03,0x03,0x03,0x03,0x03,0x07,0xfe,0xfc,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0xfc,0xfe,0x87,0x03,0x03,0x03,0xff,0xff,0x03,0x87,0xfe,0xfc,0x00,0x00,0x00,0x00,
+	0x00,0x01,0x03,0x03,0x00,0x00,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,
+	0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0xff,0xff,0x0c,0x0c,0x0c,0x1c,0xf8,0xf0,
+	0xfc,0xfe,0x87,0x03,0x00,0x00,0xfc,0xfe,0x07,0x03,0x03,0x03,0x03,0x07,0xfe,0xfc,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x83,0xff,0xff,0x03,0x03,0x03,0x03,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x03,0x03,0x00,0x00,
+	0x0c,0x1e,0x3f,0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x3c,0x3c,0x00,0x00,0x30,0x30,
+	0x03,0x83,0xc3,0xe3,0xff,0xff,0x83,0x03,0x03,0x83,0xff,0xff,0x03,0x03,0x03,0x03,
+	0x03,0x03,0x01,0x00,0x00,0x01,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xe3,0xff,0x3f,0x00,0x00,0x00,0x00,
+	0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x39,0x1f,0x0f,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x83,0xff,0xff,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,
+	0xfc,0xfe,0x87,0x03,0x03,0x03,0x03,0x03,0x03,0x87,0xfe,0xfc,0x00,0x00,0x00,0x00,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x03,0x03,0xff,0xff,0x83,0x03,0x03,0x03,0x03,0x03,0x03,0x83,0xff,0xff,
+	0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,
+	0x00,0x00,0x00,0x00,0xfc,0xfe,0x07,0x03,0x03,0x03,0x03,0x03,0x03,0x07,0xfe,0xfc,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x07,0x0f,0x1f,0xfb,0xf3,0x00,0x00,0x00,0x00,
+	0xff,0xff,0x80,0x00,0x00,0x80,0xfc,0xfe,0x07,0x07,0xfe,0xfc,0x00,0x00,0x00,0x00,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,
+	0xf0,0xf8,0x1c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0xff,0xff,0x0c,0x0c,0x0c,0x0c,
+	0x7c,0xfe,0x87,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,
+	0x30,0x78,0x48,0xcc,0xcc,0xcc,0x86,0x86,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,
+	0x0c,0x0c,0x0c,0x0e,0x1f,0x33,0x33,0xe3,0xe3,0xc3,0xc3,0xc3,0x00,0x00,0x00,0x00,
+	0x0c,0x0c,0x0c,0x1c,0x3e,0x33,0x33,0x31,0x31,0x30,0x30,0x30,0x00,0x00,0x00,0x00,
+	0x03,0x87,0xce,0xfc,0x78,0x30,0x30,0x78,0xfc,0xce,0x87,0x03,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x00,0x00,0x00,0x00,
+	0x07,0x0f,0x1c,0x38,0x30,0x30,0x30,0x30,0x30,0x78,0xfc,0xce,0x87,0x03,0x03,0x03,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,
+	0xff,0xff,0x03,0x07,0x0e,0x1c,0x38,0x70,0xe0,0xc0,0xff,0xff,0x00,0x00,0x00,0x00,
+	0xfc,0xfe,0x87,0x03,0x03,0x07,0x0f,0x1f,0x3b,0x73,0xe3,0xc3,0x83,0x87,0xfe,0xfc,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,
+	0xff,0xff,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x36,0x3e,0x3c,0x38,0x30,
+	0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xff,0xff,0x03,0x07,0x0e,0x1c,0x38,0x70,0xe0,0xc0,0x80,0x00,0x03,0x87,0xfe,0xfc,
+	0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,0x01,0x00,
+	0xfc,0xfe,0x87,0x03,0x00,0x00,0x00,0x80,0xf0,0xf0,0x80,0x00,0x03,0x87,0xfe,0xfc,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x01,0x03,0x03,0x03,0x03,0x01,0x00,
+	0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xff,0xff,0xc3,0xc7,0xce,0xdc,0xf8,0xf0,0xe0,0xc0,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xfc,0xfe,0x87,0x03,0x03,0x03,0x00,0x80,0xff,0xff,0x03,0x03,0x03,0x03,0xff,0xff,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x03,
+	0xfc,0xfe,0x87,0x03,0x03,0x03,0x03,0x87,0xff,0xff,0x03,0x03,0x03,0x87,0xfe,0xfc,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x03,0x03,0x01,0x00,
+	0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x1c,0x38,0x70,0xe0,0xc0,0x80,0x00,0xff,0xff,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,
+	0xfc,0xfe,0x87,0x03,0x03,0x03,0x03,0x87,0xfe,0xfe,0x87,0x03,0x03,0x87,0xfe,0xfc,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x01,0x03,0x03,0x03,0x03,0x01,0x00,
+	0xfc,0xfe,0x87,0x03,0x00,0x00,0x00,0x00,0xfc,0xfe,0x07,0x03,0x03,0x07,0xfe,0xfc,
+	0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,
+	0x03,0x03,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x33,0x33,0x33,0x33,0x33,
+	0x00,0x0c,0x0c,0x0c,0xff,0xff,0x0c,0x0c,0x0c,0x0c,0xff,0xff,0x0c,0x0c,0x0c,0x00,
+	0x00,0x03,0x03,0x03,0x0f,0x0f,0x03,0x03,0x03,0x03,0x0f,0x0f,0x03,0x03,0x03,0x00,
+	0x30,0x30,0xfc,0xfe,0x37,0x33,0xf0,0x70,0x7c,0x3e,0x33,0xb3,0xfe,0xfc,0x30,0x30,
+	0x00,0x00,0x00,0x01,0x03,0x03,0x01,0x00,0x00,0x00,0x03,0x03,0x01,0x00,0x00,0x00,
+	0x83,0x83,0x87,0x06,0x0e,0x0c,0x1c,0x18,0x38,0x30,0x70,0x60,0xe0,0xc7,0xc7,0x87,
+	0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,
+	0x30,0x38,0x1c,0x0e,0x07,0x03,0x03,0x03,0x03,0x03,0x03,0x07,0x0e,0x1c,0x38,0x30,
+	0x03,0x07,0x0e,0x1c,0x38,0x30,0x30,0x30,0x30,0x30,0x30,0x38,0x1c,0x0e,0x07,0x03,
+	0x00,0x00,0x30,0x30,0x30,0x30,0xff,0xff,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x06,0x0f,0x0f,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x03,0x03,0x07,0x06,0x0e,0x0c,0x1c,0x18,0x38,0x30,0x70,0x60,0xe0,0xc0,0xc0,0xc0,
+	0x00,0x00,0x06,0x0f,0x0f,0x06,0x00,0x00,0x00,0x00,0x06,0x0f,0x0f,0x06,0x00,0x00,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x06,0x00,0x00,0x00,0x00,0x06,0x0f,0x0f,0x06,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,
+	0x30,0x78,0x78,0x30,0x00,0x30,0x30,0xf0,0xc0,0x80,0x03,0x03,0x03,0x87,0xfe,0xfc,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x66,0xc3,0x81,0x81,0xc3,0x66,0x3c,
+	0xf0,0xf8,0x1c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x1c,0xf8,0xf0,
+	0x03,0x07,0x0e,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x0e,0x07,0x03,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x7e,0xe7,0xc3,0xc3,0xe7,0x7e,0x3c,
+	0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0xfc,0xfc,0x0c,0x0c,0x0c,0x0c,0xfc,0xfc,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,0x0f,0x0f,
+};
+
+const uint16_t FONT_16_ROTATED_1_OFFSETS[] PROGMEM =
+{
+	0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448, 480, 512, 544, 576, 608, 640, 672, 704, 736, 768, 800, 832, 864, 896, 928, 960, 992, 1008, 1040, 1072, 1088, 1104, 1136, 1152, 1184, 1216, 1248, 1280, 1312, 1328, 1360, 1376, 1408, 1440, 1472, 1504, 1536, 1552, 1584, 1616, 1648, 1680, 1712, 1744, 1776, 1808, 1840, 1872, 1888, 1904, 1936, 1968, 2000, 2016, 2032, 2048, 2080, 2096, 2128, 2144, 2160, 2176, 2192, 2224, 2256, 2304
+};
+
+const uint8_t* const FONT_16_ROTATED[] PROGMEM =
+{
+	FONT_16_ROTATED_0, FONT_16_ROTATED_1, 0, 0
+};
+
+const uint16_t* const FONT_16_ROTATED_OFFSETS[] PROGMEM =
+{
+	FONT_16_ROTATED_0_OFFSETS, FONT_16_ROTATED_1_OFFSETS, 0, 0
+};
+
+const uint8_t* const FONT_20_ROTATED[] PROGMEM =
+{
+	0, 0, 0, 0
+};
+
+const uint16_t* const FONT_20_ROTATED_OFFSETS[] PROGMEM =
+{
+	0, 0, 0, 0
+};
+
+const uint8_t FONT_25_ROTATED_0[] PROGMEM =
+{
+	0xfc,0xfe,0xff,0x0f,0x07,0x07,0x07,0x87,0xcf,0xff,0xfe,0xfc,0xff,0xff,0xff,0x38,
+	0x1c,0x0e,0x07,0x03,0x01,0xff,0xff,0xff,0x7f,0xff,0xff,0xe0,0xc0,0xc0,0xc0,0xc0,
+	0xe0,0xff,0xff,0x7f,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+	0x00,0x30,0x38,0x1c,0x0e,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xff,0xff,0xff,
+	0xc0,0xc0,0xc0,0xc0,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x1c,0x1e,0x1f,0x07,0x07,0x07,0x07,0x07,0x0f,0xff,0xfe,0xfc,0x00,0x80,0xc0,0xe0,
+	0xf0,0x78,0x3c,0x1e,0x0f,0x07,0x03,0x01,0xff,0xff,0xff,0xc1,0xc0,0xc0,0xc0,0xc0,
+	0xc0,0xc0,0xc0,0xc0,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x3c,0x3e,0x3f,0x0f,0x07,0x07,0x07,0x07,0x0f,0xff,0xfe,0xfc,0x00,0x00,0x00,0x00,
+	0x0e,0x0e,0x0e,0x0e,0x1f,0xff,0xff,0xf1,0x78,0xf8,0xf8,0xe0,0xc0,0xc0,0xc0,0xc0,
+	0xe0,0xff,0xff,0x7f,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+	0xe0,0xf0,0xf8,0x3c,0x1e,0x0f,0x0f,0xff,0xff,0xff,0x00,0x00,0x1f,0x1f,0x1f,0x1c,
+	0x1c,0x1c,0x1c,0xff,0xff,0xff,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,
+	0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+	0xff,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x0f,0x0f,0x0f,0x0e,
+	0x0e,0x0e,0x0e,0x0e,0x0e,0xfe,0xfc,0xf8,0x78,0xf8,0xf8,0xe0,0xc0,0xc0,0xc0,0xc0,
+	0xe0,0xff,0xff,0x7f,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+	0xfc,0xfe,0xff,0x0f,0x07,0x07,0x07,0x07,0x0f,0x3f,0x3e,0x3c,0xff,0xff,0xff,0x0e,
+	0x0e,0x0e,0x0e,0x0e,0x0e,0xfe,0xfc,0xf8,0x7f,0xff,0xff,0xe0,0xc0,0xc0,0xc0,0xc0,
+	0xe0,0xff,0xff,0x7f,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+	0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x87,0xc7,0xff,0xff,0x7f,0x00,0x00,0xe0,0xf0,
+	0xfc,0x1e,0x0f,0x07,0x03,0x01,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xfc,0xfe,0xff,0x0f,0x07,0x07,0x07,0x07,0x0f,0xff,0xfe,0xfc,0xf1,0xfb,0xff,0x1f,
+	0x0e,0x0e,0x0e,0x0e,0x1f,0xff,0xfb,0xf1,0x7f,0xff,0xff,0xe0,0xc0,0xc0,0xc0,0xc0,
+	0xe0,0xff,0xff,0x7f,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+	0xfc,0xfe,0xff,0x8f,0x07,0x07,0x07,0x07,0x07,0xff,0xfe,0xfc,0x01,0x03,0x07,0x07,
+	0x07,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,
+	0xe0,0xf0,0xf0,0xe0,0x00,0x01,0x01,0x00,0x0e,0x1f,0x1f,0x0e,0x00,0x00,0x00,0x00,
+};
+
+const uint16_t FONT_25_ROTATED_0_OFFSETS[] PROGMEM =
+{
+	0, 48, 96, 144, 192, 240, 288, 336, 384, 432, 480
+};
+
+const uint8_t* const FONT_25_ROTATED[] PROGMEM =
+{
+	FONT_25_ROTATED_0, 0, 0, 0
+};
+
+const uint16_t* const FONT_25_ROTATED_OFFSETS[] PROGMEM =
+{
+	FONT_25_ROTATED_0_OFFSETS, 0, 0, 0
+};
+
+#endif /* OLED_PRE_ROTATED_FONTS */
@@ -0,0 +1,32 @@
+/*
+ **************************************************************
+ * XBM_FONTS_ROTATED.h
+ * Pre-rotated, page-packed glyphs for the XBM fonts, used by
+ * the SH1106 library when OLED_PRE_ROTATED_FONTS is defined.
+ * Generated by tools/rotate_fonts.py, do not edit. Regenerate
+ * after changing a font with:
+ * python3 tools/rotate_fonts.py --orientations 8:1,2,3 16:0,1 20: 25:0
+ * Total size: 6923 bytes of flash.
+ **************************************************************
+*/
+
+#ifndef XBM_FONTS_ROTATED_H_
+#define XBM_FONTS_ROTATED_H_
+
+#define FONT_8_ROTATIONS	0x0e	/* Bit n set = glyphs pre-rotated for screenOrientation n */
+extern const uint8_t* const FONT_8_ROTATED[] PROGMEM;
+extern const uint16_t* const FONT_8_ROTATED_OFFSETS[] PROGMEM;
+
+#define FONT_16_ROTATIONS	0x03	/* Bit n set = glyphs pre-rotated for screenOrientation n */
+extern const uint8_t* const FONT_16_ROTATED[] PROGMEM;
+extern const uint16_t* const FONT_16_ROTATED_OFFSETS[] PROGMEM;
+
+#define FONT_20_ROTATIONS	0x00	/* Bit n set = glyphs pre-rotated for screenOrientation n */
+extern const uint8_t* const FONT_20_ROTATED[] PROGMEM;
+extern const uint16_t* const FONT_20_ROTATED_OFFSETS[] PROGMEM;
+
+#define FONT_25_ROTATIONS	0x01	/* Bit n set = glyphs pre-rotated for screenOrientation n */
+extern const uint8_t* const FONT_25_ROTATED[] PROGMEM;
+extern const uint16_t* const FONT_25_ROTATED_OFFSETS[] PROGMEM;
+
+#endif /* XBM_FONTS_ROTATED_H_ */
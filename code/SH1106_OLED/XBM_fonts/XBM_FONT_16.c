@@ -10,6 +10,9 @@
 
 #include <avr/pgmspace.h>
 #include "XBM_FONT_16.h"
+#include "XBM_FONTS_ROTATED.h"
+#include "XBM_FONTS_PACKED.h"
+#include "../SH1106.h"
 
 const uint8_t A_16[] PROGMEM = {0xfc,0xfc,0xfe,0xfd,0x87,0xff,0x03,0xff,
 	0x03,0xff,0x03,0xff,0xff,0xff,0xff,0xff,
@@ -480,7 +483,7 @@ const uint8_t* const FONT_16[] PROGMEM =
 };
 
 // The widths of each character in the FONT_16 array above.
-const uint8_t const FONT_16_WIDTHS[] PROGMEM =
+const uint8_t FONT_16_WIDTHS[] PROGMEM =
 {
 	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 14, 12, 10, 10, 10, 10, 10, 10, 10, 10, 14, 10, 10, 10,
 	10, 10, 10, 10, 10, 8, 10, 10, 2, 6, 10, 2, 14, 10, 10, 10, 10, 8, 10, 8, 10, 10, 14, 10, 10, 8,
@@ -490,7 +493,7 @@ const uint8_t const FONT_16_WIDTHS[] PROGMEM =
 };
 
 // The y-offset of each character in the FONT_16 array above.
-const uint8_t const FONT_16_Y_OFFSET[] PROGMEM =
+const uint8_t FONT_16_Y_OFFSET[] PROGMEM =
 {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 4, 0,
@@ -498,3 +501,38 @@ const uint8_t const FONT_16_Y_OFFSET[] PROGMEM =
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0,
 };
+
+// Descriptor used by OLED_draw_string() to draw with this font.
+const font_t FONT_16_DESCRIPTOR PROGMEM =
+{
+	.firstChar = '!',
+	.lastChar = 'z',
+	.remap = FONT_TEXT_REMAP,
+	.firstSymbol = 254,
+	.lastSymbol = 255,
+	.symbolIndex = 79,
+	.height = 16,
+	.spaceAdvance = 10,
+	.widths = FONT_16_WIDTHS,
+	.yOffsets = FONT_16_Y_OFFSET,
+	#ifdef OLED_PRE_ROTATED_FONTS
+		.rotated = FONT_16_ROTATED,
+		.rotatedOffsets = FONT_16_ROTATED_OFFSETS,
+	#else
+		.rotated = 0,
+		.rotatedOffsets = 0,
+	#endif /* OLED_PRE_ROTATED_FONTS */
+	#if defined(OLED_PRE_ROTATED_FONTS) && defined(OLED_NO_FALLBACK_FONT_16)
+		.glyphs = 0,
+		.packed = 0,
+		.packedOffsets = 0
+	#elif defined(OLED_PACKED_FONTS) && FONT_16_IS_PACKED
+		.glyphs = 0,
+		.packed = FONT_16_PACKED,
+		.packedOffsets = FONT_16_PACKED_OFFSETS
+	#else
+		.glyphs = FONT_16,
+		.packed = 0,
+		.packedOffsets = 0
+	#endif /* OLED_PACKED_FONTS */
+};
@@ -11,6 +11,8 @@
 #ifndef XBM_FONT_16_H_
 #define XBM_FONT_16_H_
 
+#include "XBM_FONT.h"
+
 extern const uint8_t A_16[] PROGMEM;
 
 extern const uint8_t B_16[] PROGMEM;
@@ -177,9 +179,12 @@ extern const uint8_t DEGREES_FAHRENHEIT_16[] PROGMEM;
 extern const uint8_t* const FONT_16[] PROGMEM;
 
 // The widths of each character in the FONT_16 array above.
-extern const uint8_t const FONT_16_WIDTHS[] PROGMEM;
+extern const uint8_t FONT_16_WIDTHS[] PROGMEM;
 
 // The y-offset of each character in the FONT_16 array above.
-extern const uint8_t const FONT_16_Y_OFFSET[] PROGMEM;
+extern const uint8_t FONT_16_Y_OFFSET[] PROGMEM;
+
+// Descriptor used by OLED_draw_string() to draw with this font.
+extern const font_t FONT_16_DESCRIPTOR PROGMEM;
 
 #endif /* XBM_FONT_16_H_ */
\ No newline at end of file
@@ -10,6 +10,9 @@
 
 #include <avr/pgmspace.h>
 #include "XBM_FONT_8.h"
+#include "XBM_FONTS_ROTATED.h"
+#include "XBM_FONTS_PACKED.h"
+#include "../SH1106.h"
 
 const uint8_t A_8[8] PROGMEM = {0xee,0xf1,0xf1,0xff,0xf1,0xf1,0xf1,0xf1};
 const uint8_t B_8[8] PROGMEM = {0xef,0xf1,0xf1,0xef,0xf1,0xf1,0xf1,0xef};
@@ -200,7 +203,7 @@ const uint8_t* const FONT_8[] PROGMEM =
 };
 
 // The widths of each character in the FONT_8 array above.
-const uint8_t const FONT_8_WIDTHS[] PROGMEM	= 
+const uint8_t FONT_8_WIDTHS[] PROGMEM	= 
 {
 	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 6, 5, 5, 5, 5, 5, 5, 5, 5, 7, 5, 5, 5,
 	5, 5, 5, 5, 5, 4, 5, 5, 1, 3, 5, 1, 7, 5, 5, 5, 5, 4, 5, 4, 5, 5, 7, 5, 5, 4,
@@ -210,11 +213,46 @@ const uint8_t const FONT_8_WIDTHS[] PROGMEM	=
 };
 
 // The y-offset of each character in the FONT_8 array above.
-const uint8_t const FONT_8_Y_OFFSET[] PROGMEM =
+const uint8_t FONT_8_Y_OFFSET[] PROGMEM =
 {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0
-};
\ No newline at end of file
+};
+
+// Descriptor used by OLED_draw_string() to draw with this font.
+const font_t FONT_8_DESCRIPTOR PROGMEM =
+{
+	.firstChar = '!',
+	.lastChar = 'z',
+	.remap = FONT_TEXT_REMAP,
+	.firstSymbol = 254,
+	.lastSymbol = 255,
+	.symbolIndex = 79,
+	.height = 8,
+	.spaceAdvance = 5,
+	.widths = FONT_8_WIDTHS,
+	.yOffsets = FONT_8_Y_OFFSET,
+	#ifdef OLED_PRE_ROTATED_FONTS
+		.rotated = FONT_8_ROTATED,
+		.rotatedOffsets = FONT_8_ROTATED_OFFSETS,
+	#else
+		.rotated = 0,
+		.rotatedOffsets = 0,
+	#endif /* OLED_PRE_ROTATED_FONTS */
+	#if defined(OLED_PRE_ROTATED_FONTS) && defined(OLED_NO_FALLBACK_FONT_8)
+		.glyphs = 0,
+		.packed = 0,
+		.packedOffsets = 0
+	#elif defined(OLED_PACKED_FONTS) && FONT_8_IS_PACKED
+		.glyphs = 0,
+		.packed = FONT_8_PACKED,
+		.packedOffsets = FONT_8_PACKED_OFFSETS
+	#else
+		.glyphs = FONT_8,
+		.packed = 0,
+		.packedOffsets = 0
+	#endif /* OLED_PACKED_FONTS */
+};
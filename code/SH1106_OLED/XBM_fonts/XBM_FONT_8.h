@@ -11,6 +11,8 @@
 #ifndef XBM_FONT_8_H_
 #define XBM_FONT_8_H_
 
+#include "XBM_FONT.h"
+
 extern const uint8_t A_8[8] PROGMEM;
 extern const uint8_t B_8[8] PROGMEM;
 extern const uint8_t C_8[8] PROGMEM;
@@ -106,9 +108,12 @@ extern const uint8_t DEGREES_FAHRENHEIT_8[] PROGMEM;
 extern const uint8_t* const FONT_8[] PROGMEM;
 
 // The widths of each character in the FONT_8 array above.
-extern const uint8_t const FONT_8_WIDTHS[] PROGMEM;
+extern const uint8_t FONT_8_WIDTHS[] PROGMEM;
 
 // The y-offset of each character in the FONT_8 array above.
-extern const uint8_t const FONT_8_Y_OFFSET[] PROGMEM;
+extern const uint8_t FONT_8_Y_OFFSET[] PROGMEM;
+
+// Descriptor used by OLED_draw_string() to draw with this font.
+extern const font_t FONT_8_DESCRIPTOR PROGMEM;
 
 #endif /* XBM_FONT_8_H_ */
\ No newline at end of file
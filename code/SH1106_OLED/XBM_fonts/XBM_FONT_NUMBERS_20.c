@@ -10,6 +10,9 @@
 
 #include <avr/pgmspace.h>
 #include "XBM_FONT_NUMBERS_20.h"
+#include "XBM_FONTS_ROTATED.h"
+#include "XBM_FONTS_PACKED.h"
+#include "../SH1106.h"
 
 const uint8_t ZERO_20[] PROGMEM		=  {0xfc,0xf3,0xfe,0xf7,0x07,0xfe,0x03,0xfe,0x03,0xff,0x83,0xff,
 	0xc3,0xfd,0xe3,0xfc,0x73,0xfc,0x3b,0xfc,0x1f,0xfc,0x0f,0xfc,
@@ -76,13 +79,48 @@ const uint8_t* const FONT_20[] PROGMEM =
 };
 
 // The widths of each character in the FONT_16 array above.
-const uint8_t const FONT_20_WIDTHS[] PROGMEM =
+const uint8_t FONT_20_WIDTHS[] PROGMEM =
 {
 	12, 12, 12, 12, 12, 12, 12, 12, 12, 12
 };
 
 // The y-offset of each character in the FONT_16 array above.
-const uint8_t const FONT_20_Y_OFFSET[] PROGMEM =
+const uint8_t FONT_20_Y_OFFSET[] PROGMEM =
 {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 };
+
+// Descriptor used by OLED_draw_string() to draw with this font.
+const font_t FONT_20_DESCRIPTOR PROGMEM =
+{
+	.firstChar = '0',
+	.lastChar = '9',
+	.remap = 0,
+	.firstSymbol = 0,
+	.lastSymbol = 0,
+	.symbolIndex = 0,
+	.height = 20,
+	.spaceAdvance = 14,
+	.widths = FONT_20_WIDTHS,
+	.yOffsets = FONT_20_Y_OFFSET,
+	#ifdef OLED_PRE_ROTATED_FONTS
+		.rotated = FONT_20_ROTATED,
+		.rotatedOffsets = FONT_20_ROTATED_OFFSETS,
+	#else
+		.rotated = 0,
+		.rotatedOffsets = 0,
+	#endif /* OLED_PRE_ROTATED_FONTS */
+	#if defined(OLED_PRE_ROTATED_FONTS) && defined(OLED_NO_FALLBACK_FONT_20)
+		.glyphs = 0,
+		.packed = 0,
+		.packedOffsets = 0
+	#elif defined(OLED_PACKED_FONTS) && FONT_20_IS_PACKED
+		.glyphs = 0,
+		.packed = FONT_20_PACKED,
+		.packedOffsets = FONT_20_PACKED_OFFSETS
+	#else
+		.glyphs = FONT_20,
+		.packed = 0,
+		.packedOffsets = 0
+	#endif /* OLED_PACKED_FONTS */
+};
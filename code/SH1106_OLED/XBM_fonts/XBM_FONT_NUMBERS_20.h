@@ -11,6 +11,8 @@
 #ifndef XBM_FONT_NUMBERS_20_H_
 #define XBM_FONT_NUMBERS_20_H_
 
+#include "XBM_FONT.h"
+
 extern const uint8_t ZERO_20[] PROGMEM;
 
 extern const uint8_t ONE_20[] PROGMEM;
@@ -34,9 +36,12 @@ extern const uint8_t NINE_20[] PROGMEM;
 extern const uint8_t* const FONT_20[] PROGMEM;
 
 // The widths of each character in the FONT_16 array above.
-extern const uint8_t const FONT_20_WIDTHS[] PROGMEM;
+extern const uint8_t FONT_20_WIDTHS[] PROGMEM;
 
 // The y-offset of each character in the FONT_16 array above.
-extern const uint8_t const FONT_20_Y_OFFSET[] PROGMEM;
+extern const uint8_t FONT_20_Y_OFFSET[] PROGMEM;
+
+// Descriptor used by OLED_draw_string() to draw with this font.
+extern const font_t FONT_20_DESCRIPTOR PROGMEM;
 
 #endif /* XBM_FONT_NUMBERS_20_H_ */
\ No newline at end of file
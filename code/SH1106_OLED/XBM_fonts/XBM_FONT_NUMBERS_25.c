@@ -10,6 +10,9 @@
 
 #include <avr/pgmspace.h>
 #include "XBM_FONT_NUMBERS_25.h"
+#include "XBM_FONTS_ROTATED.h"
+#include "XBM_FONTS_PACKED.h"
+#include "../SH1106.h"
 
 const uint8_t ZERO_25[] PROGMEM		=  {0xfc,0xf3,0xfe,0xf7,0xff,0xff,0x0f,0xff,0x07,0xfe,0x07,0xfe,
 	0x07,0xff,0x87,0xff,0xc7,0xff,0xe7,0xfe,0x77,0xfe,0x3f,0xfe,
@@ -91,13 +94,48 @@ const uint8_t* const FONT_25[] PROGMEM =
 };
 
 // The widths of each character in the FONT_16 array above.
-const uint8_t const FONT_25_WIDTHS[] PROGMEM =
+const uint8_t FONT_25_WIDTHS[] PROGMEM =
 {
 	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 4
 };
 
 // The y-offset of each character in the FONT_16 array above.
-const uint8_t const FONT_25_Y_OFFSET[] PROGMEM =
+const uint8_t FONT_25_Y_OFFSET[] PROGMEM =
 {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
\ No newline at end of file
+};
+
+// Descriptor used by OLED_draw_string() to draw with this font.
+const font_t FONT_25_DESCRIPTOR PROGMEM =
+{
+	.firstChar = '0',
+	.lastChar = ':',
+	.remap = 0,
+	.firstSymbol = 0,
+	.lastSymbol = 0,
+	.symbolIndex = 0,
+	.height = 25,
+	.spaceAdvance = 14,
+	.widths = FONT_25_WIDTHS,
+	.yOffsets = FONT_25_Y_OFFSET,
+	#ifdef OLED_PRE_ROTATED_FONTS
+		.rotated = FONT_25_ROTATED,
+		.rotatedOffsets = FONT_25_ROTATED_OFFSETS,
+	#else
+		.rotated = 0,
+		.rotatedOffsets = 0,
+	#endif /* OLED_PRE_ROTATED_FONTS */
+	#if defined(OLED_PRE_ROTATED_FONTS) && defined(OLED_NO_FALLBACK_FONT_25)
+		.glyphs = 0,
+		.packed = 0,
+		.packedOffsets = 0
+	#elif defined(OLED_PACKED_FONTS) && FONT_25_IS_PACKED
+		.glyphs = 0,
+		.packed = FONT_25_PACKED,
+		.packedOffsets = FONT_25_PACKED_OFFSETS
+	#else
+		.glyphs = FONT_25,
+		.packed = 0,
+		.packedOffsets = 0
+	#endif /* OLED_PACKED_FONTS */
+};
@@ -11,6 +11,8 @@
 #ifndef XBM_FONT_NUMBERS_25_H_
 #define XBM_FONT_NUMBERS_25_H_
 
+#include "XBM_FONT.h"
+
 extern const uint8_t ZERO_25[] PROGMEM;
 
 extern const uint8_t ONE_25[] PROGMEM;
@@ -36,9 +38,12 @@ extern const uint8_t COLON[] PROGMEM;
 extern const uint8_t* const FONT_25[] PROGMEM;
 
 // The widths of each character in the FONT_16 array above.
-extern const uint8_t const FONT_25_WIDTHS[] PROGMEM;
+extern const uint8_t FONT_25_WIDTHS[] PROGMEM;
 
 // The y-offset of each character in the FONT_16 array above.
-extern const uint8_t const FONT_25_Y_OFFSET[] PROGMEM;
+extern const uint8_t FONT_25_Y_OFFSET[] PROGMEM;
+
+// Descriptor used by OLED_draw_string() to draw with this font.
+extern const font_t FONT_25_DESCRIPTOR PROGMEM;
 
 #endif /* XBM_FONT_NUMBERS_25_H_ */
\ No newline at end of file
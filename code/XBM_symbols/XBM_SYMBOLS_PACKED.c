@@ -0,0 +1,30 @@
+/*
+ **************************************************************
+ * XBM_SYMBOLS_PACKED.c
+ * Compressed copies of the images in XBM_symbols.c, drawn
+ * with OLED_draw_packed().
+ * Generated by tools/pack_assets.py, do not edit. Regenerate
+ * after changing an image with:
+ * python3 tools/pack_assets.py --fonts 16 20 25
+ * Total size: 74 bytes of flash.
+ **************************************************************
+*/
+
+#include <avr/pgmspace.h>
+#include "../SH1106_OLED/SH1106.h"
+#include "XBM_SYMBOLS_PACKED.h"
+
+const uint8_t alarmBellIconArmedPacked[] PROGMEM =
+{
+	18, 24, OLED_PACKED_RLE,
+	0x3f,0xf3,0x54,0xea,0xf8,0x71,0x2f,0xf6,0x63,0x4f,0xf4,0x36,0x6f,0xf3,0x36,0x6f,
+	0xf4,0x54,0x3f,0xf7,0x82,0x1f,0xea,0x4f,0xf5,0x36,0x03,
+};
+
+const uint8_t alarmBellIconUnarmedPacked[] PROGMEM =
+{
+	18, 24, OLED_PACKED_RLE,
+	0x3f,0xf3,0x54,0xaa,0x22,0xb8,0x23,0x37,0x62,0x33,0x46,0x43,0x43,0x56,0x23,0x63,
+	0x74,0x86,0x83,0x94,0x83,0x94,0x73,0x86,0x54,0x23,0x63,0x45,0x43,0x43,0x37,0x62,
+	0x33,0xb8,0x23,0xaa,0x22,0x4f,0xf5,0x36,0x03,
+};
@@ -0,0 +1,19 @@
+/*
+ **************************************************************
+ * XBM_SYMBOLS_PACKED.h
+ * Compressed copies of the images in XBM_symbols.c, drawn
+ * with OLED_draw_packed().
+ * Generated by tools/pack_assets.py, do not edit. Regenerate
+ * after changing an image with:
+ * python3 tools/pack_assets.py --fonts 16 20 25
+ * Total size: 74 bytes of flash.
+ **************************************************************
+*/
+
+#ifndef XBM_SYMBOLS_PACKED_H_
+#define XBM_SYMBOLS_PACKED_H_
+
+extern const uint8_t alarmBellIconArmedPacked[] PROGMEM;
+extern const uint8_t alarmBellIconUnarmedPacked[] PROGMEM;
+
+#endif /* XBM_SYMBOLS_PACKED_H_ */
@@ -17,6 +17,7 @@
 #include <util/delay.h>
 
 #include "SH1106_OLED/SH1106.h"
+#include "OLED_widgets/OLED_widgets.h"
 #include "Atmega328p_SPI/Atmega328p_SPI.h"
 #include "pFleury_i2c_stuff/i2cmaster.h"
 #include "timer0_1ms_interrupts/timer0_1ms_interrupts.h"
@@ -27,23 +28,30 @@
 #include "AM2320_temperature_humidity/AM2320_temperature_humidity.h"
 #include "piezo_buzzer_328p/piezo_buzzer_328p.h"
 #include "buttons/buttons.h"
+#include "render_scheduler/render_scheduler.h"
 #include "roll_clock_modes/MODE_A.h"
 #include "roll_clock_modes/MODE_B.h"
 #include "roll_clock_modes/MODE_C.h"
 #include "roll_clock_modes/MODE_D.h"
 
+#ifdef OLED_PAGE_RENDERER
+	#error "The roll clock screens draw into the full buffer, OLED_PAGE_RENDERER is a library option only, see SH1106.h"
+#endif /* OLED_PAGE_RENDERER */
+
 /* Defines for keeping track of delays */
-#define NUM_PREVIOUS_TIMES 5
+#define NUM_PREVIOUS_TIMES 6
 #define ADXL_PREV_TIME_INDEX 0
 #define AM2320_UPDATE_READINGS_INDEX 1
 #define RTC_UPDATE_CURRENT_TIME_INDEX 2
 #define ALARM_INVERT_DISPLAY_INDEX 3
 #define INVERT_DISPLAY_ALARM_INDEX 4
+#define ROLL_STEP_INDEX 5
 #define ADXL_AXIS_READ_INTERVAL 813
 #define AM2320_UPDATE_READINGS_INTERVAL 20000
 #define RTC_UPDATE_CURRENT_TIME_INTERVAL 3
 #define ALARM_INVERT_DISPLAY_INTERVAL 213
 #define INVERT_DISPLAY_ALARM_INTERVAL 500
+#define ROLL_STEP_INTERVAL 15 /* 16 steps of OLED_ROLL_STEP_LINES, about 250ms for a roll */
 
 /* Thresholds for determining the orientation of the screen */
 #define AXIS_ACTIVE 1400
@@ -57,6 +65,13 @@
 #define DISPLAY_INVERTED	0x01
 #define DISPLAY_NORMAL		0x00
 
+/* Print the i2c transactions per second over USART at start up, see i2c_benchmark() */
+/* #define I2C_BENCHMARK */
+#define I2C_BENCHMARK_TIME 1000 /* ms for each count */
+
+/* Character received over USART that dumps the i2c trace, with I2C_TRACE defined in i2cmaster.h */
+#define I2C_TRACE_COMMAND 'd'
+
 /* Function prototypes */
 void initialise_current_and_previous_times(uint32_t* currentTime, uint32_t* previousTimes);
 uint8_t update_current_orientation(uint8_t lastOrientation);
@@ -64,6 +79,13 @@ void update_ADXL_data(uint32_t currentTime, uint32_t* previousTimes, uint8_t* la
 void update_rtc_current_time(uint32_t currentTime, uint32_t* previousTimes);
 void update_temp_humidity_sensor(uint32_t currentTime, uint32_t* previousTimes);
 void alarm_match_handling(uint32_t currentTime, uint32_t* previousTimes, uint8_t* displayInvertedStatus);
+void roll_to_new_mode(uint32_t currentTime, uint32_t* previousTimes, uint8_t* rolledOrientation, uint8_t currentOrientation);
+#ifdef I2C_BENCHMARK
+	void i2c_benchmark();
+#endif /* I2C_BENCHMARK */
+#ifdef I2C_TRACE
+	void i2c_trace_dump();
+#endif /* I2C_TRACE */
 
 int main(void) {
 	
@@ -75,15 +97,24 @@ int main(void) {
 	buttons_init();
 	
 	/* Initialise hardware */
+	timer0_init();				/* Initialise timer0 to generate interrupts every 1ms */
+	sei();						/* Enable global interrupts, the i2c timeouts are timed by timer0 */
 	i2c_init();					/* i2c for MCU */
 	A328p_SPI_init();			/* SPI for MCU */
 	OLED_init();				/* SH1106 OLED display */
-	timer0_init();				/* Initialise timer0 to generate interrupts every 1ms */
+	RENDER_init();				/* Draw frames only when something changes */
 	RTC_init();					/* Clock IC */
 	ADXL343_setup_axis_read();	/* Using i2c mode */
 	ADXL343_double_tap_init();	/* Allow double tap to interrupts */
 	buzzer_init();				/* Beep beep */
-	sei();						/* Enable global interrupts */
+	
+	#ifdef I2C_BENCHMARK
+		i2c_benchmark();
+	#endif /* I2C_BENCHMARK */
+	
+	#ifdef I2C_TRACE
+		USART_init();				/* The trace is dumped over USART */
+	#endif /* I2C_TRACE */
 	
 	/* Current and previous times used for delays */
 	uint32_t currentTime;
@@ -93,6 +124,7 @@ int main(void) {
 	/* Initial orientation of the display */
 	uint8_t currentOrientation = MODE_A;
 	uint8_t lastOrientation = currentOrientation;
+	uint8_t rolledOrientation = currentOrientation;	/* Orientation the last roll went to */
 	
 	/* Status of the display (inverted or not) */
 	uint8_t displayInvertedStatus = DISPLAY_NORMAL;
@@ -115,6 +147,15 @@ int main(void) {
 		/* Update current system time */
 		currentTime = timer0_get_current_time(); 
 		
+		/* Fail a queued i2c transaction that has stopped moving */
+		i2c_check_timeout();
+		
+		#ifdef I2C_TRACE
+			if (USART_receive_character() == I2C_TRACE_COMMAND) {
+				i2c_trace_dump();
+			}
+		#endif /* I2C_TRACE */
+		
 		/* Update the time from the RTC */
 		update_rtc_current_time(currentTime, previousTimes);
 		alarm_match_handling(currentTime, previousTimes, &displayInvertedStatus);
@@ -122,7 +163,11 @@ int main(void) {
 		/* Update axis readings from ADXL343 and orientation value */
 		update_ADXL_data(currentTime, previousTimes, &lastOrientation, &currentOrientation);
 		
-		/* Different functionality based on orientation */
+		/* Roll the new mode onto the display when the clock is rotated */
+		roll_to_new_mode(currentTime, previousTimes, &rolledOrientation, currentOrientation);
+		
+		/* Different functionality based on orientation, each mode draws on a canvas turned the way up it is held */
+		OLED_set_canvas(currentOrientation);
 		switch(currentOrientation) {
 			case MODE_A:
 				/*
@@ -142,14 +187,20 @@ int main(void) {
 				MODE_B_control();
 				break;
 			case MODE_C:
-				OLED_clear_buffer();
-				OLED_draw_string("NRF MODE?", 0, 0, 8, 2, MODE_C);
-				OLED_display_buffer();
+				if (RENDER_frame_due()) {
+					WIDGET_screen(WIDGET_SCREEN_NONE);
+					OLED_clear_buffer();
+					OLED_draw_string_P(PSTR("NRF MODE?"), 0, 0, 8, 2, MODE_C);
+					OLED_display_buffer_async(0);
+				}
 				break;
 			case MODE_D:
-				OLED_clear_buffer();
-				OLED_draw_string("Mode D", 0, 0, 8, 2, MODE_D);
-				OLED_display_buffer();
+				if (RENDER_frame_due()) {
+					WIDGET_screen(WIDGET_SCREEN_NONE);
+					OLED_clear_buffer();
+					OLED_draw_string_P(PSTR("Mode D"), 0, 0, 8, 2, MODE_D);
+					OLED_display_buffer_async(0);
+				}
 				break;
 		}
     }
@@ -229,13 +280,22 @@ void initialise_current_and_previous_times(uint32_t* currentTime, uint32_t* prev
 /*
 * update_rtc_current_time()
 * --------------------------
-* Update the current time on the RTC at a regular interval.
+* Ask the RTC for the current time at a regular interval and ask for a new frame when the
+* seconds change. The read is queued behind any frame being sent and picked up on a later
+* pass of the main loop, so the loop does not wait for the bus.
 */
 void update_rtc_current_time(uint32_t currentTime, uint32_t* previousTimes) {
+	static uint8_t lastSeconds = 0xFF;
 
 	if ((currentTime - previousTimes[RTC_UPDATE_CURRENT_TIME_INDEX]) > RTC_UPDATE_CURRENT_TIME_INTERVAL) {
-		RTC_update_current_time();
-		previousTimes[RTC_UPDATE_CURRENT_TIME_INDEX] = currentTime;
+		if (RTC_request_current_time()) {
+			previousTimes[RTC_UPDATE_CURRENT_TIME_INDEX] = currentTime;
+		}
+	}
+	
+	if (RTC_current_time_ready() && (RTC_get_time_seconds_int() != lastSeconds)) {
+		lastSeconds = RTC_get_time_seconds_int();
+		RENDER_invalidate(RENDER_REASON_TICK);
 	}
 	
 }
@@ -243,12 +303,14 @@ void update_rtc_current_time(uint32_t currentTime, uint32_t* previousTimes) {
 /*
 * update_temp_humidity_sensor()
 * -----------------------------
-* Update the current readings of the temperature and humidity sensor at a regular interval.
+* Update the current readings of the temperature and humidity sensor at a regular interval and
+* ask for a new frame to show them.
 */
 void update_temp_humidity_sensor(uint32_t currentTime, uint32_t* previousTimes) {
 	if ((currentTime - previousTimes[AM2320_UPDATE_READINGS_INDEX]) > AM2320_UPDATE_READINGS_INTERVAL) {
 		AM2320_update_temperature_humidity();
 		previousTimes[AM2320_UPDATE_READINGS_INDEX] = currentTime;
+		RENDER_invalidate(RENDER_REASON_SENSOR);
 	}
 }
 
@@ -285,4 +347,126 @@ void alarm_match_handling(uint32_t currentTime, uint32_t* previousTimes, uint8_t
 	} else {
 		buzzer_stop_tone();
 	}
-}
\ No newline at end of file
+}
+
+/*
+* roll_to_new_mode()
+* ------------------
+* Start rolling the display when the orientation changes and move the roll on at a regular interval.
+* The new mode draws into the buffer as normal and the roll sends it a page at a time as the old
+* mode rolls off, using the display start line instead of sending a frame for every step.
+* The new mode is drawn straight away so it is in the buffer before the first page rolls on,
+* and again once the roll has finished to send anything that changed on the pages already sent.
+*/
+void roll_to_new_mode(uint32_t currentTime, uint32_t* previousTimes, uint8_t* rolledOrientation, uint8_t currentOrientation) {
+	static uint8_t rolling = 0;
+	
+	if (*rolledOrientation != currentOrientation) {
+		/* Turned anticlockwise (eg. mode A to mode B) rolls up, clockwise or upside down rolls down */
+		if (((currentOrientation - *rolledOrientation) & 0x03) == 1) {
+			OLED_roll_start(OLED_ROLL_UP);
+		} else {
+			OLED_roll_start(OLED_ROLL_DOWN);
+		}
+		*rolledOrientation = currentOrientation;
+		previousTimes[ROLL_STEP_INDEX] = currentTime;
+		rolling = 1;
+		RENDER_invalidate(RENDER_REASON_ORIENTATION | RENDER_NOW);
+	}
+	
+	if (rolling && ((currentTime - previousTimes[ROLL_STEP_INDEX]) > ROLL_STEP_INTERVAL)) {
+		rolling = OLED_roll_step();
+		previousTimes[ROLL_STEP_INDEX] = currentTime;
+		
+		if (!rolling) {
+			RENDER_invalidate(RENDER_REASON_ORIENTATION);
+		}
+	}
+}
+
+#ifdef I2C_BENCHMARK
+/*
+* i2c_benchmark()
+* ---------------
+* Count the i2c transactions done in I2C_BENCHMARK_TIME and print them over USART as
+* transactions per second. Each transaction is the shortest there is, the address and one
+* register byte, so the time spent setting up the bus shows. There are three counts:
+*	-	set_bitrate: switching between the RTC and the display every transaction and setting
+*		the bit rate with i2c_set_bitrate(), the way the drivers used to.
+*	-	select: switching between them the same way with i2c_select().
+*	-	same device: only the RTC with i2c_select(), so the bus never has to change.
+*
+* NOTE: Only the RTC register pointer is written, nothing on the RTC or display changes.
+*/
+void i2c_benchmark() {
+	static const i2c_device_t devices[2] = {
+		I2C_DEVICE(RTC_ADDR, RTC_I2C_BITRATE),
+		I2C_DEVICE(OLED_ADDR << 1, OLED_I2C_BITRATE)
+	};
+	static const uint32_t bitrates[2] = {RTC_I2C_BITRATE, OLED_I2C_BITRATE};
+	static const char* const names[3] = {"set_bitrate", "select", "same device"};
+	char string[40];
+	
+	USART_init();
+	
+	for (uint8_t count = 0; count < 3; count++) {
+		uint32_t transactions = 0;
+		uint32_t startTime = timer0_get_current_time();
+		
+		while ((timer0_get_current_time() - startTime) < I2C_BENCHMARK_TIME) {
+			uint8_t device = (count == 2) ? 0 : (transactions & 0x01);
+			
+			if (count == 0) {
+				i2c_set_bitrate(bitrates[device]);
+			} else {
+				i2c_select(&devices[device]);
+			}
+			i2c_start(devices[device].address | I2C_WRITE);
+			i2c_write(device ? OLED_COMMAND_MODE : RTC_SECONDS_REGISTER);
+			i2c_stop();
+			transactions++;
+		}
+		
+		sprintf(string, "i2c %s: %lu/s\r\n", names[count], (transactions * 1000) / I2C_BENCHMARK_TIME);
+		USART_transmit_string(string);
+	}
+}
+#endif /* I2C_BENCHMARK */
+
+#ifdef I2C_TRACE
+/*
+* i2c_trace_dump()
+* ----------------
+* Send the i2c trace records over USART as CSV and take them off the ring, for
+* tools/i2c_trace_summary.py. The records are framed by a begin line, with the number of
+* records overwritten since the last dump, and an end line:
+*
+*	i2c trace begin,lost 0
+*	address,direction,bytes,status,start_us,end_us
+*	0x78,W,131,ok,1203456,1206512
+*	0xDE,WR,4,ok,1206530,1206730
+*	i2c trace end
+*
+* NOTE:
+*	-	The address has the R/W bit clear, the direction is W, R or WR for a write then a
+*		read with a repeated start.
+*	-	The times are timer0_get_current_time_us() and wrap after about 71 minutes.
+*	-	The main loop stops while the dump is sent, at 9600 baud about 40ms a record.
+*/
+void i2c_trace_dump() {
+	static const char* const directions[4] = {"", "W", "R", "WR"};
+	i2c_trace_t record;
+	char string[48];
+	
+	sprintf(string, "i2c trace begin,lost %u\r\n", i2c_trace_lost());
+	USART_transmit_string(string);
+	USART_transmit_string("address,direction,bytes,status,start_us,end_us\r\n");
+	
+	while (!i2c_trace_take(&record)) {
+		sprintf(string, "0x%02X,%s,%u,%s,%lu,%lu\r\n", record.address, directions[record.direction & 0x03],
+			record.count, (record.status == I2C_TRANSACTION_DONE) ? "ok" : "fail", record.start, record.end);
+		USART_transmit_string(string);
+	}
+	USART_transmit_string("i2c trace end\r\n");
+}
+#endif /* I2C_TRACE */
\ No newline at end of file
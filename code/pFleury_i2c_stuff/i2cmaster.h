@@ -96,13 +96,253 @@
 
 /**
  @brief initialize the I2C master interace. Need to be called only once 
+
+ The timeouts are timed with timer0_get_current_time_us(), timer0 must be running with global
+ interrupts enabled before the bus is used.
  @param  void
  @return none
  */
 extern void i2c_init(void);
 
+/**
+ @brief Set the bit rate of the bus, the TWI is restarted and TWBR worked out every call
+ @param  bitrate SCL clock in Hz
+ @return none
+ */
 extern void i2c_set_bitrate(uint32_t bitrate);
 
+/** size of the transaction queue, a power of 2 */
+#ifndef I2C_QUEUE_SIZE
+#define I2C_QUEUE_SIZE 4
+#endif
+
+/** flags of an i2c_transaction_t */
+#define I2C_TRANSACTION_REGISTER 0x01  /**< send the reg byte before the write data */
+#define I2C_TRANSACTION_WAIT     0x02  /**< poll a device that NAKs its address, as i2c_start_wait() */
+#define I2C_TRANSACTION_NO_STATS 0x04  /**< a NAK is expected, eg. waking a device, and not counted, timeouts still are */
+
+/** status of an i2c_transaction_t */
+#define I2C_TRANSACTION_PENDING 0  /**< queued or on the bus */
+#define I2C_TRANSACTION_DONE    1  /**< finished, the read data is in the read buffer */
+#define I2C_TRANSACTION_FAILED  2  /**< NAK, lost arbitration or bus error */
+
+/** CPU frequency for I2C_TWBR(), if not defined before including this file */
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+/** SCL divider for a bit rate in Hz, must be > 10 for stable operation */
+#define I2C_DIVIDER(bitrate) ((((F_CPU) / (bitrate)) - 16) / 2)
+
+/** value of the TWSR prescaler bits for a bit rate in Hz, a prescaler of 4 below about 30kHz */
+#define I2C_TWSR(bitrate) ((I2C_DIVIDER(bitrate) > 255) ? 1 : 0)
+
+/** value of TWBR for a bit rate in Hz, with the prescaler from I2C_TWSR() */
+#define I2C_TWBR(bitrate) ((I2C_DIVIDER(bitrate) > 255) ? (I2C_DIVIDER(bitrate) / 4) : I2C_DIVIDER(bitrate))
+
+/**
+ @brief Bus profile of a device, worked out at compile time with I2C_DEVICE()
+ */
+typedef struct {
+	unsigned char address;  /**< device address with the R/W bit clear */
+	unsigned char twbr;     /**< TWBR for the bit rate of the device */
+	unsigned char twsr;     /**< TWSR prescaler bits for the bit rate of the device */
+} i2c_device_t;
+
+/** initialiser of an i2c_device_t for an address with the R/W bit clear and a bit rate in Hz */
+#define I2C_DEVICE(address, bitrate) { (address), I2C_TWBR(bitrate), I2C_TWSR(bitrate) }
+
+/**
+ @brief Switch the bus to the bit rate of a device
+
+ TWBR and TWSR are only written when the device profile is different to the one the bus is
+ already using, so talking to the same device again or to another device at the same bit rate
+ costs a compare. Waits for the queued transactions to finish first.
+ @param  device profile from I2C_DEVICE()
+ @return none
+ */
+extern void i2c_select(const i2c_device_t* device);
+
+/**
+ @brief Write bytes to consecutive registers of a device in one transfer
+
+ Sends the address, the register and the bytes, then the stop condition, as a transaction
+ run by the TWI interrupt with i2c_transfer(), so it waits behind the transactions already
+ queued. The device moves its register pointer on after each byte, so the bytes land in reg,
+ reg + 1 and so on. For devices without registers reg is simply the first byte sent.
+ A device that NAKs its address is polled for up to I2C_START_WAIT_TIMEOUT_US, as with
+ i2c_start_wait(), see I2C_TRANSACTION_WAIT.
+ @param  device profile from I2C_DEVICE()
+ @param  reg first register
+ @param  data bytes to write, may be 0 when length is 0
+ @param  length number of bytes, 0 only sets the register pointer
+ @retval 0 written
+ @retval 1 NAK after the address, lost arbitration or timeout
+ */
+extern unsigned char i2c_write_regs(const i2c_device_t* device, unsigned char reg, const unsigned char* data, unsigned char length);
+
+/**
+ @brief Read bytes from consecutive registers of a device in one transfer
+
+ Sends the address and the register, then a repeated start and reads the bytes,
+ acknowledging all but the last, then the stop condition, as a transaction run by the TWI
+ interrupt with i2c_transfer(). A device that NAKs its address is polled for up to
+ I2C_START_WAIT_TIMEOUT_US, see I2C_TRANSACTION_WAIT.
+ @param  device profile from I2C_DEVICE()
+ @param  reg first register
+ @param  data buffer for the bytes read
+ @param  length number of bytes, at least 1
+ @retval 0 read
+ @retval 1 NAK after the address, lost arbitration or timeout, the buffer is not valid
+ */
+extern unsigned char i2c_read_regs(const i2c_device_t* device, unsigned char reg, unsigned char* data, unsigned char length);
+
+/**
+ @brief Descriptor of a transaction run by the TWI interrupt
+
+ The transaction sends the address with the write bit, the reg byte if I2C_TRANSACTION_REGISTER
+ is set, then the write data. If there is read data it follows with a repeated start and the
+ address with the read bit. With no write data and no reg byte the transaction is only a read.
+ With I2C_TRANSACTION_WAIT, while the device NAKs the first address the TWI interrupt sends a
+ stop and a start and tries again, until I2C_START_WAIT_TIMEOUT_US after the transaction
+ started, when it fails and counts a timeout.
+ The descriptor and its buffers must stay in place until the status is no longer pending.
+ */
+typedef struct i2c_transaction {
+	const i2c_device_t* device;      /**< device address and bit rate */
+	unsigned char flags;             /**< I2C_TRANSACTION_x flags */
+	unsigned char reg;               /**< register sent first with I2C_TRANSACTION_REGISTER */
+	const unsigned char* writeData;  /**< bytes to send */
+	unsigned char writeLength;       /**< number of bytes to send */
+	unsigned char* readData;         /**< buffer for the bytes read */
+	unsigned char readLength;        /**< number of bytes to read */
+	void (*callback)(struct i2c_transaction* transaction);  /**< called from the TWI interrupt when it finishes, or 0 */
+	volatile unsigned char status;   /**< I2C_TRANSACTION_x status */
+} i2c_transaction_t;
+
+/**
+ @brief Queue a transaction to be run by the TWI interrupt and return straight away
+
+ The transaction starts as soon as the ones queued before it have finished. Blocking transfers
+ wait until the queue is empty. This can be called from a transaction callback to chain
+ another transaction.
+ @param  transaction descriptor, its status is set to I2C_TRANSACTION_PENDING
+ @retval 0 queued
+ @retval 1 the queue is full
+ */
+extern unsigned char i2c_post(i2c_transaction_t* transaction);
+
+/**
+ @brief Run a transaction through the queue and wait for it to finish
+
+ Works with global interrupts disabled by running the TWI interrupt by polling.
+ Must not be called from a transaction callback.
+ @param  transaction descriptor
+ @retval 0 transaction done
+ @retval 1 transaction failed
+ */
+extern unsigned char i2c_transfer(i2c_transaction_t* transaction);
+
+/**
+ @brief Check if the TWI interrupt is running queued transactions
+ @retval 0 queue is empty
+ @retval 1 queue is busy
+ */
+extern unsigned char i2c_queue_busy(void);
+
+/** longest wait in us for a start condition, a byte or a stop condition before the bus is recovered */
+#define I2C_TIMEOUT_US 1000
+
+/** longest time in us i2c_start_wait() keeps polling a busy device */
+#define I2C_START_WAIT_TIMEOUT_US 20000UL
+
+/** number of devices with their own error counters, the devices after them share the last set */
+#define I2C_STATS_DEVICES 4
+
+/**
+ @brief Error counters of a device, from i2c_get_stats()
+ */
+typedef struct {
+	uint16_t naks;               /**< address or data byte not acknowledged */
+	uint16_t timeouts;           /**< waits longer than I2C_TIMEOUT_US, or I2C_START_WAIT_TIMEOUT_US */
+	uint16_t arbitrationLosses;  /**< another master took the bus */
+	uint16_t recoveries;         /**< bus recovered by clocking SCL by hand and sending a stop */
+} i2c_stats_t;
+
+/**
+ @brief Fail a queued transaction that has stopped moving
+
+ The TWI interrupt has no timer of its own, so this has to be called now and then while
+ transactions are queued, the main loop and the blocking functions call it. If the interrupt
+ has not run for I2C_TIMEOUT_US the bus is recovered, the transaction on the bus fails and the
+ next one is started.
+ @retval 0 no timeout
+ @retval 1 a transaction timed out
+ */
+extern unsigned char i2c_check_timeout(void);
+
+/**
+ @brief Copy the error counters of a device
+ @param  address device address, the R/W bit is ignored
+ @param  stats copied into, all zero if the device has had no errors
+ @return none
+ */
+extern void i2c_get_stats(unsigned char address, i2c_stats_t* stats);
+
+/**
+ @brief Zero the error counters of every device
+ @param  void
+ @return none
+ */
+extern void i2c_reset_stats(void);
+
+/** record every transaction for i2c_trace_take(), costs I2C_TRACE_SIZE * 12 bytes of RAM */
+/* #define I2C_TRACE */
+
+#ifdef I2C_TRACE
+/** number of trace records kept, a power of 2, the oldest is overwritten once it is full */
+#ifndef I2C_TRACE_SIZE
+#define I2C_TRACE_SIZE 16
+#endif
+
+/** directions of an i2c_trace_t, a write then read with a repeated start has both */
+#define I2C_TRACE_WRITE 0x01
+#define I2C_TRACE_READ  0x02
+
+/**
+ @brief Trace record of a transaction, queued or blocking, from the start condition to the stop
+ */
+typedef struct {
+	unsigned char address;    /**< device address with the R/W bit clear */
+	unsigned char direction;  /**< I2C_TRACE_x directions */
+	unsigned char count;      /**< bytes acknowledged or read after the address */
+	unsigned char status;     /**< I2C_TRANSACTION_DONE or I2C_TRANSACTION_FAILED */
+	uint32_t start;           /**< timer0_get_current_time_us() at the start condition */
+	uint32_t end;             /**< timer0_get_current_time_us() at the stop condition */
+} i2c_trace_t;
+
+/**
+ @brief Take the oldest trace record off the ring
+ @param  record copied into
+ @retval 0 record taken
+ @retval 1 no records
+ */
+extern unsigned char i2c_trace_take(i2c_trace_t* record);
+
+/**
+ @brief Get the number of records overwritten before they were taken, and zero it
+ @param  void
+ @return number of records lost
+ */
+extern unsigned int i2c_trace_lost(void);
+#endif /* I2C_TRACE */
+
+
+/*
+ The byte at a time functions below are the API of the original library. They wait for the
+ queue to empty, then drive the bus themselves by polling TWINT. The drivers use transactions,
+ these are kept for the I2C_BENCHMARK in main.c and code written for the original library.
+*/
 
 /** 
  @brief Terminates the data transfer and releases the I2C bus 
@@ -135,11 +375,12 @@ extern unsigned char i2c_rep_start(unsigned char addr);
 /**
  @brief Issues a start condition and sends address and transfer direction 
    
- If device is busy, use ack polling to wait until device ready 
+ If device is busy, use ack polling to wait until device ready, for up to I2C_START_WAIT_TIMEOUT_US
  @param    addr address and transfer direction of I2C device
- @return   none
+ @retval   0 device accessible
+ @retval   1 timed out
  */
-extern void i2c_start_wait(unsigned char addr);
+extern unsigned char i2c_start_wait(unsigned char addr);
 
  
 /**
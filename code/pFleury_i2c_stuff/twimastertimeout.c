@@ -1,6 +1,9 @@
 /*
  * modified version of I2C master library
  * added a timeout variable for non blocking i2c
+ * added a queue of transactions run by the TWI interrupt
+ * timeouts in microseconds from timer0, bus recovery and error counters
+ * optional trace of every transaction, see I2C_TRACE
  */
 
 /*************************************************************************
@@ -14,6 +17,10 @@
 #include "i2cmaster.h"
 #include <inttypes.h>
 #include <compat/twi.h>
+#include <avr/interrupt.h>
+#include <util/delay.h>
+#include <string.h>
+#include "../timer0_1ms_interrupts/timer0_1ms_interrupts.h"
 
 
 
@@ -25,8 +32,577 @@
 /* I2C clock in Hz */
 #define SCL_CLOCK  400000L
 
-/* I2C timer max delay */
-#define I2C_TIMER_DELAY 0xFF
+/* TWI pins, driven by hand to recover the bus */
+#define I2C_SDA_PIN PC4
+#define I2C_SCL_PIN PC5
+
+/* Stages of a queued transaction */
+#define I2C_PHASE_REGISTER 0  /* sending the reg byte */
+#define I2C_PHASE_WRITE    1  /* sending the write data */
+#define I2C_PHASE_READ     2  /* reading into the read buffer */
+
+/* The queue and trace ring indexes wrap with a mask */
+#if (I2C_QUEUE_SIZE < 1) || (I2C_QUEUE_SIZE & (I2C_QUEUE_SIZE - 1))
+#error "I2C_QUEUE_SIZE must be a power of 2"
+#endif
+#if defined(I2C_TRACE) && ((I2C_TRACE_SIZE < 1) || (I2C_TRACE_SIZE & (I2C_TRACE_SIZE - 1)))
+#error "I2C_TRACE_SIZE must be a power of 2"
+#endif
+
+/* Queued transactions, i2c_queue[i2c_queue_head] is the one on the bus */
+static i2c_transaction_t* volatile i2c_queue[I2C_QUEUE_SIZE];
+static volatile uint8_t i2c_queue_head = 0;
+static volatile uint8_t i2c_queue_count = 0;
+
+/* Set while the TWI interrupt owns the bus, from the first post until the queue is empty */
+static volatile uint8_t i2c_queue_running = 0;
+
+/* Progress of the transaction on the bus. i2c_addressed is set once the device has ACKed the
+   first address, i2c_begun is when the transaction started, both for I2C_TRANSACTION_WAIT */
+static uint8_t i2c_phase;
+static uint8_t i2c_index;
+static uint8_t i2c_addressed;
+static uint32_t i2c_begun;
+
+/* Counts the steps of the TWI interrupt so i2c_check_timeout() can tell it is still moving */
+static volatile uint16_t i2c_progress = 0;
+
+/* Address of the device last on the bus, and set once a byte at a time transfer has failed */
+static uint8_t i2c_address = 0;
+static uint8_t i2c_failed = 0;
+
+/* Error counters, one set for each device address seen */
+static uint8_t i2c_stats_address[I2C_STATS_DEVICES];
+static i2c_stats_t i2c_stats[I2C_STATS_DEVICES];
+
+#ifdef I2C_TRACE
+/* Finished transactions, i2c_trace[i2c_trace_head] is the oldest */
+static i2c_trace_t i2c_trace[I2C_TRACE_SIZE];
+static uint8_t i2c_trace_head = 0;
+static uint8_t i2c_trace_count = 0;
+static unsigned int i2c_trace_lost_count = 0;
+
+/* Transaction on the bus, added to the ring by its stop condition */
+static i2c_trace_t i2c_trace_current;
+static uint8_t i2c_trace_open = 0;
+
+static void i2c_trace_start(uint8_t address, uint8_t direction);
+static void i2c_trace_end(uint8_t status);
+#define I2C_TRACE_START(address, direction) i2c_trace_start((address), (direction))
+#define I2C_TRACE_BYTE() (i2c_trace_current.count++)
+#define I2C_TRACE_END(status) i2c_trace_end(status)
+#else
+#define I2C_TRACE_START(address, direction) ((void)0)
+#define I2C_TRACE_BYTE() ((void)0)
+#define I2C_TRACE_END(status) ((void)0)
+#endif /* I2C_TRACE */
+
+static void i2c_profile(const i2c_device_t* device);
+static uint8_t i2c_expired(uint32_t since, uint32_t timeout);
+static uint8_t i2c_wait_twint(void);
+static uint8_t i2c_wait_stop(void);
+static uint8_t i2c_error(uint8_t twst);
+static void i2c_count(uint8_t address, uint8_t twst);
+static void i2c_timed_out(uint8_t address);
+static void i2c_recover(void);
+static i2c_stats_t* i2c_stats_for(uint8_t address);
+static void i2c_begin(void);
+static void i2c_finish(uint8_t status);
+static void i2c_step(void);
+static void i2c_poll(void);
+
+/*************************************************************************
+ Wait until the TWI interrupt has finished the queued transactions and
+ the stop condition has been sent
+*************************************************************************/
+static void i2c_wait_unlocked(void)
+{
+	while (i2c_queue_running) i2c_poll();
+	if (TWCR & (1<<TWSTO)) i2c_wait_stop();
+}/* i2c_wait_unlocked */
+
+/*************************************************************************
+ Queue a transaction to be run by the TWI interrupt. If the bus is idle
+ the start condition is sent straight away.
+ Return:  0 queued, 1 the queue is full
+*************************************************************************/
+unsigned char i2c_post(i2c_transaction_t* transaction)
+{
+	uint8_t sreg = SREG;
+
+	cli();
+	if (i2c_queue_count == I2C_QUEUE_SIZE)
+	{
+		SREG = sreg;
+		return 1;
+	}
+	transaction->status = I2C_TRANSACTION_PENDING;
+	i2c_queue[(i2c_queue_head + i2c_queue_count) & (I2C_QUEUE_SIZE - 1)] = transaction;
+	i2c_queue_count++;
+
+	if (!i2c_queue_running)
+	{
+		// wait for the stop condition of a blocking transfer to be sent
+		if (TWCR & (1<<TWSTO)) i2c_wait_stop();
+		i2c_queue_running = 1;
+		i2c_begin();
+		TWCR = (1<<TWINT) | (1<<TWSTA) | (1<<TWEN) | (1<<TWIE);
+	}
+	SREG = sreg;
+	return 0;
+
+}/* i2c_post */
+
+/*************************************************************************
+ Queue a transaction and wait for it to finish. With global interrupts
+ disabled the TWI interrupt is run by polling TWINT.
+ Return:  0 transaction done, 1 transaction failed
+*************************************************************************/
+unsigned char i2c_transfer(i2c_transaction_t* transaction)
+{
+	while (i2c_post(transaction))
+	{
+		i2c_poll();
+	}
+	while (transaction->status == I2C_TRANSACTION_PENDING)
+	{
+		i2c_poll();
+	}
+	return (transaction->status != I2C_TRANSACTION_DONE);
+
+}/* i2c_transfer */
+
+/*************************************************************************
+ Move the queue on while waiting for it. With global interrupts disabled
+ the TWI interrupt cannot run, so its step is run here when TWINT is set.
+*************************************************************************/
+static void i2c_poll(void)
+{
+	if (!(SREG & (1<<SREG_I)) && (TWCR & (1<<TWINT))) i2c_step();
+	i2c_check_timeout();
+
+}/* i2c_poll */
+
+/*************************************************************************
+ Return: 1 if the TWI interrupt is running queued transactions, 0 otherwise
+*************************************************************************/
+unsigned char i2c_queue_busy(void)
+{
+	return i2c_queue_running;
+}/* i2c_queue_busy */
+
+/*************************************************************************
+ Check the TWI interrupt is still moving the queued transactions on. If
+ it has not run for I2C_TIMEOUT_US the bus is recovered, the transaction
+ on the bus fails and the queue moves on to the next one.
+ The TWI interrupt is turned off while the bus is recovered, the queue
+ stays marked as running so i2c_post() only queues, and the recovery
+ itself runs with global interrupts as the caller had them.
+ Return:  0 no timeout, 1 a transaction timed out
+*************************************************************************/
+unsigned char i2c_check_timeout(void)
+{
+	static uint8_t watching = 0;
+	static uint16_t watchedProgress;
+	static uint32_t watchedSince;
+	uint16_t progress;
+	uint8_t address;
+	uint8_t sreg = SREG;
+
+	if (!i2c_queue_running)
+	{
+		watching = 0;
+		return 0;
+	}
+
+	cli();
+	progress = i2c_progress;
+	SREG = sreg;
+
+	if (!watching || (progress != watchedProgress))
+	{
+		watching = 1;
+		watchedProgress = progress;
+		watchedSince = timer0_get_current_time_us();
+		return 0;
+	}
+	if (!i2c_expired(watchedSince, I2C_TIMEOUT_US)) return 0;
+
+	watching = 0;
+	cli();
+	// the interrupt may have run since the progress was read
+	if (!i2c_queue_running || (i2c_progress != watchedProgress))
+	{
+		SREG = sreg;
+		return 0;
+	}
+	address = i2c_queue[i2c_queue_head]->device->address;
+	TWCR = 0;  // no more TWI interrupts until the queue is moved on
+	SREG = sreg;
+
+	i2c_timed_out(address);
+
+	cli();
+	i2c_finish(I2C_TRANSACTION_FAILED);
+	SREG = sreg;
+	return 1;
+
+}/* i2c_check_timeout */
+
+/*************************************************************************
+ Copy the error counters of a device, all zero if it has had no errors
+*************************************************************************/
+void i2c_get_stats(unsigned char address, i2c_stats_t* stats)
+{
+	uint8_t sreg = SREG;
+
+	address &= 0xFE;
+	memset(stats, 0, sizeof(i2c_stats_t));
+	cli();
+	for (uint8_t i = 0; i < I2C_STATS_DEVICES; i++)
+	{
+		if (i2c_stats_address[i] == address) *stats = i2c_stats[i];
+	}
+	SREG = sreg;
+
+}/* i2c_get_stats */
+
+/*************************************************************************
+ Zero the error counters of every device
+*************************************************************************/
+void i2c_reset_stats(void)
+{
+	uint8_t sreg = SREG;
+
+	cli();
+	memset(i2c_stats_address, 0, sizeof(i2c_stats_address));
+	memset(i2c_stats, 0, sizeof(i2c_stats));
+	SREG = sreg;
+
+}/* i2c_reset_stats */
+
+/*************************************************************************
+ Find the error counters of a device. A new device gets the first free
+ set, the last set is shared once they have all been given out.
+*************************************************************************/
+static i2c_stats_t* i2c_stats_for(uint8_t address)
+{
+	uint8_t i;
+
+	for (i = 0; i < I2C_STATS_DEVICES - 1; i++)
+	{
+		if ((i2c_stats_address[i] == address) || (i2c_stats_address[i] == 0)) break;
+	}
+	if (i2c_stats_address[i] == 0) i2c_stats_address[i] = address;
+	return &i2c_stats[i];
+
+}/* i2c_stats_for */
+
+/*************************************************************************
+ Count a TWI status that failed a transfer against a device
+*************************************************************************/
+static void i2c_count(uint8_t address, uint8_t twst)
+{
+	switch (twst)
+	{
+	case TW_MT_SLA_NACK:
+	case TW_MT_DATA_NACK:
+	case TW_MR_SLA_NACK:
+		i2c_stats_for(address)->naks++;
+		break;
+
+	case TW_MT_ARB_LOST:
+		i2c_stats_for(address)->arbitrationLosses++;
+		break;
+	}
+}/* i2c_count */
+
+/*************************************************************************
+ Count a timeout against a device and recover the bus
+*************************************************************************/
+static void i2c_timed_out(uint8_t address)
+{
+	i2c_stats_t* stats = i2c_stats_for(address);
+
+	stats->timeouts++;
+	i2c_recover();
+	stats->recoveries++;
+
+}/* i2c_timed_out */
+
+/*************************************************************************
+ Free a bus held by a device part way through a byte. SCL is clocked by
+ hand until the device lets go of SDA, up to 9 times, then a stop
+ condition is sent by hand and the TWI is enabled again.
+*************************************************************************/
+static void i2c_recover(void)
+{
+	TWCR = 0;  // give the pins back to PORTC
+
+	// the pins are only ever pulled low, released the pull ups take them high
+	PORTC &= ~((1<<I2C_SDA_PIN) | (1<<I2C_SCL_PIN));
+	DDRC &= ~((1<<I2C_SDA_PIN) | (1<<I2C_SCL_PIN));
+	_delay_us(5);
+
+	for (uint8_t i = 0; (i < 9) && !(PINC & (1<<I2C_SDA_PIN)); i++)
+	{
+		DDRC |= (1<<I2C_SCL_PIN);
+		_delay_us(5);
+		DDRC &= ~(1<<I2C_SCL_PIN);
+		_delay_us(5);
+	}
+
+	// stop condition, SDA rises while SCL is high
+	DDRC |= (1<<I2C_SCL_PIN);
+	_delay_us(5);
+	DDRC |= (1<<I2C_SDA_PIN);
+	_delay_us(5);
+	DDRC &= ~(1<<I2C_SCL_PIN);
+	_delay_us(5);
+	DDRC &= ~(1<<I2C_SDA_PIN);
+	_delay_us(5);
+
+	// TWBR and TWSR are kept, so the device profile still applies
+	TWCR = (1<<TWEN);
+
+}/* i2c_recover */
+
+#ifdef I2C_TRACE
+/*************************************************************************
+ Take the oldest trace record off the ring
+ Return:  0 record taken, 1 no records
+*************************************************************************/
+unsigned char i2c_trace_take(i2c_trace_t* record)
+{
+	uint8_t sreg = SREG;
+
+	cli();
+	if (i2c_trace_count == 0)
+	{
+		SREG = sreg;
+		return 1;
+	}
+	*record = i2c_trace[i2c_trace_head];
+	i2c_trace_head = (i2c_trace_head + 1) & (I2C_TRACE_SIZE - 1);
+	i2c_trace_count--;
+	SREG = sreg;
+	return 0;
+
+}/* i2c_trace_take */
+
+/*************************************************************************
+ Return: the number of records overwritten before they were taken, the
+ count is zeroed
+*************************************************************************/
+unsigned int i2c_trace_lost(void)
+{
+	unsigned int lost;
+	uint8_t sreg = SREG;
+
+	cli();
+	lost = i2c_trace_lost_count;
+	i2c_trace_lost_count = 0;
+	SREG = sreg;
+	return lost;
+
+}/* i2c_trace_lost */
+
+/*************************************************************************
+ Open the trace record of a transaction at its start condition. A
+ repeated start adds its direction to the record already open.
+*************************************************************************/
+static void i2c_trace_start(uint8_t address, uint8_t direction)
+{
+	if (!i2c_trace_open)
+	{
+		i2c_trace_open = 1;
+		i2c_trace_current.address = address;
+		i2c_trace_current.direction = 0;
+		i2c_trace_current.count = 0;
+		i2c_trace_current.start = timer0_get_current_time_us();
+	}
+	i2c_trace_current.direction |= direction;
+
+}/* i2c_trace_start */
+
+/*************************************************************************
+ Close the open trace record at the stop condition and add it to the
+ ring, overwriting the oldest record when the ring is full
+*************************************************************************/
+static void i2c_trace_end(uint8_t status)
+{
+	uint8_t sreg = SREG;
+
+	if (!i2c_trace_open) return;
+	i2c_trace_open = 0;
+	i2c_trace_current.status = status;
+	i2c_trace_current.end = timer0_get_current_time_us();
+
+	cli();
+	if (i2c_trace_count == I2C_TRACE_SIZE)
+	{
+		i2c_trace_head = (i2c_trace_head + 1) & (I2C_TRACE_SIZE - 1);
+		i2c_trace_lost_count++;
+	}
+	else
+	{
+		i2c_trace_count++;
+	}
+	i2c_trace[(i2c_trace_head + i2c_trace_count - 1) & (I2C_TRACE_SIZE - 1)] = i2c_trace_current;
+	SREG = sreg;
+
+}/* i2c_trace_end */
+#endif /* I2C_TRACE */
+
+/*************************************************************************
+ Get ready to run the transaction at the head of the queue, the caller
+ sends the start condition
+*************************************************************************/
+static void i2c_begin(void)
+{
+	i2c_transaction_t* transaction = i2c_queue[i2c_queue_head];
+
+	i2c_profile(transaction->device);
+	i2c_address = transaction->device->address;
+	i2c_index = 0;
+	i2c_addressed = 0;
+	if (transaction->flags & I2C_TRANSACTION_WAIT) i2c_begun = timer0_get_current_time_us();
+	if (transaction->flags & I2C_TRANSACTION_REGISTER)
+		i2c_phase = I2C_PHASE_REGISTER;
+	else if (transaction->writeLength || !transaction->readLength)
+		i2c_phase = I2C_PHASE_WRITE;
+	else
+		i2c_phase = I2C_PHASE_READ;
+
+	I2C_TRACE_START(i2c_address, ((i2c_phase != I2C_PHASE_READ) ? I2C_TRACE_WRITE : 0) | (transaction->readLength ? I2C_TRACE_READ : 0));
+
+}/* i2c_begin */
+
+/*************************************************************************
+ Take the transaction on the bus off the queue and call its callback,
+ then start the next one or send the stop condition
+*************************************************************************/
+static void i2c_finish(uint8_t status)
+{
+	i2c_transaction_t* transaction = i2c_queue[i2c_queue_head];
+
+	I2C_TRACE_END(status);
+	i2c_queue_head = (i2c_queue_head + 1) & (I2C_QUEUE_SIZE - 1);
+	i2c_queue_count--;
+	transaction->status = status;
+
+	// the queue is still running so a transaction posted by the callback waits its turn
+	if (transaction->callback) transaction->callback(transaction);
+
+	if (i2c_queue_count)
+	{
+		i2c_begin();
+		TWCR = (1<<TWINT) | (1<<TWSTO) | (1<<TWSTA) | (1<<TWEN) | (1<<TWIE);
+	}
+	else
+	{
+		TWCR = (1<<TWINT) | (1<<TWEN) | (1<<TWSTO);
+		i2c_queue_running = 0;
+	}
+
+}/* i2c_finish */
+
+/*************************************************************************
+ Move the transaction on the bus on by one step, called each time TWINT
+ is set
+*************************************************************************/
+static void i2c_step(void)
+{
+	i2c_transaction_t* transaction = i2c_queue[i2c_queue_head];
+
+	i2c_progress++;
+	switch (TW_STATUS)
+	{
+	case TW_START:
+	case TW_REP_START:
+		TWDR = transaction->device->address | ((i2c_phase == I2C_PHASE_READ) ? I2C_READ : I2C_WRITE);
+		break;
+
+	case TW_MT_SLA_ACK:
+	case TW_MT_DATA_ACK:
+		if (TW_STATUS == TW_MT_DATA_ACK) I2C_TRACE_BYTE();
+		i2c_addressed = 1;
+		if (i2c_phase == I2C_PHASE_REGISTER)
+		{
+			TWDR = transaction->reg;
+			i2c_phase = I2C_PHASE_WRITE;
+			break;
+		}
+		if (i2c_index < transaction->writeLength)
+		{
+			TWDR = transaction->writeData[i2c_index++];
+			break;
+		}
+		if (transaction->readLength)
+		{
+			// repeated start for the read
+			i2c_phase = I2C_PHASE_READ;
+			i2c_index = 0;
+			TWCR = (1<<TWINT) | (1<<TWSTA) | (1<<TWEN) | (1<<TWIE);
+			return;
+		}
+		i2c_finish(I2C_TRANSACTION_DONE);
+		return;
+
+	case TW_MR_DATA_ACK:
+		I2C_TRACE_BYTE();
+		transaction->readData[i2c_index++] = TWDR;
+		break;
+
+	case TW_MR_DATA_NACK:
+		I2C_TRACE_BYTE();
+		transaction->readData[i2c_index] = TWDR;
+		i2c_finish(I2C_TRANSACTION_DONE);
+		return;
+
+	case TW_MR_SLA_ACK:
+		i2c_addressed = 1;
+		break;
+
+	case TW_MT_SLA_NACK:
+	case TW_MR_SLA_NACK:
+		// a busy device, eg. an EEPROM writing a page, is polled the same as i2c_start_wait()
+		if ((transaction->flags & I2C_TRANSACTION_WAIT) && !i2c_addressed)
+		{
+			if (!i2c_expired(i2c_begun, I2C_START_WAIT_TIMEOUT_US))
+			{
+				TWCR = (1<<TWINT) | (1<<TWSTO) | (1<<TWSTA) | (1<<TWEN) | (1<<TWIE);
+				return;
+			}
+			// the device has been busy too long, the bus itself is fine
+			if (!(transaction->flags & I2C_TRANSACTION_NO_STATS)) i2c_stats_for(transaction->device->address)->timeouts++;
+			i2c_finish(I2C_TRANSACTION_FAILED);
+			return;
+		}
+		// fall through
+
+	default:
+		// NAK, lost arbitration or bus error
+		if (!(transaction->flags & I2C_TRANSACTION_NO_STATS)) i2c_count(transaction->device->address, TW_STATUS);
+		i2c_finish(I2C_TRANSACTION_FAILED);
+		return;
+	}
+
+	// ACK every byte read but the last
+	if ((i2c_phase == I2C_PHASE_READ) && ((i2c_index + 1) < transaction->readLength))
+		TWCR = (1<<TWINT) | (1<<TWEA) | (1<<TWEN) | (1<<TWIE);
+	else
+		TWCR = (1<<TWINT) | (1<<TWEN) | (1<<TWIE);
+
+}/* i2c_step */
+
+/*************************************************************************
+ TWI interrupt service routine, runs the queued transactions
+*************************************************************************/
+ISR(TWI_vect)
+{
+	i2c_step();
+}
 
 /*************************************************************************
  Initialization of the I2C bus interface. Need to be called only once
@@ -40,7 +616,12 @@ void i2c_init(void)
 
 }/* i2c_init */
 
+/*************************************************************************
+ Set the bit rate, the divide is worked out and the TWI restarted every
+ call. Use i2c_select() with an i2c_device_t for the drivers.
+*************************************************************************/
 void i2c_set_bitrate(uint32_t bitrate) {
+	i2c_wait_unlocked();
 	TWCR &= ~(1 << TWEN);	/* Disable twi */
 	TWSR = 0;                         /* no prescaler */
 	TWBR = ((F_CPU/bitrate)-16)/2;  /* must be > 10 for stable operation */
@@ -48,41 +629,164 @@ void i2c_set_bitrate(uint32_t bitrate) {
 }
 
 
+/*************************************************************************
+ Switch the bus to the bit rate of a device once the queued transactions
+ have finished
+*************************************************************************/
+void i2c_select(const i2c_device_t* device)
+{
+	i2c_wait_unlocked();
+	i2c_profile(device);
+
+}/* i2c_select */
+
+/*************************************************************************
+ Write bytes to consecutive registers of a device in one transfer, run
+ through the queue by the TWI interrupt, polling a busy device
+ 
+ Input:   device profile, first register, bytes and number of bytes
+ Return:  0 written, 1 failed
+*************************************************************************/
+unsigned char i2c_write_regs(const i2c_device_t* device, unsigned char reg, const unsigned char* data, unsigned char length)
+{
+	i2c_transaction_t transaction = {device, I2C_TRANSACTION_REGISTER | I2C_TRANSACTION_WAIT, reg, data, length, 0, 0, 0, I2C_TRANSACTION_PENDING};
+
+	return i2c_transfer(&transaction);
+
+}/* i2c_write_regs */
+
+/*************************************************************************
+ Read bytes from consecutive registers of a device in one transfer, run
+ through the queue by the TWI interrupt, polling a busy device
+ 
+ Input:   device profile, first register, buffer and number of bytes
+ Return:  0 read, 1 failed
+*************************************************************************/
+unsigned char i2c_read_regs(const i2c_device_t* device, unsigned char reg, unsigned char* data, unsigned char length)
+{
+	i2c_transaction_t transaction = {device, I2C_TRANSACTION_REGISTER | I2C_TRANSACTION_WAIT, reg, 0, 0, data, length, 0, I2C_TRANSACTION_PENDING};
+
+	return i2c_transfer(&transaction);
+
+}/* i2c_read_regs */
+
+/*************************************************************************
+ Write the bit rate of a device to TWBR and TWSR, only if the bus is not
+ already using it
+*************************************************************************/
+static void i2c_profile(const i2c_device_t* device)
+{
+	if ((TWBR != device->twbr) || ((TWSR & 0x03) != device->twsr))
+	{
+		TWBR = device->twbr;
+		TWSR = device->twsr;
+	}
+}/* i2c_profile */
+
+
+/*************************************************************************
+ Return: 1 once more than timeout us have gone by since the timer0 time
+ since, 0 otherwise
+*************************************************************************/
+static uint8_t i2c_expired(uint32_t since, uint32_t timeout)
+{
+	// signed so a time read just before the timer0 interrupt ran is not taken as a wrap
+	return ((int32_t)(timer0_get_current_time_us() - since) > (int32_t)timeout);
+
+}/* i2c_expired */
+
+/*************************************************************************
+ Wait for TWINT to be set, recovering the bus if it takes longer than
+ I2C_TIMEOUT_US
+ Return:  0 TWINT set, 1 timed out
+*************************************************************************/
+static uint8_t i2c_wait_twint(void)
+{
+	uint32_t start = timer0_get_current_time_us();
+
+	while (!(TWCR & (1<<TWINT)))
+	{
+		if (i2c_expired(start, I2C_TIMEOUT_US))
+		{
+			i2c_timed_out(i2c_address);
+			i2c_failed = 1;
+			return 1;
+		}
+	}
+	return 0;
+
+}/* i2c_wait_twint */
+
+/*************************************************************************
+ Wait for the stop condition to be sent, recovering the bus if it takes
+ longer than I2C_TIMEOUT_US
+ Return:  0 stop sent, 1 timed out
+*************************************************************************/
+static uint8_t i2c_wait_stop(void)
+{
+	uint32_t start = timer0_get_current_time_us();
+
+	while (TWCR & (1<<TWSTO))
+	{
+		if (i2c_expired(start, I2C_TIMEOUT_US))
+		{
+			i2c_timed_out(i2c_address);
+			return 1;
+		}
+	}
+	return 0;
+
+}/* i2c_wait_stop */
+
+/*************************************************************************
+ Count a TWI status that ended a blocking transfer, the rest of the
+ transfer fails without touching the bus until the next start
+ Return:  1
+*************************************************************************/
+static uint8_t i2c_error(uint8_t twst)
+{
+	i2c_count(i2c_address, twst);
+	i2c_failed = 1;
+	return 1;
+
+}/* i2c_error */
+
+
 /*************************************************************************	
   Issues a start condition and sends address and transfer direction.
   return 0 = device accessible, 1= failed to access device
 *************************************************************************/
 unsigned char i2c_start(unsigned char address)
 {
-	uint32_t  i2c_timer = 0;
     uint8_t   twst;
 
+	i2c_wait_unlocked();
+	i2c_address = address & 0xFE;
+	i2c_failed = 0;
+	I2C_TRACE_START(i2c_address, (address & I2C_READ) ? I2C_TRACE_READ : I2C_TRACE_WRITE);
+
 	// send START condition
 	TWCR = (1<<TWINT) | (1<<TWSTA) | (1<<TWEN);
 
 	// wait until transmission completed
-	i2c_timer = I2C_TIMER_DELAY;
-	while(!(TWCR & (1<<TWINT)) && i2c_timer--);
-	if(i2c_timer == 0)
+	if (i2c_wait_twint())
 		return 1;
 
 	// check value of TWI Status Register. Mask prescaler bits.
 	twst = TW_STATUS & 0xF8;
-	if ( (twst != TW_START) && (twst != TW_REP_START)) return 1;
+	if ( (twst != TW_START) && (twst != TW_REP_START)) return i2c_error(twst);
 
 	// send device address
 	TWDR = address;
 	TWCR = (1<<TWINT) | (1<<TWEN);
 
 	// wail until transmission completed and ACK/NACK has been received
-	i2c_timer = I2C_TIMER_DELAY;
-	while(!(TWCR & (1<<TWINT)) && i2c_timer--);
-	if(i2c_timer == 0)
+	if (i2c_wait_twint())
 		return 1;
 
 	// check value of TWI Status Register. Mask prescaler bits.
 	twst = TW_STATUS & 0xF8;
-	if ( (twst != TW_MT_SLA_ACK) && (twst != TW_MR_SLA_ACK) ) return 1;
+	if ( (twst != TW_MT_SLA_ACK) && (twst != TW_MR_SLA_ACK) ) return i2c_error(twst);
 
 	return 0;
 
@@ -91,23 +795,40 @@ unsigned char i2c_start(unsigned char address)
 
 /*************************************************************************
  Issues a start condition and sends address and transfer direction.
- If device is busy, use ack polling to wait until device is ready
+ If device is busy, use ack polling to wait until device is ready, for
+ up to I2C_START_WAIT_TIMEOUT_US
  
  Input:   address and transfer direction of I2C device
+ Return:  0 device accessible
+          1 timed out
 *************************************************************************/
-void i2c_start_wait(unsigned char address)
+unsigned char i2c_start_wait(unsigned char address)
 {
-	uint32_t  i2c_timer = 0;
+	uint32_t  start;
 	uint8_t   twst;
 
+	i2c_wait_unlocked();
+	i2c_address = address & 0xFE;
+	i2c_failed = 0;
+	I2C_TRACE_START(i2c_address, (address & I2C_READ) ? I2C_TRACE_READ : I2C_TRACE_WRITE);
+	start = timer0_get_current_time_us();
+
     while ( 1 )
     {
+    	// the device has been busy too long, the bus itself is fine
+    	if (i2c_expired(start, I2C_START_WAIT_TIMEOUT_US))
+    	{
+    	    i2c_stats_for(i2c_address)->timeouts++;
+    	    i2c_failed = 1;
+    	    return 1;
+    	}
+
 	    // send START condition
 	    TWCR = (1<<TWINT) | (1<<TWSTA) | (1<<TWEN);
     
     	// wait until transmission completed
-	    i2c_timer = I2C_TIMER_DELAY;
-    	while(!(TWCR & (1<<TWINT)) && i2c_timer--);
+    	if (i2c_wait_twint())
+    	    return 1;
 
     	// check value of TWI Status Register. Mask prescaler bits.
     	twst = TW_STATUS & 0xF8;
@@ -118,8 +839,8 @@ void i2c_start_wait(unsigned char address)
     	TWCR = (1<<TWINT) | (1<<TWEN);
     
     	// wail until transmission completed
-    	i2c_timer = I2C_TIMER_DELAY;
-    	while(!(TWCR & (1<<TWINT)) && i2c_timer--);
+    	if (i2c_wait_twint())
+    	    return 1;
     
     	// check value of TWI Status Register. Mask prescaler bits.
     	twst = TW_STATUS & 0xF8;
@@ -129,14 +850,15 @@ void i2c_start_wait(unsigned char address)
 	        TWCR = (1<<TWINT) | (1<<TWEN) | (1<<TWSTO);
 	        
 	        // wait until stop condition is executed and bus released
-	        i2c_timer = I2C_TIMER_DELAY;
-	        while((TWCR & (1<<TWSTO)) && i2c_timer--);
+	        if (i2c_wait_stop())
+	            return 1;
 	        
     	    continue;
     	}
     	//if( twst != TW_MT_SLA_ACK) return 1;
     	break;
      }
+    return 0;
 
 }/* i2c_start_wait */
 
@@ -151,6 +873,8 @@ void i2c_start_wait(unsigned char address)
 *************************************************************************/
 unsigned char i2c_rep_start(unsigned char address)
 {
+	if (i2c_failed)
+		return 1;
     return i2c_start( address );
 
 }/* i2c_rep_start */
@@ -161,14 +885,12 @@ unsigned char i2c_rep_start(unsigned char address)
 *************************************************************************/
 void i2c_stop(void)
 {
-	uint32_t  i2c_timer = 0;
-
     /* send stop condition */
 	TWCR = (1<<TWINT) | (1<<TWEN) | (1<<TWSTO);
 	
 	// wait until stop condition is executed and bus released
-	i2c_timer = I2C_TIMER_DELAY;
-	while((TWCR & (1<<TWSTO)) && i2c_timer--);
+	i2c_wait_stop();
+	I2C_TRACE_END(i2c_failed ? I2C_TRANSACTION_FAILED : I2C_TRANSACTION_DONE);
 
 }/* i2c_stop */
 
@@ -182,22 +904,23 @@ void i2c_stop(void)
 *************************************************************************/
 unsigned char i2c_write( unsigned char data )
 {	
-	uint32_t  i2c_timer = 0;
     uint8_t   twst;
+
+	if (i2c_failed)
+		return 1;
     
 	// send data to the previously addressed device
 	TWDR = data;
 	TWCR = (1<<TWINT) | (1<<TWEN);
 
 	// wait until transmission completed
-	i2c_timer = I2C_TIMER_DELAY;
-	while(!(TWCR & (1<<TWINT)) && i2c_timer--);
-	if(i2c_timer == 0)
+	if (i2c_wait_twint())
 		return 1;
 
 	// check value of TWI Status Register. Mask prescaler bits
 	twst = TW_STATUS & 0xF8;
-	if( twst != TW_MT_DATA_ACK) return 1;
+	if( twst != TW_MT_DATA_ACK) return i2c_error(twst);
+	I2C_TRACE_BYTE();
 	return 0;
 
 }/* i2c_write */
@@ -210,13 +933,13 @@ unsigned char i2c_write( unsigned char data )
 *************************************************************************/
 unsigned char i2c_readAck(void)
 {
-	uint32_t  i2c_timer = 0;
+	if (i2c_failed)
+		return 0;
 
 	TWCR = (1<<TWINT) | (1<<TWEN) | (1<<TWEA);
-	i2c_timer = I2C_TIMER_DELAY;
-	while(!(TWCR & (1<<TWINT)) && i2c_timer--);
-	if(i2c_timer == 0)
+	if (i2c_wait_twint())
 		return 0;
+	I2C_TRACE_BYTE();
 
     return TWDR;
 
@@ -230,13 +953,13 @@ unsigned char i2c_readAck(void)
 *************************************************************************/
 unsigned char i2c_readNak(void)
 {
-	uint32_t  i2c_timer = 0;
+	if (i2c_failed)
+		return 0;
 
 	TWCR = (1<<TWINT) | (1<<TWEN);
-	i2c_timer = I2C_TIMER_DELAY;
-	while(!(TWCR & (1<<TWINT)) && i2c_timer--);
-	if(i2c_timer == 0)
+	if (i2c_wait_twint())
 		return 0;
+	I2C_TRACE_BYTE();
 	
     return TWDR;
 
@@ -0,0 +1,171 @@
+/*
+ **************************************************************
+ * render_scheduler.c
+ * Part of the Roll Clock project. Decides when the main
+ * loop should draw and send a frame. A frame is only drawn
+ * once something on the screen has been invalidated, and no
+ * more often than the frame rate cap allows, so the i2c bus is
+ * left free for the sensors the rest of the time.
+ **************************************************************
+ * EXTERNAL FUNCTIONS
+ **************************************************************
+ * RENDER_init() - Initialise the scheduler and ask for a first
+ * frame.
+ * RENDER_set_max_fps() - Change the frame rate cap.
+ * RENDER_invalidate() - Ask for a frame to be drawn.
+ * RENDER_frame_due() - Check if a frame should be drawn now.
+ * RENDER_get_stats() - Get the number of frames drawn and
+ * skipped.
+ * RENDER_reset_stats() - Zero the frame counts.
+ **************************************************************
+*/
+
+#include <avr/io.h>
+#include <string.h>
+
+#include "render_scheduler.h"
+#include "../timer0_1ms_interrupts/timer0_1ms_interrupts.h"
+#include "../SH1106_OLED/SH1106.h"
+
+static uint8_t _pendingReasons;		/* Reasons the next frame has been asked for, 0 = none */
+static uint16_t _frameInterval;		/* Shortest time between frames in ms, 0 = no cap */
+static uint32_t _lastFrameTime;		/* timer0 time the last frame was drawn */
+static uint32_t _slotTime;			/* Start of the frame slot being counted as skipped */
+static render_stats_t _stats;
+
+/* Kept with the pending reasons once the frame has been counted as deferred */
+#define RENDER_DEFERRED 0x40
+
+/* Private function prototypes */
+static void _defer();
+
+/*
+* RENDER_init()
+* -------------
+* External function to initialise the scheduler with the RENDER_MAX_FPS cap and ask for
+* the first frame, which is drawn straight away.
+*
+* NOTE:
+*	-	timer0 must be initialised first.
+*/
+void RENDER_init() {
+	RENDER_set_max_fps(RENDER_MAX_FPS);
+	RENDER_reset_stats();
+	_lastFrameTime = timer0_get_current_time();
+	_slotTime = _lastFrameTime;
+	_pendingReasons = RENDER_REASON_ALL | RENDER_NOW;
+}
+
+/*
+* RENDER_set_max_fps()
+* --------------------
+* External function to change the most frames drawn per second.
+*
+* fps: Frames per second, 0 = draw a frame as soon as one is invalidated.
+*/
+void RENDER_set_max_fps(uint8_t fps) {
+	if (fps == 0) {
+		_frameInterval = 0;
+	} else {
+		_frameInterval = 1000 / fps;
+	}
+}
+
+/*
+* RENDER_invalidate()
+* -------------------
+* External function to ask for a frame to be drawn because something on the screen has
+* changed. Reasons given before the frame is drawn are combined.
+*
+* reasons: RENDER_REASON_x flags, plus RENDER_NOW to draw the frame without waiting for
+* the frame rate cap.
+*
+* NOTE:
+*	-	Only call this from the main loop, not from an interrupt.
+*/
+void RENDER_invalidate(uint8_t reasons) {
+	_pendingReasons |= reasons;
+}
+
+/*
+* RENDER_frame_due()
+* ------------------
+* External function to check if a frame should be drawn now. When it should, the invalidated
+* reasons are cleared and the frame is counted as drawn, so the caller must draw and send
+* the frame before checking again.
+*
+* Return:	The RENDER_REASON_x flags the frame was asked for, without RENDER_NOW.
+*			0 if there is nothing to draw, or the frame has to wait.
+*
+* NOTE:
+*	-	With nothing invalidated, one frame is counted as skipped for every frame interval
+*		that goes by, or every 1ms with no cap.
+*	-	A frame waits while the last interrupt driven flush is still sending, so the main
+*		loop is not held up in OLED_clear_buffer() or OLED_display_buffer_async().
+*/
+uint8_t RENDER_frame_due() {
+	uint8_t reasons = _pendingReasons;
+	uint32_t currentTime = timer0_get_current_time();
+	uint16_t slot = _frameInterval ? _frameInterval : 1;
+	
+	if (reasons == 0) {
+		// Count each frame slot at the cap that went by without needing a frame
+		while ((currentTime - _slotTime) >= slot) {
+			_stats.skipped++;
+			_slotTime += slot;
+		}
+		return 0;
+	}
+	
+	#ifndef OLED_PAGE_RENDERER
+		if (OLED_flush_busy()) {
+			_defer();
+			return 0;
+		}
+	#endif /* OLED_PAGE_RENDERER */
+	
+	if (!(reasons & RENDER_NOW) && ((currentTime - _lastFrameTime) < _frameInterval)) {
+		_defer();
+		return 0;
+	}
+	
+	_pendingReasons = 0;
+	_lastFrameTime = currentTime;
+	_slotTime = currentTime;
+	_stats.rendered++;
+	
+	return reasons & RENDER_REASON_ALL;
+}
+
+/*
+* _defer()
+* --------
+* Private function to count a frame that has to wait, once however many times it is checked.
+*/
+static void _defer() {
+	if (!(_pendingReasons & RENDER_DEFERRED)) {
+		_pendingReasons |= RENDER_DEFERRED;
+		_stats.deferred++;
+	}
+}
+
+/*
+* RENDER_get_stats()
+* ------------------
+* External function to get the number of frames drawn and skipped since RENDER_init() or
+* RENDER_reset_stats().
+*
+* stats: Copied into from the scheduler.
+*/
+void RENDER_get_stats(render_stats_t* stats) {
+	*stats = _stats;
+}
+
+/*
+* RENDER_reset_stats()
+* --------------------
+* External function to zero the frame counts.
+*/
+void RENDER_reset_stats() {
+	memset(&_stats, 0, sizeof(_stats));
+}
@@ -0,0 +1,55 @@
+/*
+ **************************************************************
+ * render_scheduler.h
+ * Part of the Roll Clock project. Decides when the main
+ * loop should draw and send a frame. A frame is only drawn
+ * once something on the screen has been invalidated, and no
+ * more often than the frame rate cap allows, so the i2c bus is
+ * left free for the sensors the rest of the time.
+ **************************************************************
+ * EXTERNAL FUNCTIONS
+ **************************************************************
+ * RENDER_init() - Initialise the scheduler and ask for a first
+ * frame.
+ * RENDER_set_max_fps() - Change the frame rate cap.
+ * RENDER_invalidate() - Ask for a frame to be drawn.
+ * RENDER_frame_due() - Check if a frame should be drawn now.
+ * RENDER_get_stats() - Get the number of frames drawn and
+ * skipped.
+ * RENDER_reset_stats() - Zero the frame counts.
+ **************************************************************
+*/
+
+#ifndef RENDER_SCHEDULER_H_
+#define RENDER_SCHEDULER_H_
+
+#include <stdint.h>
+
+/* Frame rate cap used by RENDER_init(), 0 = no cap */
+#define RENDER_MAX_FPS 20
+
+/* Reasons for RENDER_invalidate(), returned by RENDER_frame_due() */
+#define RENDER_REASON_TICK			0x01	/* The RTC seconds have changed */
+#define RENDER_REASON_BUTTON		0x02	/* A button has been pressed or is held down */
+#define RENDER_REASON_SENSOR		0x04	/* New temperature and humidity readings */
+#define RENDER_REASON_ORIENTATION	0x08	/* The clock has been turned to another mode */
+#define RENDER_REASON_ALARM			0x10	/* The alarm has been armed or disarmed */
+#define RENDER_REASON_ALL			0x1F
+
+/* Added to the reasons given to RENDER_invalidate() to draw the frame without waiting for the cap */
+#define RENDER_NOW 0x80
+
+typedef struct {
+	uint32_t rendered;	/* Frames drawn */
+	uint32_t skipped;	/* Checks with nothing invalidated, each one a frame the bus did not have to send */
+	uint32_t deferred;	/* Checks with a frame waiting on the cap or an unfinished flush */
+} render_stats_t;
+
+void RENDER_init();
+void RENDER_set_max_fps(uint8_t fps);
+void RENDER_invalidate(uint8_t reasons);
+uint8_t RENDER_frame_due();
+void RENDER_get_stats(render_stats_t* stats);
+void RENDER_reset_stats();
+
+#endif /* RENDER_SCHEDULER_H_ */
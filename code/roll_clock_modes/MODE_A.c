@@ -25,16 +25,20 @@
 #include "MODE_A.h"
 #include "../MCP7940N_RTCC/MCP7940N.h"
 #include "../SH1106_OLED/SH1106.h"
-#include "../XBM_symbols/XBM_symbols.h"
+#include "../OLED_widgets/OLED_widgets.h"
+#include "../XBM_symbols/XBM_SYMBOLS_PACKED.h"
+#include "MODE_BACKGROUNDS.h"
 #include "../buttons/buttons.h"
 #include "../ADXL343_accelerometer/ADXL343.h"
+#include "../render_scheduler/render_scheduler.h"
 
 static uint8_t _menuHighlight; /* Which menu item is highlighted */
 static uint8_t _menuSelection;	/* Which menu item is selected */
 static uint8_t _settingsModeStatus;	/* Is mode A in settings mode or not */
-static char _settingsString[9]; /* Used to display and modify the time, date and alarm */
+/* The time, date or alarm being set, drawn as LL:MM:RR or LL-MM-RR from left to right */
+static uint8_t _settingsValues[3];
 
-/* Current index of digit in _settingsString selected when changing the time, date or alarm */
+/* Current index of digit in the drawn settings string selected when changing the time, date or alarm */
 static uint8_t _selectedDigit; 
 
 static uint8_t _digitIncrementFlag;	/* Should the selected digit be increased or not */
@@ -43,11 +47,16 @@ static uint8_t _digitIncrementFlag;	/* Should the selected digit be increased or
 To modify the date accurately, the order follows a specific sequence: Year Tens, Year Ones, 
 Month Tens, Month Ones, Day Tens, Day Ones. This array establishes a connection between the 
 _selectedDigit index and the corresponding index to be modified when changing the date. 
-The '-1' values indicate the positions of non-integer characters in the _settingsString 
+The '-1' values indicate the positions of non-integer characters in the settings string 
 (e.g., the colons in HH:MM:SS).
 */
 static const int8_t _dateDigitsIndexOffset[8] = {6, 7, -1, 3, 4, -1, 0, 1};
 
+/* Widgets of the date and time screen */
+static uint8_t _timeWidget;
+static uint8_t _dateWidget;
+static uint8_t _alarmWidget;
+
 /* Private function prototypes */
 static void _display_date_and_time();
 static void _display_settings_menu();
@@ -62,6 +71,9 @@ static void _increase_selected_date_digit();
 static void _selected_digit_highlight();
 static void _string_init();
 static void _string_confirm();
+static void _draw_settings_string(uint8_t fontSize, const char* format);
+static uint8_t _settings_digit(uint8_t index);
+static void _set_settings_digit(uint8_t index, uint8_t digit);
 
 
 /*
@@ -81,7 +93,8 @@ void MODE_A_init() {
 /*
 * MODE_A_control()
 * ----------------
-* External function that controls all of the main functionality of mode A.
+* External function that controls all of the main functionality of mode A. The buttons
+* are checked every time, the screen is only drawn when RENDER_frame_due() allows.
 */
 void MODE_A_control() {
 	
@@ -91,6 +104,7 @@ void MODE_A_control() {
 	if (buttons_select_status() == BUTTON_PRESSED || buttons_button_down(BUTTON_SELECT)) {
 		buttons_select_set_status(BUTTON_RELEASED);
 		_button_select_logic();
+		RENDER_invalidate(RENDER_REASON_BUTTON);
 	}
 	
 	/* If an interrupt for the next button is detected or if 
@@ -99,11 +113,27 @@ void MODE_A_control() {
 	if (buttons_next_status() == BUTTON_PRESSED || buttons_button_down(BUTTON_NEXT)) {
 		buttons_next_set_status(BUTTON_RELEASED);
 		_button_next_logic();
+		RENDER_invalidate(RENDER_REASON_BUTTON);
 	}
-		
+	
+	/* Double tap arms or disarms the alarm from the date and time screen */
+	if (_settingsModeStatus == MODE_A_SETTINGS_OFF && ADXL343_get_double_tap_status() == ADXL343_DOUBLETAP_DETECTED && RTC_check_alarm_match() == RTC_ALARM_INACTIVE) {
+		RTC_alarm_enable_disable((RTC_get_alarm_enable_disable() + 1) % 2);
+		ADXL343_clear_double_tap();
+		RENDER_invalidate(RENDER_REASON_ALARM);
+	}
+	
+	/* Only draw when something has changed and the frame rate cap allows */
+	if (!RENDER_frame_due()) {
+		return;
+	}
+	
 	if (_settingsModeStatus == MODE_A_SETTINGS_OFF) {
 		_display_date_and_time();
 	} else {
+		/* The settings screens draw straight into the buffer */
+		WIDGET_screen(WIDGET_SCREEN_NONE);
+		
 		if (_menuSelection == MODE_A_SETTINGS_SELECTION_NONE) {
 			_display_settings_menu();
 		} else if (_menuSelection == MODE_A_SETTINGS_SELECTION_SET_TIME) {
@@ -120,40 +150,36 @@ void MODE_A_control() {
 /*
 * _display_date_and_time()
 * ------------------------
-* Private function used to display the current date and time.
+* Private function used to display the current date and time. The screen is made of
+* widgets so only the parts that change, usually the seconds, are redrawn and sent.
 */
 static void _display_date_and_time() {
-	char currentTime[9];
-	char dayDateString[9];
-	
-	RTC_get_time_string(currentTime);
-	RTC_get_date_string(dayDateString);
-	
-	OLED_clear_buffer();
+	uint8_t dayDate;
+	uint8_t month;
+	uint8_t year;
 	
-	OLED_draw_string(currentTime, 6, 4, 25, 5, MODE_A);
-	OLED_draw_string(dayDateString, 5, 41, 16, 2, 0);
+	RTC_get_date_ints(&dayDate, &month, &year);
 	
-	/* Boxes surrounding the time and date */
-	OLED_draw_horizontal_line(0, 127, 33);
-	OLED_draw_horizontal_line(0, 127, 36);
-	OLED_draw_vertical_line(36, 63, 102);
-	OLED_draw_rectangle(0, 0, 127, 63, 0);
-	
-	if (RTC_check_alarm_match() == RTC_ALARM_INACTIVE && ADXL343_get_double_tap_status() == ADXL343_DOUBLETAP_DETECTED) {
-		RTC_alarm_enable_disable((RTC_get_alarm_enable_disable() + 1) % 2);
-		ADXL343_clear_double_tap();
+	if (WIDGET_screen(MODE_A)) {
+		/* Boxes surrounding the time and date */
+		WIDGET_set_background(MODE_A_CLOCK_BACKGROUND);
+		
+		_timeWidget = WIDGET_add_format_P(PSTR("%02u:%02u:%02u"), OLED_WIDTH / 2, 4, MODE_A_TIME_FONT, MODE_A_DIGIT_SPACING, OLED_ALIGN_CENTER, MODE_A);
+		_dateWidget = WIDGET_add_format_P(PSTR("%02u-%02u-%02u"), MODE_A_DATE_BOX_WIDTH / 2, 41, MODE_A_DATE_FONT, 2, OLED_ALIGN_CENTER, MODE_A);
+		_alarmWidget = WIDGET_add_packed_icon(alarmBellIconUnarmedPacked, 106, 37, MODE_A);
 	}
 	
+	WIDGET_set_numbers(_timeWidget, RTC_get_time_hours_int(), RTC_get_time_minutes_int(), RTC_get_time_seconds_int());
+	WIDGET_set_numbers(_dateWidget, dayDate, month, year);
+	
 	if (RTC_get_alarm_enable_disable() == RTC_ALARM_DISABLED) {
-		OLED_draw_xbm(106, 37, alarmBellIconUnarmed, 18, 24, MODE_A);
+		WIDGET_set_image(_alarmWidget, alarmBellIconUnarmedPacked);
 	} else if (RTC_get_alarm_enable_disable() == RTC_ALARM_ENABLED) {
-		OLED_draw_xbm(106, 37, alarmBellIconArmed, 18, 24, MODE_A);
+		WIDGET_set_image(_alarmWidget, alarmBellIconArmedPacked);
 	}
 	
-	
-	
-	OLED_display_buffer();
+	WIDGET_render();
+	OLED_display_buffer_async(0);
 }
 
 /*
@@ -164,12 +190,9 @@ static void _display_date_and_time() {
 */
 static void _display_settings_menu() {
 	
-	OLED_clear_buffer();
-	OLED_draw_string("Set Time", 6, 2, 16, 2, MODE_A);
-	OLED_draw_string("Set Date", 6, 22, 16, 2, MODE_A);
-	OLED_draw_string("Set Alarm", 6, 42, 16, 2, MODE_A);
+	OLED_draw_background(MODE_A_MENU_BACKGROUND);
 	_menu_highlight_option();
-	OLED_display_buffer();
+	OLED_display_buffer_async(0);
 }
 
 /*
@@ -182,15 +205,15 @@ static void _menu_highlight_option() {
 	
 	switch(_menuHighlight) {
 		case MODE_A_SETTINGS_SELECTION_SET_TIME:
-			OLED_invert_rectangle(0, 128, 0, 20);
+			OLED_invert_rectangle(0, 128, 0, MODE_A_MENU_ROW_HEIGHT);
 			break;
 		
 		case MODE_A_SETTINGS_SELECTION_SET_DATE:
-			OLED_invert_rectangle(0, 128, 20, 40);
+			OLED_invert_rectangle(0, 128, MODE_A_MENU_ROW_HEIGHT, 2 * MODE_A_MENU_ROW_HEIGHT);
 			break;
 			
 		case MODE_A_SETTINGS_SELECTION_SET_ALARM:
-			OLED_invert_rectangle(0, 128, 40, 60);
+			OLED_invert_rectangle(0, 128, 2 * MODE_A_MENU_ROW_HEIGHT, 3 * MODE_A_MENU_ROW_HEIGHT);
 			break;
 	}
 }
@@ -252,18 +275,17 @@ static void _button_next_logic() {
 */
 static void _display_set_time() {
 	_increase_selected_time_digit();
-	OLED_clear_buffer();
-	OLED_draw_string("Set Time", 21, 7, 16, 2, MODE_A);
-	OLED_draw_string(_settingsString, 6, 33, 25, 5, MODE_A);
+	OLED_draw_background(MODE_A_SET_TIME_BACKGROUND);
+	_draw_settings_string(MODE_A_TIME_FONT, PSTR("%02u:%02u:%02u"));
 	_selected_digit_highlight();
-	OLED_display_buffer();
+	OLED_display_buffer_async(0);
 }
 
 /* 
 * _string_init()
 * ---------------
-* Private function to initialise the _settingsString to represent the changes that will
-* be made in the settings. The string will be initialised with the current time when
+* Private function to initialise the _settingsValues to represent the changes that will
+* be made in the settings. The values will be initialised with the current time when
 * when setting a new time. Initialised with 00-00-00 when setting a new date. And initialised
 * with the current alarm time when setting a new alarm time.
 */
@@ -271,28 +293,74 @@ static void _string_init() {
 	switch(_menuSelection) {
 		
 		case MODE_A_SETTINGS_SELECTION_SET_TIME:
-			
-			RTC_get_time_string(_settingsString);
+			_settingsValues[0] = RTC_get_time_hours_int();
+			_settingsValues[1] = RTC_get_time_minutes_int();
+			_settingsValues[2] = RTC_get_time_seconds_int();
 			break;
 		
 		case MODE_A_SETTINGS_SELECTION_SET_DATE:
-		
-			for (uint8_t i = 0; i < 8; i++) {
-				if ((i == 2) || (i == 5)) {
-					_settingsString[i] = '-';
-					} else {
-					_settingsString[i] = '0';
-				}
-			}
-			_settingsString[8] = '\0';
+			_settingsValues[0] = 0;
+			_settingsValues[1] = 0;
+			_settingsValues[2] = 0;
 			break;
 			
 		case MODE_A_SETTINGS_SELECTION_SET_ALARM:
-			RTC_get_alarm_time_string(_settingsString);
+			_settingsValues[0] = RTC_get_alarm_time_hours_int();
+			_settingsValues[1] = RTC_get_alarm_time_minutes_int();
+			_settingsValues[2] = RTC_get_alarm_time_seconds_int();
 			break;
 	}
 }
 
+/*
+* _draw_settings_string()
+* -----------------------
+* Private function to draw the time, date or alarm being set.
+*
+* fontSize: MODE_A_TIME_FONT or MODE_A_DATE_FONT.
+*
+* format: The format stored in PROGMEM, with a separator between the three values.
+*/
+static void _draw_settings_string(uint8_t fontSize, const char* format) {
+	OLED_printf_P(MODE_A_SETTINGS_STRING_X, MODE_A_SETTINGS_STRING_Y, fontSize, MODE_A_DIGIT_SPACING, OLED_ALIGN_LEFT, MODE_A,
+		format, _settingsValues[0], _settingsValues[1], _settingsValues[2]);
+}
+
+/*
+* _settings_digit()
+* -----------------
+* Private function to get one digit of the settings string as it is drawn.
+*
+* index: The index of the digit in LL:MM:RR, MODE_A_STRING_INDEX_x.
+*
+* Return: The digit (0 - 9).
+*/
+static uint8_t _settings_digit(uint8_t index) {
+	uint8_t value = _settingsValues[index / 3];
+	
+	return (index % 3) ? (value % 10) : (value / 10);
+}
+
+/*
+* _set_settings_digit()
+* ---------------------
+* Private function to change one digit of the settings string, leaving the other digit of
+* its segment as it was.
+*
+* index: The index of the digit in LL:MM:RR, MODE_A_STRING_INDEX_x.
+*
+* digit: The new digit (0 - 9).
+*/
+static void _set_settings_digit(uint8_t index, uint8_t digit) {
+	uint8_t* value = &_settingsValues[index / 3];
+	
+	if (index % 3) {
+		*value = ((*value / 10) * 10) + digit;
+	} else {
+		*value = (digit * 10) + (*value % 10);
+	}
+}
+
 /*
 * _increase_selected_time_digit()
 * -------------------------------
@@ -311,40 +379,40 @@ static void _increase_selected_time_digit() {
 	
 	/* Increase hours tens digit */
 	if (_selectedDigit == MODE_A_STRING_INDEX_LEFT_TENS) {
-		tempTen = _settingsString[_selectedDigit] - '0';
-		_settingsString[_selectedDigit] = ((tempTen + 1) % 3) + '0';
+		tempTen = _settings_digit(_selectedDigit);
+		_set_settings_digit(_selectedDigit, (tempTen + 1) % 3);
 	
 	/* Increase hours ones digit */
 	} else if (_selectedDigit == MODE_A_STRING_INDEX_LEFT_ONES) {
-		tempTen = _settingsString[MODE_A_STRING_INDEX_LEFT_TENS] - '0';
-		tempOne = _settingsString[_selectedDigit] - '0';
+		tempTen = _settings_digit(MODE_A_STRING_INDEX_LEFT_TENS);
+		tempOne = _settings_digit(_selectedDigit);
 		
 		if (tempTen == 2) {
-			_settingsString[_selectedDigit] = ((tempOne + 1) % 4) + '0';
+			_set_settings_digit(_selectedDigit, (tempOne + 1) % 4);
 			
 		} else {
-			_settingsString[_selectedDigit] = ((tempOne + 1) % 10) + '0';
+			_set_settings_digit(_selectedDigit, (tempOne + 1) % 10);
 		}
 	
 	/* Increase minutes tens digit */	
 	} else if (_selectedDigit == MODE_A_STRING_INDEX_MIDDLE_TENS) {
-		tempTen = _settingsString[_selectedDigit] - '0';
-		_settingsString[_selectedDigit] = ((tempTen + 1) % 6) + '0';
+		tempTen = _settings_digit(_selectedDigit);
+		_set_settings_digit(_selectedDigit, (tempTen + 1) % 6);
 		
 	/* Increase minutes ones digit */
 	} else if (_selectedDigit == MODE_A_STRING_INDEX_MIDDLE_ONES) {
-		tempOne = _settingsString[_selectedDigit] - '0';
-		_settingsString[_selectedDigit] = ((tempOne + 1) % 10) + '0';
+		tempOne = _settings_digit(_selectedDigit);
+		_set_settings_digit(_selectedDigit, (tempOne + 1) % 10);
 	
 	/* Increase seconds tens digit */	
 	} else if (_selectedDigit == MODE_A_STRING_INDEX_RIGHT_TENS) {
-		tempTen = _settingsString[_selectedDigit] - '0';
-		_settingsString[_selectedDigit] = ((tempTen + 1) % 6) + '0';
+		tempTen = _settings_digit(_selectedDigit);
+		_set_settings_digit(_selectedDigit, (tempTen + 1) % 6);
 	
 	/* Increase seconds ones digit */
 	} else if (_selectedDigit == MODE_A_STRING_INDEX_RIGHT_ONES) {
-		tempOne = _settingsString[_selectedDigit] - '0';
-		_settingsString[_selectedDigit] = ((tempOne + 1) % 10) + '0';
+		tempOne = _settings_digit(_selectedDigit);
+		_set_settings_digit(_selectedDigit, (tempOne + 1) % 10);
 	}
 	
 	
@@ -357,57 +425,40 @@ static void _increase_selected_time_digit() {
 * setting the time, date or alarm time.
 */
 static void _selected_digit_highlight() {
+	uint8_t digit = _selectedDigit;
+	uint8_t fontSize = MODE_A_TIME_FONT;
+	uint8_t xOffset;
+	uint8_t width;
 	
-	if ((_menuSelection == MODE_A_SETTINGS_SELECTION_SET_TIME) || (_menuSelection == MODE_A_SETTINGS_SELECTION_SET_ALARM)) {
-		switch(_selectedDigit) {
-			case MODE_A_STRING_INDEX_LEFT_TENS:
-				OLED_invert_rectangle(3, 21, 30, 61);
-				break;
-			case MODE_A_STRING_INDEX_LEFT_ONES:
-				OLED_invert_rectangle(20, 38, 30, 61);
-				break;
-			case MODE_A_STRING_INDEX_MIDDLE_TENS:
-				OLED_invert_rectangle(46, 64, 30, 61);
-				break;
-			case MODE_A_STRING_INDEX_MIDDLE_ONES:
-				OLED_invert_rectangle(63, 81, 30, 61);
-				break;
-			case MODE_A_STRING_INDEX_RIGHT_TENS:
-				OLED_invert_rectangle(89, 107, 30, 61);
-				break;
-			case MODE_A_STRING_INDEX_RIGHT_ONES:
-				OLED_invert_rectangle(106, 124, 30, 61);
-				break;
-		}
-	} else if (_menuSelection == MODE_A_SETTINGS_SELECTION_SET_DATE) {
+	if (_menuSelection == MODE_A_SETTINGS_SELECTION_SET_DATE) {
 		int8_t highlight = _dateDigitsIndexOffset[_selectedDigit];
 		
 		if (highlight == -1) {
 			return;
 		}
+		digit = highlight;
+		fontSize = MODE_A_DATE_FONT;
+	} else if ((_menuSelection != MODE_A_SETTINGS_SELECTION_SET_TIME) && (_menuSelection != MODE_A_SETTINGS_SELECTION_SET_ALARM)) {
+		return;
+	}
+	
+	/* Box the digit as it is drawn in the settings string, adding up the characters before it */
+	xOffset = 0;
+	for (uint8_t i = 0; i <= digit; i++) {
+		uint8_t character = '0' + _settings_digit(i);
 		
-		switch(highlight) {
-			case MODE_A_STRING_INDEX_LEFT_TENS:
-			OLED_invert_rectangle(3, 19, 30, 52);
-			break;
-			case MODE_A_STRING_INDEX_LEFT_ONES:
-			OLED_invert_rectangle(18, 34, 30, 52);
-			break;
-			case MODE_A_STRING_INDEX_MIDDLE_TENS:
-			OLED_invert_rectangle(48, 64, 30, 52);
-			break;
-			case MODE_A_STRING_INDEX_MIDDLE_ONES:
-			OLED_invert_rectangle(63, 79, 30, 52);
-			break;
-			case MODE_A_STRING_INDEX_RIGHT_TENS:
-			OLED_invert_rectangle(93, 109, 30, 52);
-			break;
-			case MODE_A_STRING_INDEX_RIGHT_ONES:
-			OLED_invert_rectangle(108, 124, 30, 52);
-			break;
+		if ((i == 2) || (i == 5)) {
+			character = (fontSize == MODE_A_DATE_FONT) ? '-' : ':';
+		}
+		OLED_measure_printf_P(fontSize, 0, &width, 0, PSTR("%c"), character);
+		if (i < digit) {
+			xOffset += width + MODE_A_DIGIT_SPACING;
 		}
 	}
-	
+	OLED_invert_rectangle(	MODE_A_SETTINGS_STRING_X + xOffset - MODE_A_HIGHLIGHT_PADDING,
+							MODE_A_SETTINGS_STRING_X + xOffset + width + MODE_A_HIGHLIGHT_PADDING,
+							MODE_A_SETTINGS_STRING_Y - MODE_A_HIGHLIGHT_PADDING,
+							MODE_A_SETTINGS_STRING_Y + fontSize + MODE_A_HIGHLIGHT_PADDING);
 }
 
 /*
@@ -424,25 +475,25 @@ static void _string_confirm() {
 		
 		case MODE_A_SETTINGS_SELECTION_SET_TIME:
 		
-		temp1 = ((_settingsString[0] - 48) << 4) | (_settingsString[1] - 48); /*  Hours	*/
-		temp2 = ((_settingsString[3] - 48) << 4) | (_settingsString[4] - 48); /*  Minutes	*/
-		temp3 = ((_settingsString[6] - 48) << 4) | (_settingsString[7] - 48); /*  Seconds	*/
+		temp1 = (_settings_digit(0) << 4) | _settings_digit(1); /*  Hours	*/
+		temp2 = (_settings_digit(3) << 4) | _settings_digit(4); /*  Minutes	*/
+		temp3 = (_settings_digit(6) << 4) | _settings_digit(7); /*  Seconds	*/
 		RTC_set_time(temp1, temp2, temp3);
 		break;
 		
 		case MODE_A_SETTINGS_SELECTION_SET_DATE:
 		
-		temp1 = ((_settingsString[0] - 48) << 4) | (_settingsString[1] - 48); /*   Day	*/
-		temp2 = ((_settingsString[3] - 48) << 4) | (_settingsString[4] - 48); /*   Month	*/
-		temp3 = ((_settingsString[6] - 48) << 4) | (_settingsString[7] - 48); /*   Year	*/
+		temp1 = (_settings_digit(0) << 4) | _settings_digit(1); /*   Day	*/
+		temp2 = (_settings_digit(3) << 4) | _settings_digit(4); /*   Month	*/
+		temp3 = (_settings_digit(6) << 4) | _settings_digit(7); /*   Year	*/
 		RTC_set_date(temp1, temp2, temp3);
 		break;
 		
 		case MODE_A_SETTINGS_SELECTION_SET_ALARM:
 		
-		temp1 = ((_settingsString[0] - 48) << 4) | (_settingsString[1] - 48); /*  Hours	*/
-		temp2 = ((_settingsString[3] - 48) << 4) | (_settingsString[4] - 48); /*  Minutes	*/
-		temp3 = ((_settingsString[6] - 48) << 4) | (_settingsString[7] - 48); /*  Seconds */
+		temp1 = (_settings_digit(0) << 4) | _settings_digit(1); /*  Hours	*/
+		temp2 = (_settings_digit(3) << 4) | _settings_digit(4); /*  Minutes	*/
+		temp3 = (_settings_digit(6) << 4) | _settings_digit(7); /*  Seconds */
 		RTC_set_alarm_time(temp1, temp2, temp3);
 		break;
 		
@@ -456,11 +507,10 @@ static void _string_confirm() {
 */
 static void _display_set_alarm() {
 	_increase_selected_time_digit();
-	OLED_clear_buffer();
-	OLED_draw_string("Set Alarm", 16, 7, 16, 2, MODE_A);
-	OLED_draw_string(_settingsString, 6, 33, 25, 5, MODE_A);
+	OLED_draw_background(MODE_A_SET_ALARM_BACKGROUND);
+	_draw_settings_string(MODE_A_TIME_FONT, PSTR("%02u:%02u:%02u"));
 	_selected_digit_highlight();
-	OLED_display_buffer();
+	OLED_display_buffer_async(0);
 }
 
 /*
@@ -470,11 +520,10 @@ static void _display_set_alarm() {
 */
 static void _display_set_date() {
 	_increase_selected_date_digit();
-	OLED_clear_buffer();
-	OLED_draw_string("Set Date", 19, 7, 16, 2, MODE_A);
-	OLED_draw_string(_settingsString, 6, 33, 16, 5, MODE_A);
+	OLED_draw_background(MODE_A_SET_DATE_BACKGROUND);
+	_draw_settings_string(MODE_A_DATE_FONT, PSTR("%02u-%02u-%02u"));
 	_selected_digit_highlight();
-	OLED_display_buffer();
+	OLED_display_buffer_async(0);
 }
 
 /* 
@@ -497,30 +546,30 @@ static void _increase_selected_date_digit() {
 	uint8_t tempTen;
 	uint8_t tempOne;
 	
-	uint8_t year = ((_settingsString[MODE_A_STRING_INDEX_RIGHT_TENS] - '0') * 10) + (_settingsString[MODE_A_STRING_INDEX_RIGHT_ONES] - '0');
-	uint8_t month = ((_settingsString[MODE_A_STRING_INDEX_MIDDLE_TENS] - '0') * 10) + (_settingsString[MODE_A_STRING_INDEX_MIDDLE_ONES] - '0');
+	uint8_t year = ((_settings_digit(MODE_A_STRING_INDEX_RIGHT_TENS)) * 10) + (_settings_digit(MODE_A_STRING_INDEX_RIGHT_ONES));
+	uint8_t month = ((_settings_digit(MODE_A_STRING_INDEX_MIDDLE_TENS)) * 10) + (_settings_digit(MODE_A_STRING_INDEX_MIDDLE_ONES));
 	uint8_t isLeapYear = !(year % 4);
 	
 	/* Increase day tens */
 	if (selectedDigit == MODE_A_STRING_INDEX_LEFT_TENS) {
-		tempTen = _settingsString[selectedDigit] - '0';
+		tempTen = _settings_digit(selectedDigit);
 		
 		if (month == RTC_FEBRUARY) {
-			_settingsString[selectedDigit] = ((tempTen + 1) % 3) + '0';
+			_set_settings_digit(selectedDigit, (tempTen + 1) % 3);
 		} else {
-			_settingsString[selectedDigit] = ((tempTen + 1) % 4) + '0';
+			_set_settings_digit(selectedDigit, (tempTen + 1) % 4);
 		}
 	
 	/* Increase day ones */
 	} else if (selectedDigit == MODE_A_STRING_INDEX_LEFT_ONES) {
-		tempTen = _settingsString[MODE_A_STRING_INDEX_LEFT_ONES] - '0';
-		tempOne = _settingsString[selectedDigit] - '0';
+		tempTen = _settings_digit(MODE_A_STRING_INDEX_LEFT_ONES);
+		tempOne = _settings_digit(selectedDigit);
 		
 		if (month == RTC_FEBRUARY) {
 			if (!isLeapYear && (tempTen == 2)) {
-				_settingsString[selectedDigit] = ((tempOne + 1) % 8) + '0';
+				_set_settings_digit(selectedDigit, (tempOne + 1) % 8);
 			} else {
-				_settingsString[selectedDigit] = ((tempOne + 1) % 9) + '0';
+				_set_settings_digit(selectedDigit, (tempOne + 1) % 9);
 			}
 		} else if (	month == RTC_JANUARY	||
 					month == RTC_MARCH		||
@@ -531,9 +580,9 @@ static void _increase_selected_date_digit() {
 					month == RTC_DECEMBER) {
 			
 			if (tempTen == 3) {
-				_settingsString[selectedDigit] = ((tempOne + 1) % 2) + '0';	
+				_set_settings_digit(selectedDigit, (tempOne + 1) % 2);	
 			} else {
-				_settingsString[selectedDigit] = ((tempOne + 1) % 10) + '0';
+				_set_settings_digit(selectedDigit, (tempOne + 1) % 10);
 			}
 						
 		} else if (	month == RTC_APRIL		||
@@ -542,41 +591,41 @@ static void _increase_selected_date_digit() {
 					month == RTC_NOVEMBER) {
 		
 			if (tempTen == 3) {
-				_settingsString[selectedDigit] = ((tempOne + 1) % 1) + '0';	
+				_set_settings_digit(selectedDigit, (tempOne + 1) % 1);	
 			} else {
-				_settingsString[selectedDigit] = ((tempOne + 1) % 10) + '0';
+				_set_settings_digit(selectedDigit, (tempOne + 1) % 10);
 			}			
 		}
 	
 	/* Increase month tens */
 	} else if (selectedDigit == MODE_A_STRING_INDEX_MIDDLE_TENS) {
-		tempTen = _settingsString[selectedDigit] - '0';
+		tempTen = _settings_digit(selectedDigit);
 		
 		if (tempTen == 1) {
-			_settingsString[selectedDigit] = ((tempTen + 1) % 2) + '0';
+			_set_settings_digit(selectedDigit, (tempTen + 1) % 2);
 		} else {
-			_settingsString[selectedDigit] = ((tempTen + 1) % 10) + '0';
+			_set_settings_digit(selectedDigit, (tempTen + 1) % 10);
 		}
 	
 	/* Increase month ones */
 	} else if (selectedDigit == MODE_A_STRING_INDEX_MIDDLE_ONES) {
-		tempTen = _settingsString[MODE_A_STRING_INDEX_MIDDLE_TENS] - '0';
-		tempOne = _settingsString[selectedDigit] - '0';
+		tempTen = _settings_digit(MODE_A_STRING_INDEX_MIDDLE_TENS);
+		tempOne = _settings_digit(selectedDigit);
 		
 		if (tempTen == 1) {
-			_settingsString[selectedDigit] = ((tempOne + 1) % 3) + '0';
+			_set_settings_digit(selectedDigit, (tempOne + 1) % 3);
 		} else {
-			_settingsString[selectedDigit] = ((tempOne + 1) % 10) + '0';
+			_set_settings_digit(selectedDigit, (tempOne + 1) % 10);
 		}
 		
 	/* Increase year tens */
 	} else if (selectedDigit == MODE_A_STRING_INDEX_RIGHT_TENS) {
-		tempTen = _settingsString[selectedDigit] - '0';
-		_settingsString[selectedDigit] = ((tempTen + 1) % 10) + '0';
+		tempTen = _settings_digit(selectedDigit);
+		_set_settings_digit(selectedDigit, (tempTen + 1) % 10);
 	/* Increase year ones */
 	} else if (selectedDigit == MODE_A_STRING_INDEX_RIGHT_ONES) {
-		tempOne = _settingsString[selectedDigit] - '0';
-		_settingsString[selectedDigit] = ((tempOne + 1) % 10) + '0';
+		tempOne = _settings_digit(selectedDigit);
+		_set_settings_digit(selectedDigit, (tempOne + 1) % 10);
 	}
 	
 	_digitIncrementFlag = MODE_A_SETTINGS_HOLD_DIGIT;
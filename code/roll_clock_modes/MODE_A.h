@@ -31,8 +31,8 @@
 #define MODE_A_SETTINGS_INCREMENT_DIGIT	0x01
 
 /*	
-Used to index the private string (_settingsString) used to display and modify 
-the time, date and alarm time.
+Used to index the digits of the settings string drawn from the private values
+(_settingsValues) used to display and modify the time, date and alarm time.
 The structure of the string is, LL:MM:RR, where L = Left,
 M = Middle, and R = Right. This can be used to represent 
 the time or date. e.g Time = HH:MM:SS and Date = DD:MM:YY.
@@ -44,6 +44,25 @@ the time or date. e.g Time = HH:MM:SS and Date = DD:MM:YY.
 #define MODE_A_STRING_INDEX_RIGHT_TENS	0x06	/* Tens place of the right segment */
 #define MODE_A_STRING_INDEX_RIGHT_ONES	0x07	/* Ones place of the right segment */
 
+/* Layout of the screens, the text positions are worked out from the font metrics */
+#define MODE_A_TIME_FONT			25
+#define MODE_A_DATE_FONT			16
+#define MODE_A_DIGIT_SPACING		5	/* Pixels between the characters of the settings string */
+#define MODE_A_SETTINGS_STRING_X	6	/* Left edge of the settings string */
+#define MODE_A_SETTINGS_STRING_Y	33	/* Top of the settings string */
+#define MODE_A_HIGHLIGHT_PADDING	3	/* Pixels the selected digit highlight extends past the digit */
+#define MODE_A_DATE_BOX_WIDTH		102	/* Width of the box holding the date, left of the alarm icon */
+#define MODE_A_TIME_LINE_Y			33	/* Line under the time */
+#define MODE_A_DATE_BOX_Y			36	/* Top edge of the date and alarm icon boxes, under a second line */
+#define MODE_A_MENU_ROW_HEIGHT		20	/* Rows of the settings menu, each one is inverted when highlighted */
+#define MODE_A_MENU_TEXT_X			6	/* Left edge of the settings menu items */
+#define MODE_A_TITLE_Y				7	/* Top of the title of the set time, date and alarm screens */
+
+/*
+The lines, menu and titles are drawn from MODE_BACKGROUNDS.c, which is generated by running the
+draw calls in tools/oled_host/backgrounds.c. Change them there and run tools/make_backgrounds.py.
+*/
+
 void MODE_A_init();
 void MODE_A_control();
 
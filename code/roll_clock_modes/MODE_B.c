@@ -19,8 +19,17 @@
 
 #include "MODE_B.h"
 #include "../SH1106_OLED/SH1106.h"
+#include "../OLED_widgets/OLED_widgets.h"
 #include "../XBM_symbols/XBM_symbols.h"
+#include "MODE_BACKGROUNDS.h"
 #include "../AM2320_temperature_humidity/AM2320_temperature_humidity.h"
+#include "../render_scheduler/render_scheduler.h"
+
+/* Widgets of the temperature and humidity screen */
+static uint8_t _temperatureWidget;
+static uint8_t _temperatureUnitWidget;
+static uint8_t _humidityWidget;
+static uint8_t _humidityUnitWidget;
 
 /* Private function prototypes */
 static void _display_temperature_humidity();
@@ -42,32 +51,46 @@ void MODE_B_init() {
 * External function that controls all of the main functionality for mode B.
 */
 void MODE_B_control() {
-	_display_temperature_humidity();
+	/* Only draw when new readings have arrived and the frame rate cap allows */
+	if (RENDER_frame_due()) {
+		_display_temperature_humidity();
+	}
 }
 
 /*
 * _display_temperature_humidity()
 * -------------------------------
 * Private function used to display the temperature (degrees Celsius) and 
-* humidity (%) on the OLED screen.
+* humidity (%) on the OLED screen. The screen is made of widgets so only
+* the readings that change are redrawn and sent.
 */
 static void _display_temperature_humidity() {
 	char temperatureString[7];
 	char humidityString[5];
-	char degreesCelsiusString[2] = {254, '\0'};
+	uint8_t valueWidth;	/* Width of the reading drawn before its unit symbol */
 	
 	AM2320_get_temperature_string_celsius(temperatureString);
 	AM2320_get_humidity_string(humidityString);
 	
-	OLED_clear_buffer();
+	if (WIDGET_screen(MODE_B)) {
+		/* The Temperature and Humidity labels */
+		WIDGET_set_background(MODE_B_BACKGROUND);
+		
+		_temperatureWidget = WIDGET_add_value(0, 32, 16, 2, OLED_ALIGN_LEFT, MODE_B);
+		_temperatureUnitWidget = WIDGET_add_label_P(PSTR("\xfe"), 0, 32, 16, 1, OLED_ALIGN_LEFT, MODE_B);
+		
+		_humidityWidget = WIDGET_add_value(0, 96, 16, 2, OLED_ALIGN_LEFT, MODE_B);
+		_humidityUnitWidget = WIDGET_add_label_P(PSTR("%"), 0, 96, 16, 1, OLED_ALIGN_LEFT, MODE_B);
+	}
 	
-	OLED_draw_string("Temperature", 0, 16, 8, 1, MODE_B);
-	OLED_draw_string(temperatureString, 0, 32, 16, 2, MODE_B);
-	OLED_draw_string(degreesCelsiusString, 44, 32, 16, 1, MODE_B);
+	WIDGET_set_value(_temperatureWidget, temperatureString);
+	OLED_measure_string(temperatureString, 16, 2, &valueWidth, 0);
+	WIDGET_set_position(_temperatureUnitWidget, valueWidth + MODE_B_UNIT_GAP, 32);
 	
-	OLED_draw_string("Humidity", 0, 80, 8, 1, MODE_B);
-	OLED_draw_string(humidityString, 0, 96, 16, 2, MODE_B);
-	OLED_draw_string("%", 49, 96, 16, 1, MODE_B);
+	WIDGET_set_value(_humidityWidget, humidityString);
+	OLED_measure_string(humidityString, 16, 2, &valueWidth, 0);
+	WIDGET_set_position(_humidityUnitWidget, valueWidth + MODE_B_UNIT_GAP, 96);
 	
-	OLED_display_buffer();
+	WIDGET_render();
+	OLED_display_buffer_async(0);
 }
\ No newline at end of file
@@ -18,6 +18,13 @@
 
 #define MODE_B 0x01
 
+/* Pixels between a reading and its unit symbol */
+#define MODE_B_UNIT_GAP 4
+
+/* Tops of the labels drawn from MODE_BACKGROUNDS.c, the readings are drawn 16 pixels under them */
+#define MODE_B_TEMPERATURE_LABEL_Y	16
+#define MODE_B_HUMIDITY_LABEL_Y		80
+
 void MODE_B_init();
 void MODE_B_control();
 
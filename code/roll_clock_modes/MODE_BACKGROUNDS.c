@@ -0,0 +1,231 @@
+/*
+ **************************************************************
+ * MODE_BACKGROUNDS.c
+ * Backgrounds of the roll clock screens, drawn with
+ * OLED_draw_background().
+ * Generated by tools/make_backgrounds.py, do not edit.
+ * Regenerate after changing a screen with:
+ * python3 tools/make_backgrounds.py
+ * Total size: 1708 bytes of flash.
+ **************************************************************
+*/
+
+#include <avr/pgmspace.h>
+#include "MODE_BACKGROUNDS.h"
+
+/* Mode A clock face, the lines between the time, date and alarm icon, 434 bytes */
+const uint8_t MODE_A_CLOCK_BACKGROUND[] PROGMEM =
+{
+	/* Page 0, columns 0 - 127 */
+	0x00,0x80,0xff,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+	0x01,0xff,0xff,
+	/* Page 1, columns 0 - 0, columns 127 - 127 */
+	0x00,0x01,0xff,0x7f,0x01,0xff,0xff,
+	/* Page 2, columns 0 - 0, columns 127 - 127 */
+	0x00,0x01,0xff,0x7f,0x01,0xff,0xff,
+	/* Page 3, columns 0 - 0, columns 127 - 127 */
+	0x00,0x01,0xff,0x7f,0x01,0xff,0xff,
+	/* Page 4, columns 0 - 127 */
+	0x00,0x80,0xff,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+	0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+	0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+	0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+	0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+	0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+	0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0xf2,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+	0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+	0x12,0xff,0xff,
+	/* Page 5, columns 0 - 0, columns 102 - 102, columns 127 - 127 */
+	0x00,0x01,0xff,0x66,0x01,0xff,0x7f,0x01,0xff,0xff,
+	/* Page 6, columns 0 - 0, columns 102 - 102, columns 127 - 127 */
+	0x00,0x01,0xff,0x66,0x01,0xff,0x7f,0x01,0xff,0xff,
+	/* Page 7, columns 0 - 127 */
+	0x00,0x80,0x7f,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x7f,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x7f,0xff,
+};
+
+/* Mode A settings menu, 593 bytes */
+const uint8_t MODE_A_MENU_BACKGROUND[] PROGMEM =
+{
+	/* Page 0, columns 6 - 15, columns 19 - 26, columns 30 - 37, columns 50 - 78, columns 83 - 90 */
+	0x06,0x0a,0xf0,0xf8,0x9c,0x0c,0x0c,0x0c,0x0c,0x1c,0x38,0x30,0x13,0x08,0x80,0xc0,
+	0xc0,0xc0,0xc0,0xc0,0xc0,0x80,0x1e,0x08,0xc0,0xc0,0xfc,0xfc,0xc0,0xc0,0xc0,0xc0,
+	0x32,0x1d,0x0c,0x0c,0x0c,0x0c,0xfc,0xfc,0x0c,0x0c,0x0c,0x0c,0x00,0x00,0x30,0x30,
+	0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x80,0x80,0xc0,0xc0,0xc0,0xc0,0x80,0x53,
+	0x08,0x80,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x80,0xff,
+	/* Page 1, columns 6 - 27, columns 32 - 34, columns 54 - 55, columns 62 - 67, columns 71 - 91 */
+	0x06,0x16,0xc0,0xc1,0x83,0x03,0x03,0x03,0x03,0x87,0xfe,0xfc,0x00,0x00,0xff,0xff,
+	0x8d,0x0c,0x0c,0x0c,0x0c,0x8d,0xcf,0xcf,0x20,0x03,0xff,0xff,0x80,0x36,0x02,0xff,
+	0xff,0x3e,0x06,0xff,0xff,0x00,0x00,0xff,0xff,0x47,0x15,0x01,0xff,0xff,0x01,0x00,
+	0x00,0x01,0xff,0xff,0x00,0x00,0xff,0xff,0x8d,0x0c,0x0c,0x0c,0x0c,0x8d,0xcf,0xcf,
+	0xff,
+	/* Page 2, columns 7 - 14, columns 19 - 26, columns 32 - 37, columns 50 - 58, columns 62 - 67, columns 72 - 79, columns 83 - 90 */
+	0x07,0x08,0x81,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0x81,0x13,0x08,0x01,0x03,0x03,0x03,
+	0x03,0x03,0x03,0x01,0x20,0x06,0xc0,0xc1,0x03,0x03,0x03,0x03,0x32,0x09,0xc0,0xc0,
+	0xc0,0xc0,0xc3,0xc3,0xc0,0xc0,0x80,0x3e,0x06,0x03,0x03,0x00,0x00,0x03,0x03,0x48,
+	0x08,0x03,0x03,0x00,0x00,0xc0,0xc0,0x03,0x03,0x53,0x08,0x01,0x03,0x03,0x03,0x03,
+	0x03,0x03,0x01,0xff,
+	/* Page 3, columns 6 - 37, columns 50 - 51, columns 57 - 93 */
+	0x06,0x20,0x0f,0x1f,0x39,0x30,0x30,0x30,0x30,0x71,0xe3,0xc3,0x00,0x00,0xf0,0xf8,
+	0xdc,0xcc,0xcc,0xcc,0xcc,0xdc,0xf8,0xf0,0x00,0x00,0x0c,0x0c,0xff,0xff,0x0c,0x0c,
+	0x0c,0x0c,0x32,0x02,0xff,0xff,0x39,0x25,0x01,0xff,0xff,0x00,0x00,0xf0,0xf8,0x1c,
+	0x0c,0x0c,0x0c,0x0c,0x1c,0xf8,0xf0,0x00,0x00,0x0c,0x0c,0xff,0xff,0x0c,0x0c,0x0c,
+	0x0c,0x00,0x00,0xf0,0xf8,0xdc,0xcc,0xcc,0xcc,0xcc,0xdc,0xf8,0xf0,0xff,
+	/* Page 4, columns 6 - 27, columns 32 - 37, columns 50 - 71, columns 76 - 93 */
+	0x06,0x16,0x0c,0x1c,0x38,0x30,0x30,0x30,0x30,0x38,0x1f,0x0f,0x00,0x00,0x0f,0x1f,
+	0x38,0x30,0x30,0x30,0x30,0x38,0x1c,0x0c,0x20,0x06,0x0f,0x1f,0x38,0x30,0x30,0x30,
+	0x32,0x16,0x3f,0x3f,0x30,0x30,0x30,0x30,0x30,0x38,0x1f,0x0f,0x00,0x00,0x0f,0x1f,
+	0x38,0x30,0x30,0x38,0x1c,0x0e,0x3f,0x3f,0x4c,0x12,0x0f,0x1f,0x38,0x30,0x30,0x30,
+	0x00,0x00,0x0f,0x1f,0x38,0x30,0x30,0x30,0x30,0x38,0x1c,0x0c,0xff,
+	/* Page 5, columns 6 - 15, columns 19 - 26, columns 30 - 37, columns 50 - 63, columns 67 - 74, columns 78 - 100 */
+	0x06,0x0a,0xf0,0xf8,0x9c,0x0c,0x0c,0x0c,0x0c,0x1c,0x38,0x30,0x13,0x08,0x80,0xc0,
+	0xc0,0xc0,0xc0,0xc0,0xc0,0x80,0x1e,0x08,0xc0,0xc0,0xfc,0xfc,0xc0,0xc0,0xc0,0xc0,
+	0x32,0x0e,0xf0,0xf8,0x1c,0x0c,0x0c,0x0c,0x0c,0x1c,0xf8,0xf0,0x00,0x00,0xfc,0xfc,
+	0x43,0x08,0x80,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x80,0x4e,0x17,0xc0,0xc0,0x00,0x80,
+	0xc0,0xc0,0xc0,0xc0,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x80,0x80,0xc0,0xc0,
+	0xc0,0xc0,0x80,0xff,
+	/* Page 6, columns 6 - 27, columns 32 - 34, columns 50 - 82, columns 88 - 89, columns 93 - 101 */
+	0x06,0x16,0xc0,0xc1,0x83,0x03,0x03,0x03,0x03,0x87,0xfe,0xfc,0x00,0x00,0xff,0xff,
+	0x8d,0x0c,0x0c,0x0c,0x0c,0x8d,0xcf,0xcf,0x20,0x03,0xff,0xff,0x80,0x32,0x21,0xff,
+	0xff,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0x00,0x00,0xff,0xff,0x00,0x00,0xff,
+	0xff,0x81,0x00,0x00,0x80,0xc0,0xe1,0xff,0xff,0x00,0x00,0xff,0xff,0x07,0x03,0x01,
+	0x58,0x02,0xff,0xff,0x5d,0x09,0x01,0xff,0xff,0x01,0x00,0x00,0x01,0xff,0xff,0xff,
+	/* Page 7, columns 7 - 14, columns 19 - 26, columns 33 - 37, columns 50 - 51, columns 58 - 63, columns 67 - 79, columns 88 - 89, columns 94 - 95, columns 100 - 101 */
+	0x07,0x08,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x13,0x08,0x01,0x03,0x03,0x03,
+	0x03,0x03,0x03,0x01,0x21,0x05,0x01,0x03,0x03,0x03,0x03,0x32,0x02,0x03,0x03,0x3a,
+	0x06,0x03,0x03,0x00,0x00,0x03,0x03,0x43,0x0d,0x01,0x03,0x03,0x03,0x03,0x01,0x00,
+	0x03,0x03,0x00,0x00,0x03,0x03,0x58,0x02,0x03,0x03,0x5e,0x02,0x03,0x03,0x64,0x02,
+	0x03,0x03,0xff,
+};
+
+/* Mode A set time title, 174 bytes */
+const uint8_t MODE_A_SET_TIME_BACKGROUND[] PROGMEM =
+{
+	/* Page 0, columns 23 - 28, columns 47 - 48, columns 65 - 74 */
+	0x17,0x06,0x80,0x80,0x80,0x80,0x80,0x80,0x2f,0x02,0x80,0x80,0x41,0x0a,0x80,0x80,
+	0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xff,
+	/* Page 1, columns 21 - 52, columns 65 - 106 */
+	0x15,0x20,0x1e,0x3f,0x73,0x61,0x61,0x61,0x61,0xe3,0xc7,0x86,0x00,0x00,0xe0,0xf0,
+	0xb8,0x98,0x98,0x98,0x98,0xb8,0xf0,0xe0,0x00,0x00,0x18,0x18,0xff,0xff,0x18,0x18,
+	0x18,0x18,0x41,0x2a,0x01,0x01,0x01,0x01,0xff,0xff,0x01,0x01,0x01,0x01,0x00,0x00,
+	0xe6,0xe6,0x00,0x00,0xf8,0xf8,0x18,0x18,0x18,0x38,0xf0,0xf0,0x38,0x18,0x18,0x38,
+	0xf0,0xe0,0x00,0x00,0xe0,0xf0,0xb8,0x98,0x98,0x98,0x98,0xb8,0xf0,0xe0,0xff,
+	/* Page 2, columns 21 - 42, columns 47 - 52, columns 69 - 70, columns 77 - 82, columns 87 - 88, columns 93 - 106 */
+	0x15,0x16,0x18,0x38,0x70,0x60,0x60,0x60,0x60,0x70,0x3f,0x1f,0x00,0x00,0x1f,0x3f,
+	0x71,0x61,0x61,0x61,0x61,0x71,0x39,0x19,0x2f,0x06,0x1f,0x3f,0x70,0x60,0x60,0x60,
+	0x45,0x02,0x7f,0x7f,0x4d,0x06,0x7f,0x7f,0x00,0x00,0x7f,0x7f,0x57,0x02,0x7f,0x7f,
+	0x5d,0x0e,0x7f,0x7f,0x00,0x00,0x1f,0x3f,0x71,0x61,0x61,0x61,0x61,0x71,0x39,0x19,
+	0xff,
+	/* Page 3, blank */
+	0xff,
+	/* Page 4, blank */
+	0xff,
+	/* Page 5, blank */
+	0xff,
+	/* Page 6, blank */
+	0xff,
+	/* Page 7, blank */
+	0xff,
+};
+
+/* Mode A set date title, 190 bytes */
+const uint8_t MODE_A_SET_DATE_BACKGROUND[] PROGMEM =
+{
+	/* Page 0, columns 22 - 27, columns 46 - 47, columns 64 - 71, columns 90 - 91 */
+	0x16,0x06,0x80,0x80,0x80,0x80,0x80,0x80,0x2e,0x02,0x80,0x80,0x40,0x08,0x80,0x80,
+	0x80,0x80,0x80,0x80,0x80,0x80,0x5a,0x02,0x80,0x80,0xff,
+	/* Page 1, columns 20 - 51, columns 64 - 107 */
+	0x14,0x20,0x1e,0x3f,0x73,0x61,0x61,0x61,0x61,0xe3,0xc7,0x86,0x00,0x00,0xe0,0xf0,
+	0xb8,0x98,0x98,0x98,0x98,0xb8,0xf0,0xe0,0x00,0x00,0x18,0x18,0xff,0xff,0x18,0x18,
+	0x18,0x18,0x40,0x2c,0xff,0xff,0x01,0x01,0x01,0x01,0x01,0x03,0xff,0xfe,0x00,0x00,
+	0xe0,0xf0,0x38,0x18,0x18,0x18,0x18,0x38,0xf0,0xe0,0x00,0x00,0x18,0x18,0xff,0xff,
+	0x18,0x18,0x18,0x18,0x00,0x00,0xe0,0xf0,0xb8,0x98,0x98,0x98,0x98,0xb8,0xf0,0xe0,
+	0xff,
+	/* Page 2, columns 20 - 41, columns 46 - 51, columns 64 - 85, columns 90 - 107 */
+	0x14,0x16,0x18,0x38,0x70,0x60,0x60,0x60,0x60,0x70,0x3f,0x1f,0x00,0x00,0x1f,0x3f,
+	0x71,0x61,0x61,0x61,0x61,0x71,0x39,0x19,0x2e,0x06,0x1f,0x3f,0x70,0x60,0x60,0x60,
+	0x40,0x16,0x7f,0x7f,0x60,0x60,0x60,0x60,0x60,0x70,0x3f,0x1f,0x00,0x00,0x1f,0x3f,
+	0x70,0x60,0x60,0x70,0x38,0x1c,0x7f,0x7f,0x5a,0x12,0x1f,0x3f,0x70,0x60,0x60,0x60,
+	0x00,0x00,0x1f,0x3f,0x71,0x61,0x61,0x61,0x61,0x71,0x39,0x19,0xff,
+	/* Page 3, blank */
+	0xff,
+	/* Page 4, blank */
+	0xff,
+	/* Page 5, blank */
+	0xff,
+	/* Page 6, blank */
+	0xff,
+	/* Page 7, blank */
+	0xff,
+};
+
+/* Mode A set alarm title, 192 bytes */
+const uint8_t MODE_A_SET_ALARM_BACKGROUND[] PROGMEM =
+{
+	/* Page 0, columns 18 - 23, columns 42 - 43, columns 62 - 67, columns 72 - 73 */
+	0x12,0x06,0x80,0x80,0x80,0x80,0x80,0x80,0x2a,0x02,0x80,0x80,0x3e,0x06,0x80,0x80,
+	0x80,0x80,0x80,0x80,0x48,0x02,0x80,0x80,0xff,
+	/* Page 1, columns 16 - 47, columns 60 - 111 */
+	0x10,0x20,0x1e,0x3f,0x73,0x61,0x61,0x61,0x61,0xe3,0xc7,0x86,0x00,0x00,0xe0,0xf0,
+	0xb8,0x98,0x98,0x98,0x98,0xb8,0xf0,0xe0,0x00,0x00,0x18,0x18,0xff,0xff,0x18,0x18,
+	0x18,0x18,0x3c,0x34,0xfe,0xff,0x63,0x61,0x61,0x61,0x61,0x63,0xff,0xfe,0x00,0x00,
+	0xff,0xff,0x00,0x00,0xe0,0xf0,0x38,0x18,0x18,0x18,0x18,0x38,0xf0,0xe0,0x00,0x00,
+	0xf8,0xf8,0xe0,0x70,0x38,0x18,0x18,0x18,0x00,0x00,0xf8,0xf8,0x18,0x18,0x18,0x38,
+	0xf0,0xf0,0x38,0x18,0x18,0x38,0xf0,0xe0,0xff,
+	/* Page 2, columns 16 - 37, columns 42 - 47, columns 60 - 61, columns 68 - 89, columns 98 - 99, columns 104 - 105, columns 110 - 111 */
+	0x10,0x16,0x18,0x38,0x70,0x60,0x60,0x60,0x60,0x70,0x3f,0x1f,0x00,0x00,0x1f,0x3f,
+	0x71,0x61,0x61,0x61,0x61,0x71,0x39,0x19,0x2a,0x06,0x1f,0x3f,0x70,0x60,0x60,0x60,
+	0x3c,0x02,0x7f,0x7f,0x44,0x16,0x7f,0x7f,0x00,0x00,0x7f,0x7f,0x00,0x00,0x1f,0x3f,
+	0x70,0x60,0x60,0x70,0x38,0x1c,0x7f,0x7f,0x00,0x00,0x7f,0x7f,0x62,0x02,0x7f,0x7f,
+	0x68,0x02,0x7f,0x7f,0x6e,0x02,0x7f,0x7f,0xff,
+	/* Page 3, blank */
+	0xff,
+	/* Page 4, blank */
+	0xff,
+	/* Page 5, blank */
+	0xff,
+	/* Page 6, blank */
+	0xff,
+	/* Page 7, blank */
+	0xff,
+};
+
+/* Mode B temperature and humidity labels, 125 bytes */
+const uint8_t MODE_B_BACKGROUND[] PROGMEM =
+{
+	/* Page 0, columns 40 - 47, columns 104 - 111 */
+	0x28,0x08,0x91,0x51,0x51,0x51,0x5f,0x51,0x11,0x11,0x68,0x08,0x84,0x44,0x44,0xc4,
+	0x44,0x84,0x04,0x1f,0xff,
+	/* Page 1, columns 40 - 45, columns 104 - 109 */
+	0x28,0x06,0x97,0x94,0x94,0x94,0x94,0x74,0x68,0x06,0x93,0x94,0x90,0x97,0x94,0x73,
+	0xff,
+	/* Page 2, columns 40 - 46, columns 102 - 109 */
+	0x28,0x07,0x94,0x54,0x54,0x54,0x54,0x83,0x10,0x66,0x08,0x10,0x10,0xf4,0x14,0x14,
+	0x14,0x14,0xf3,0xff,
+	/* Page 3, columns 40 - 47, columns 104 - 109 */
+	0x28,0x08,0x17,0x94,0x94,0x94,0x94,0xc7,0x94,0x84,0x68,0x06,0x38,0x45,0x05,0x7d,
+	0x45,0x38,0xff,
+	/* Page 4, columns 38 - 45, columns 104 - 109 */
+	0x26,0x08,0x10,0x10,0x23,0x20,0x50,0x50,0x88,0x8b,0x68,0x06,0xc1,0x21,0x21,0x21,
+	0x23,0xcd,0xff,
+	/* Page 5, columns 104 - 111 */
+	0x68,0x08,0x62,0x13,0x12,0x12,0x12,0x79,0x10,0x10,0xff,
+	/* Page 6, columns 104 - 109 */
+	0x68,0x06,0x5e,0x51,0x51,0x51,0xd1,0x51,0xff,
+	/* Page 7, columns 104 - 109 */
+	0x68,0x06,0x70,0x88,0x08,0xf8,0x88,0x73,0xff,
+};
@@ -0,0 +1,25 @@
+/*
+ **************************************************************
+ * MODE_BACKGROUNDS.h
+ * Backgrounds of the roll clock screens, drawn with
+ * OLED_draw_background().
+ * Generated by tools/make_backgrounds.py, do not edit.
+ * Regenerate after changing a screen with:
+ * python3 tools/make_backgrounds.py
+ * Total size: 1708 bytes of flash.
+ **************************************************************
+*/
+
+#ifndef MODE_BACKGROUNDS_H_
+#define MODE_BACKGROUNDS_H_
+
+#include <avr/pgmspace.h>
+
+extern const uint8_t MODE_A_CLOCK_BACKGROUND[] PROGMEM;
+extern const uint8_t MODE_A_MENU_BACKGROUND[] PROGMEM;
+extern const uint8_t MODE_A_SET_TIME_BACKGROUND[] PROGMEM;
+extern const uint8_t MODE_A_SET_DATE_BACKGROUND[] PROGMEM;
+extern const uint8_t MODE_A_SET_ALARM_BACKGROUND[] PROGMEM;
+extern const uint8_t MODE_B_BACKGROUND[] PROGMEM;
+
+#endif /* MODE_BACKGROUNDS_H_ */
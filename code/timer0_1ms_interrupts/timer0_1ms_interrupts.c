@@ -10,6 +10,7 @@
  **************************************************************
  * timer0_init() - Initialise timer0 for 1ms interrupts.
  * timer0_get_current_time() - return the last updated time.
+ * timer0_get_current_time_us() - return the time in us.
  **************************************************************
 */
 
@@ -64,6 +65,35 @@ uint32_t timer0_get_current_time() {
 	return returnValue;
 }
 
+/*
+* Return the time in us, made from clockTicks and the count of timer0 within the current
+* tick. Each count is 16us, so the time moves on in 16us steps and wraps after about 71
+* minutes. Interrupts are disabled while the two are read, as above.
+*
+* NOTE:
+*	-	A compare match that happened after interrupts were disabled has not been added to
+*		clockTicks yet, it is added here so the time never goes back.
+*/
+uint32_t timer0_get_current_time_us() {
+	uint32_t ticks;
+	uint8_t count;
+	uint8_t interruptsOn = bit_is_set(SREG, SREG_I);
+	cli();	/* Disable interrupts */
+	
+	ticks = clockTicks;
+	count = TCNT0;
+	
+	/* The timer has cleared but the interrupt has not run yet */
+	if ((TIFR0 & (1<<OCF0A)) && (count < OCR0A)) {
+		ticks++;
+	}
+	
+	if(interruptsOn) {
+		sei(); /* Re-enable interrupts */
+	}
+	return (ticks * 1000) + ((uint32_t)count * 16);
+}
+
 /* Increment our clock tick count every 1ms */
 ISR(TIMER0_COMPA_vect) {
 	clockTicks++;
@@ -10,6 +10,7 @@
  **************************************************************
  * timer0_init() - Initialise timer0 for 1ms interrupts.
  * timer0_get_current_time() - return the last updated time.
+ * timer0_get_current_time_us() - return the time in us.
  **************************************************************
 */
 
@@ -20,5 +21,6 @@
 
 void timer0_init();
 uint32_t timer0_get_current_time();
+uint32_t timer0_get_current_time_us();
 
 #endif /* TIMER0_1MS_INTERRUPTS_H_ */
\ No newline at end of file
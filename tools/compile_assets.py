@@ -0,0 +1,707 @@
+#!/usr/bin/env python3
+"""
+Compile BDF fonts and PBM/XBM icons into the PROGMEM tables used by the SH1106 library.
+
+The fonts in code/SH1106_OLED/XBM_fonts were drawn by hand as hex arrays, with separate
+_WIDTHS and _Y_OFFSET tables that have to be kept in step with the glyphs. Their sources
+are now kept as BDF files in tools/fonts and the icons in XBM_symbols.c as PBM files in
+tools/symbols, and this script turns them back into C.
+
+A font is compiled into XBM_FONT_x.c/.h in the same layout as the existing fonts: an XBM
+array for each glyph (rows of LSB-first bits), the glyph pointer table, the width and
+y-offset tables, a character map and the font_t descriptor. The faster layouts can be
+added to the same file:
+
+    --rotations O,O		Page packed vertical bytes (the SH1106 buffer layout) for each
+						listed screenOrientation, used when OLED_PRE_ROTATED_FONTS is
+						defined. See tools/rotate_fonts.py.
+    --packed			Compressed glyphs, used when OLED_PACKED_FONTS and the font's
+						OLED_PACKED_FONT_x are defined. See tools/pack_assets.py.
+
+How BDF maps onto the font tables:
+    -	Every glyph is stored FONT_ASCENT - (BBX yoff + BBX height) rows below the top of
+		the font, that is its y-offset, and the font height is the tallest BBX.
+    -	The width of a glyph is BBX xoff + BBX width, the library adds the character spacing.
+    -	Characters 33 - 126 are the text, they are stored in the order they are in the file
+		with a character map when that is not ASCII order.
+    -	Characters 128 - 255 are symbols, they must be consecutive and come last.
+    -	Character 32 only sets the width of a space from its DWIDTH.
+
+The check command compares the tree with these sources in two ways:
+    -	XBM_FONT_x.c and XBM_symbols.c were written by hand before this script and are not in
+		its layout, so only their data is compared: the glyph bytes, widths, y-offsets,
+		character map, height and space width of each font, and the bytes of each icon.
+		Compiling a BDF font with the font command gives the same tables, not the same file.
+    -	XBM_FONTS_ROTATED.c/.h, XBM_FONTS_PACKED.c/.h and XBM_SYMBOLS_PACKED.c/.h are made
+		from those tables by rotate_fonts.py and pack_assets.py. They are regenerated into a
+		temporary directory with the command in their banner and must match the files in the
+		tree byte for byte.
+
+The BDF and PBM sources were written by the export command from the tables in the tree, so
+check passing only shows the sources and the tables agree with each other. It says nothing
+about whether the hand drawn glyphs were right in the first place, a font with a bad glyph
+exports to a BDF file with the same bad glyph.
+
+Usage (from the repository root):
+    python3 tools/compile_assets.py font tools/fonts/my_font.bdf --name FONT_12
+    python3 tools/compile_assets.py font tools/fonts/my_font.bdf --name FONT_12 --rotations 0,1 --packed
+    python3 tools/compile_assets.py icons tools/symbols/*.pbm --file XBM_icons
+    python3 tools/compile_assets.py check
+    python3 tools/compile_assets.py export
+"""
+
+import argparse
+import glob
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+from rotate_fonts import FONTS, FONT_DIR, glyph_pixels, rotate, page_pack, format_bytes
+from pack_assets import SYMBOL_DIR, RLE_FLAG, PACKED_RLE, pack_image, FONT_OUTPUT_NAME, SYMBOL_OUTPUT_NAME
+from rotate_fonts import OUTPUT_NAME as ROTATED_OUTPUT_NAME
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+BDF_DIR = os.path.join(TOOLS_DIR, "fonts")
+PBM_DIR = os.path.join(TOOLS_DIR, "symbols")
+
+FONT_NO_GLYPH = 0xFF
+
+# Files in the tree made by the other tools, the command that made them is in the banner of the first
+GENERATED_FILES = [
+	[os.path.join(FONT_DIR, ROTATED_OUTPUT_NAME + extension) for extension in (".c", ".h")],
+	[os.path.join(directory, fileBase + extension)
+		for directory, fileBase in ((FONT_DIR, FONT_OUTPUT_NAME), (SYMBOL_DIR, SYMBOL_OUTPUT_NAME))
+		for extension in (".c", ".h")],
+]
+
+# The existing tables were exported with the padding bits at the end of each row set. The
+# library never draws them, they are set here too so the fonts regenerate bit for bit.
+PADDING_BITS_SET = True
+
+
+class Font:
+	"""A font as the library sees it, independent of where it was read from."""
+
+	def __init__(self, height, spaceAdvance):
+		self.height = height
+		self.spaceAdvance = spaceAdvance
+		self.glyphs = []		# (name, encoding, width, yOffset, pixels) in table order
+
+	def character_map(self):
+		"""Return (firstChar, lastChar, remap or None, firstSymbol, lastSymbol, symbolIndex)."""
+		text = [(encoding, index) for index, (_, encoding, _, _, _) in enumerate(self.glyphs) if encoding < 128]
+		symbols = [(encoding, index) for index, (_, encoding, _, _, _) in enumerate(self.glyphs) if encoding >= 128]
+		if not text:
+			sys.exit("font has no characters between 33 and 126")
+
+		firstChar = min(encoding for encoding, _ in text)
+		lastChar = max(encoding for encoding, _ in text)
+		remap = [FONT_NO_GLYPH] * (lastChar - firstChar + 1)
+		for encoding, index in text:
+			remap[encoding - firstChar] = index
+		if remap == list(range(len(remap))):
+			remap = None
+
+		firstSymbol = lastSymbol = symbolIndex = 0
+		if symbols:
+			firstSymbol = symbols[0][0]
+			lastSymbol = symbols[-1][0]
+			symbolIndex = symbols[0][1]
+			for i, (encoding, index) in enumerate(symbols):
+				if encoding != firstSymbol + i or index != symbolIndex + i:
+					sys.exit("symbols must be consecutive characters at the end of the font")
+		return firstChar, lastChar, remap, firstSymbol, lastSymbol, symbolIndex
+
+
+def xbm_bytes(pixels, width, height):
+	"""Pack a set of (column, row) pixels into XBM rows."""
+	rowBytes = (width + 7) // 8
+	data = [0] * (rowBytes * height)
+	for column, row in pixels:
+		data[row * rowBytes + column // 8] |= 1 << (column % 8)
+	if PADDING_BITS_SET and width % 8:
+		padding = (0xFF << (width % 8)) & 0xFF
+		for row in range(height):
+			data[row * rowBytes + rowBytes - 1] |= padding
+	return data
+
+
+# ---------------------------------------------------------------------------------------
+# Reading
+# ---------------------------------------------------------------------------------------
+
+def read_bdf(path):
+	properties = {}
+	glyphs = []
+	glyph = None
+	bitmap = None
+
+	with open(path) as f:
+		for number, line in enumerate(f, 1):
+			words = line.split()
+			if not words:
+				continue
+			keyword = words[0]
+
+			if bitmap is not None:
+				if keyword == "ENDCHAR":
+					glyph["bitmap"] = bitmap
+					glyphs.append(glyph)
+					glyph = bitmap = None
+				else:
+					bitmap.append(int(words[0], 16) if words[0] else 0)
+				continue
+
+			if keyword in ("FONT_ASCENT", "FONT_DESCENT"):
+				properties[keyword] = int(words[1])
+			elif keyword == "STARTCHAR":
+				glyph = {"name": words[1] if len(words) > 1 else "", "line": number}
+			elif glyph is not None and keyword == "ENCODING":
+				glyph["encoding"] = int(words[1])
+			elif glyph is not None and keyword == "DWIDTH":
+				glyph["dwidth"] = int(words[1])
+			elif glyph is not None and keyword == "BBX":
+				glyph["bbx"] = [int(v) for v in words[1:5]]
+			elif glyph is not None and keyword == "BITMAP":
+				bitmap = []
+
+	if "FONT_ASCENT" not in properties:
+		sys.exit("%s: no FONT_ASCENT property" % path)
+	ascent = properties["FONT_ASCENT"]
+
+	space = None
+	parsed = []
+	for glyph in glyphs:
+		encoding = glyph.get("encoding", -1)
+		if encoding == 32:
+			space = glyph.get("dwidth", 0)
+			continue
+		if not (33 <= encoding <= 126 or 128 <= encoding <= 255):
+			print("%s:%d: skipping character %d" % (path, glyph["line"], encoding), file=sys.stderr)
+			continue
+		if "bbx" not in glyph:
+			sys.exit("%s:%d: no BBX" % (path, glyph["line"]))
+
+		width, rows, xOffset, yOffset = glyph["bbx"]
+		top = ascent - (yOffset + rows)
+		if xOffset < 0 or top < 0:
+			sys.exit("%s:%d: glyph starts left of or above the font" % (path, glyph["line"]))
+
+		rowBits = ((width + 7) // 8) * 8
+		pixels = set()
+		for row, value in enumerate(glyph["bitmap"][:rows]):
+			for column in range(width):
+				if value & (1 << (rowBits - 1 - column)):
+					pixels.add((xOffset + column, row))
+		parsed.append((glyph["name"], encoding, xOffset + width, top, rows, pixels))
+
+	height = max(rows for _, _, _, _, rows, _ in parsed)
+	font = Font(height, space if space is not None else max(1, height // 3))
+	for name, encoding, width, top, rows, pixels in parsed:
+		font.glyphs.append((c_name(name, encoding), encoding, width, top, pixels))
+	return font
+
+
+def c_name(name, encoding):
+	name = re.sub(r"\W", "_", name).upper()
+	if not re.match(r"[A-Z_]", name):
+		name = "CHAR_%d" % encoding
+	# Letters keep their case so 'A' and 'a' do not clash.
+	if 65 <= encoding <= 90 or 97 <= encoding <= 122:
+		if name.upper() == chr(encoding).upper():
+			name = chr(encoding)
+	return name
+
+
+def read_icon(path):
+	"""Return (width, height, pixels) of a PBM (P1 or P4) or XBM file."""
+	with open(path, "rb") as f:
+		raw = f.read()
+
+	if raw[:2] in (b"P1", b"P4"):
+		header = re.match(rb"(P[14])(?:\s+|#[^\n]*\n)+(\d+)(?:\s+|#[^\n]*\n)+(\d+)\s", raw)
+		if not header:
+			sys.exit("%s: bad PBM header" % path)
+		width, height = int(header.group(2)), int(header.group(3))
+		body = raw[header.end():]
+		pixels = set()
+		if header.group(1) == b"P1":
+			bits = [b - ord("0") for b in re.sub(rb"#[^\n]*|[^01]", b"", body)]
+			for i, bit in enumerate(bits[:width * height]):
+				if bit:
+					pixels.add((i % width, i // width))
+		else:
+			rowBytes = (width + 7) // 8
+			for row in range(height):
+				for column in range(width):
+					if body[row * rowBytes + column // 8] & (0x80 >> (column % 8)):
+						pixels.add((column, row))
+		return width, height, pixels
+
+	source = raw.decode()
+	size = dict(re.findall(r"#define\s+\w*_(width|height)\s+(\d+)", source))
+	values = re.search(r"\{([^}]*)\}", source)
+	if "width" not in size or "height" not in size or not values:
+		sys.exit("%s: not a PBM or XBM file" % path)
+	width, height = int(size["width"]), int(size["height"])
+	data = [int(v.strip(), 0) for v in values.group(1).split(",") if v.strip()]
+	return width, height, glyph_pixels(data, width, height)
+
+
+def read_c_font(size):
+	"""Read one of the fonts in FONTS from its C source as a Font."""
+	fileName, name, height = FONTS[size]
+	source = strip_comments(open(os.path.join(FONT_DIR, fileName)).read())
+	arrays = c_arrays(source)
+	shared = c_arrays(strip_comments(open(os.path.join(FONT_DIR, "XBM_FONT.c")).read()))
+
+	pointers = re.search(r"const\s+uint8_t\s*\*\s*const\s+" + name + r"\s*\[\]\s*PROGMEM\s*=\s*\{([^}]*)\}", source)
+	names = re.findall(r"\(const uint8_t\s*\*\)\s*(\w+)", pointers.group(1))
+	widths = arrays[name + "_WIDTHS"]
+	yOffsets = arrays[name + "_Y_OFFSET"]
+
+	descriptor = re.search(r"font_t\s+" + name + r"_DESCRIPTOR\s+PROGMEM\s*=\s*\{(.*?)\};", source, re.S).group(1)
+	fields = dict(re.findall(r"\.(\w+)\s*=\s*([^,\n]+)", descriptor))
+
+	def number(field):
+		value = fields[field].strip()
+		return ord(value[1]) if value.startswith("'") else int(value, 0)
+
+	firstChar = number("firstChar")
+	remapName = fields["remap"].strip()
+	remap = None if remapName == "0" else (arrays.get(remapName) or shared[remapName])
+
+	# Character of each glyph, from the character map and the symbol range.
+	encodings = {}
+	for offset in range(number("lastChar") - firstChar + 1):
+		index = remap[offset] if remap else offset
+		if index != FONT_NO_GLYPH:
+			encodings[index] = firstChar + offset
+	for offset in range(number("lastSymbol") - number("firstSymbol") + 1 if number("firstSymbol") else 0):
+		encodings[number("symbolIndex") + offset] = number("firstSymbol") + offset
+
+	font = Font(number("height"), number("spaceAdvance"))
+	suffix = "_%d" % size
+	for index, glyphName in enumerate(names):
+		if index not in encodings:
+			sys.exit("%s: glyph %s has no character" % (fileName, glyphName))
+		cName = glyphName[:-len(suffix)] if glyphName.endswith(suffix) else glyphName
+		pixels = glyph_pixels(arrays[glyphName], widths[index], height)
+		font.glyphs.append((cName, encodings[index], widths[index], yOffsets[index], pixels))
+	return font, [arrays[glyphName] for glyphName in names]
+
+
+def strip_comments(source):
+	return re.sub(r"/\*.*?\*/|//[^\n]*", "", source, flags=re.S)
+
+
+def c_arrays(source):
+	arrays = {}
+	for match in re.finditer(r"const\s+uint8_t\s+(?:const\s+)?(\w+)\s*\[\d*\]\s*PROGMEM\s*=\s*\{([^}]*)\}", source):
+		values = [v.strip() for v in match.group(2).split(",") if v.strip()]
+		arrays[match.group(1)] = [FONT_NO_GLYPH if v == "NONE" else int(v, 0) for v in values]
+	return arrays
+
+
+# ---------------------------------------------------------------------------------------
+# Writing
+# ---------------------------------------------------------------------------------------
+
+def write_bdf(font, name, path):
+	descent = max([yOffset for _, _, _, yOffset, _ in font.glyphs] + [0])
+	maxWidth = max(width for _, _, width, _, _ in font.glyphs)
+
+	def swidth(dwidth):
+		return dwidth * 72000 // (font.height * 75)
+
+	lines = [
+		"STARTFONT 2.1",
+		"FONT %s" % name,
+		"SIZE %d 75 75" % font.height,
+		"FONTBOUNDINGBOX %d %d 0 %d" % (maxWidth, font.height + descent, -descent),
+		"STARTPROPERTIES 2",
+		"FONT_ASCENT %d" % font.height,
+		"FONT_DESCENT %d" % descent,
+		"ENDPROPERTIES",
+		"CHARS %d" % (len(font.glyphs) + 1),
+		"STARTCHAR space",
+		"ENCODING 32",
+		"SWIDTH %d 0" % swidth(font.spaceAdvance),
+		"DWIDTH %d 0" % font.spaceAdvance,
+		"BBX 0 0 0 0",
+		"BITMAP",
+		"ENDCHAR",
+	]
+	for glyphName, encoding, width, yOffset, pixels in font.glyphs:
+		rowBytes = (width + 7) // 8
+		lines += [
+			"STARTCHAR %s" % glyphName,
+			"ENCODING %d" % encoding,
+			"SWIDTH %d 0" % swidth(width),
+			"DWIDTH %d 0" % width,
+			# The whole height of the font is kept so the glyph comes back the same.
+			"BBX %d %d 0 %d" % (width, font.height, -yOffset),
+			"BITMAP",
+		]
+		for row in range(font.height):
+			value = 0
+			for column in range(width):
+				if (column, row) in pixels:
+					value |= 0x80 << (8 * (rowBytes - 1)) >> column
+			lines.append("%0*X" % (2 * rowBytes, value))
+		lines.append("ENDCHAR")
+	lines.append("ENDFONT")
+
+	with open(path, "w") as f:
+		f.write("\n".join(lines) + "\n")
+
+
+def write_pbm(width, height, pixels, path):
+	with open(path, "w") as f:
+		f.write("P1\n%d %d\n" % (width, height))
+		for row in range(height):
+			f.write(" ".join("1" if (column, row) in pixels else "0" for column in range(width)) + "\n")
+
+
+def c_banner(fileName, lines):
+	return "\n".join([
+		"/*",
+		" **************************************************************",
+		" * " + fileName,
+	] + [" * " + line for line in lines] + [
+		" **************************************************************",
+		"*/",
+		"",
+	])
+
+
+def compile_font(font, name, fileBase, source, rotations, packed, output):
+	suffix = name[len("FONT_"):] if name.startswith("FONT_") else name
+	firstChar, lastChar, remap, firstSymbol, lastSymbol, symbolIndex = font.character_map()
+	generated = [
+		"Font for use in the SH1106 library. Characters are %d" % font.height,
+		"pixels tall. Generated by tools/compile_assets.py from",
+		os.path.relpath(source, os.path.join(TOOLS_DIR, "..")) + ", do not edit.",
+	]
+
+	header = [c_banner(fileBase + ".h", generated)]
+	header.append("#ifndef %s_H_\n#define %s_H_\n" % (fileBase.upper(), fileBase.upper()))
+	header.append("#include \"XBM_FONT.h\"\n")
+
+	body = [c_banner(fileBase + ".c", generated)]
+	body.append("#include <avr/pgmspace.h>\n#include \"%s.h\"\n#include \"../SH1106.h\"\n" % fileBase)
+
+	glyphNames = []
+	for glyphName, encoding, width, yOffset, pixels in font.glyphs:
+		cName = "%s_%s" % (glyphName, suffix)
+		glyphNames.append(cName)
+		data = xbm_bytes(pixels, width, font.height)
+		header.append("extern const uint8_t %s[%d] PROGMEM;" % (cName, len(data)))
+		body.append("const uint8_t %s[%d] PROGMEM = {%s};" % (cName, len(data), ",".join("0x%02x" % v for v in data)))
+	body.append("")
+
+	header.append("")
+	header.append("extern const uint8_t* const %s[] PROGMEM;\n" % name)
+	body.append("const uint8_t* const %s[] PROGMEM =\n{\n%s\n};\n" % (
+		name, "\n".join("\t(const uint8_t*)%s," % cName for cName in glyphNames)))
+
+	header.append("// The widths of each character in the %s array above." % name)
+	header.append("extern const uint8_t %s_WIDTHS[] PROGMEM;\n" % name)
+	body.append("// The widths of each character in the %s array above." % name)
+	body.append("const uint8_t %s_WIDTHS[] PROGMEM =\n{\n%s\n};\n" % (
+		name, format_numbers([width for _, _, width, _, _ in font.glyphs])))
+
+	header.append("// The y-offset of each character in the %s array above." % name)
+	header.append("extern const uint8_t %s_Y_OFFSET[] PROGMEM;\n" % name)
+	body.append("// The y-offset of each character in the %s array above." % name)
+	body.append("const uint8_t %s_Y_OFFSET[] PROGMEM =\n{\n%s\n};\n" % (
+		name, format_numbers([yOffset for _, _, _, yOffset, _ in font.glyphs])))
+
+	if remap:
+		header.append("// Index in the %s array of each character from '%s' to '%s'." % (name, chr(firstChar), chr(lastChar)))
+		header.append("extern const uint8_t %s_REMAP[] PROGMEM;\n" % name)
+		body.append("// Index in the %s array of each character from '%s' to '%s'." % (name, chr(firstChar), chr(lastChar)))
+		body.append("const uint8_t %s_REMAP[] PROGMEM =\n{\n%s\n};\n" % (name, format_numbers(remap)))
+
+	if rotations:
+		body.append("#ifdef OLED_PRE_ROTATED_FONTS\n")
+		for orientation in rotations:
+			data = []
+			offsets = []
+			for _, _, width, _, pixels in font.glyphs:
+				offsets.append(len(data))
+				data.extend(page_pack(*rotate(pixels, width, font.height, orientation)))
+			body.append("const uint8_t %s_ROTATED_%d[] PROGMEM =\n{\n%s\n};\n" % (name, orientation, format_bytes(data)))
+			body.append("const uint16_t %s_ROTATED_%d_OFFSETS[] PROGMEM =\n{\n\t%s\n};\n" % (
+				name, orientation, ", ".join(str(o) for o in offsets)))
+		for table, tableSuffix in (("uint8_t", ""), ("uint16_t", "_OFFSETS")):
+			entries = ", ".join("%s_ROTATED_%d%s" % (name, o, tableSuffix) if o in rotations else "0" for o in range(4))
+			body.append("const %s* const %s_ROTATED%s[] PROGMEM =\n{\n\t%s\n};\n" % (table, name, tableSuffix, entries))
+		body.append("#endif /* OLED_PRE_ROTATED_FONTS */\n")
+
+	if packed:
+		data = []
+		offsets = []
+		for _, _, width, _, pixels in font.glyphs:
+			encoding, glyphData, _, _ = pack_image(pixels, width, font.height)
+			offsets.append(len(data) | (RLE_FLAG if encoding == PACKED_RLE else 0))
+			data.extend(glyphData)
+		body.append("#if defined(OLED_PACKED_FONTS) && defined(OLED_PACKED_%s)\n" % name)
+		body.append("const uint8_t %s_PACKED[] PROGMEM =\n{\n%s\n};\n" % (name, format_bytes(data)))
+		body.append("const uint16_t %s_PACKED_OFFSETS[] PROGMEM =\n{\n\t%s\n};\n" % (
+			name, ", ".join("0x%04x" % o for o in offsets)))
+		body.append("#endif /* OLED_PACKED_%s */\n" % name)
+
+	header.append("// Descriptor used by OLED_draw_string_font() to draw with this font.")
+	header.append("extern const font_t %s_DESCRIPTOR PROGMEM;\n" % name)
+	header.append("#endif /* %s_H_ */" % fileBase.upper())
+
+	descriptor = [
+		".firstChar = %s," % c_char(firstChar),
+		".lastChar = %s," % c_char(lastChar),
+		".remap = %s," % ("%s_REMAP" % name if remap else "0"),
+		".firstSymbol = %d," % firstSymbol,
+		".lastSymbol = %d," % lastSymbol,
+		".symbolIndex = %d," % symbolIndex,
+		".height = %d," % font.height,
+		".spaceAdvance = %d," % font.spaceAdvance,
+		".widths = %s_WIDTHS," % name,
+		".yOffsets = %s_Y_OFFSET," % name,
+	]
+	descriptor = ["\t" + line for line in descriptor]
+	if rotations:
+		descriptor += [
+			"\t#ifdef OLED_PRE_ROTATED_FONTS",
+			"\t\t.rotated = %s_ROTATED," % name,
+			"\t\t.rotatedOffsets = %s_ROTATED_OFFSETS," % name,
+			"\t#else",
+			"\t\t.rotated = 0,",
+			"\t\t.rotatedOffsets = 0,",
+			"\t#endif /* OLED_PRE_ROTATED_FONTS */",
+		]
+	else:
+		descriptor += ["\t.rotated = 0,", "\t.rotatedOffsets = 0,"]
+	# The glyphs drawn in the orientations that are not pre-rotated, see OLED_NO_FALLBACK_FONT_x
+	fallbacks = []
+	if rotations:
+		fallbacks.append(("defined(OLED_PRE_ROTATED_FONTS) && defined(OLED_NO_FALLBACK_%s)" % name, "0", "0", "0"))
+	if packed:
+		fallbacks.append(("defined(OLED_PACKED_FONTS) && defined(OLED_PACKED_%s)" % name, "0", name + "_PACKED", name + "_PACKED_OFFSETS"))
+	if fallbacks:
+		for index, (condition, glyphs, packedGlyphs, packedOffsets) in enumerate(fallbacks):
+			descriptor += [
+				"\t#%s %s" % ("if" if index == 0 else "elif", condition),
+				"\t\t.glyphs = %s," % glyphs,
+				"\t\t.packed = %s," % packedGlyphs,
+				"\t\t.packedOffsets = %s" % packedOffsets,
+			]
+		descriptor += [
+			"\t#else",
+			"\t\t.glyphs = %s," % name,
+			"\t\t.packed = 0,",
+			"\t\t.packedOffsets = 0",
+			"\t#endif",
+		]
+	else:
+		descriptor += ["\t.glyphs = %s," % name, "\t.packed = 0,", "\t.packedOffsets = 0"]
+
+	body.append("// Descriptor used by OLED_draw_string_font() to draw with this font.")
+	body.append("const font_t %s_DESCRIPTOR PROGMEM =\n{\n%s\n};" % (name, "\n".join(descriptor)))
+
+	for extension, lines in ((".h", header), (".c", body)):
+		with open(os.path.join(output, fileBase + extension), "w") as f:
+			f.write("\n".join(lines) + "\n")
+	print("%s: %d glyphs, %d pixels tall" % (fileBase, len(font.glyphs), font.height))
+
+
+def compile_icons(paths, fileBase, output):
+	generated = [
+		"Icons for use in the SH1106 library. Generated by",
+		"tools/compile_assets.py, do not edit.",
+	]
+	header = [c_banner(fileBase + ".h", generated)]
+	header.append("#ifndef %s_H_\n#define %s_H_\n" % (fileBase.upper(), fileBase.upper()))
+	body = [c_banner(fileBase + ".c", generated)]
+	body.append("#include <avr/pgmspace.h>\n")
+
+	for path in paths:
+		name = os.path.splitext(os.path.basename(path))[0]
+		prefix = re.sub(r"([A-Z])", r"_\1", name).upper()
+		width, height, pixels = read_icon(path)
+		data = xbm_bytes(pixels, width, height)
+		header.append("#define %s_WIDTH\t%d" % (prefix, width))
+		header.append("#define %s_HEIGHT\t%d" % (prefix, height))
+		header.append("extern const uint8_t %s[] PROGMEM;\n" % name)
+		body.append("const uint8_t %s[] PROGMEM = {\n%s\n};\n" % (name, format_bytes(data, (width + 7) // 8 * 4)))
+
+	header.append("#endif /* %s_H_ */" % fileBase.upper())
+	for extension, lines in ((".h", header), (".c", body)):
+		with open(os.path.join(output, fileBase + extension), "w") as f:
+			f.write("\n".join(lines) + "\n")
+	print("%s: %d icons" % (fileBase, len(paths)))
+
+
+def format_numbers(values, perLine=20):
+	return ",\n".join("\t" + ", ".join(str(v) for v in values[i:i + perLine]) for i in range(0, len(values), perLine))
+
+
+def c_char(value):
+	if 32 < value < 127 and chr(value) not in "'\\":
+		return "'%s'" % chr(value)
+	return str(value)
+
+
+# ---------------------------------------------------------------------------------------
+# Commands
+# ---------------------------------------------------------------------------------------
+
+def bdf_path(size):
+	return os.path.join(BDF_DIR, FONTS[size][1].lower() + ".bdf")
+
+
+def c_symbols():
+	"""Return {name: (width, height, data)} for the icons in XBM_symbols.c."""
+	from pack_assets import parse_symbols
+	return dict((name, (width, height, data)) for name, data, width, height in parse_symbols())
+
+
+def check_generated(paths):
+	"""Regenerate files made by another tool into a temporary directory. Return the problems."""
+	with open(paths[0]) as f:
+		command = re.search(r"^ \* python3 (tools/\w+\.py)(.*)$", f.read(), flags=re.M)
+	if not command:
+		return ["%s: no command to regenerate it in the banner" % os.path.basename(paths[0])]
+
+	problems = []
+	with tempfile.TemporaryDirectory() as output:
+		script = os.path.join(TOOLS_DIR, os.path.basename(command.group(1)))
+		run = subprocess.run([sys.executable, script] + command.group(2).split() + ["--output", output],
+			stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+		if run.returncode != 0:
+			return ["%s failed:\n%s" % (command.group(1), run.stdout)]
+		for path in paths:
+			with open(path) as f:
+				expected = f.read()
+			with open(os.path.join(output, os.path.basename(path))) as f:
+				generated = f.read()
+			if generated != expected:
+				line = next(i for i, (a, b) in enumerate(zip(generated.splitlines() + [""], expected.splitlines() + [""]), 1) if a != b)
+				problems.append("%s: line %d differs from a fresh %s" % (os.path.basename(path), line, command.group(1)))
+	return problems
+
+
+def command_check(args):
+	"""
+	Compare the data of the hand written tables in the tree with the BDF and PBM sources, and
+	the files generated from those tables with a fresh run of the tool that made them.
+	"""
+	failures = 0
+
+	for size in sorted(FONTS):
+		fileName, name, _ = FONTS[size]
+		expected, expectedData = read_c_font(size)
+		font = read_bdf(bdf_path(size))
+		problems = []
+
+		if (font.height, font.spaceAdvance) != (expected.height, expected.spaceAdvance):
+			problems.append("height or space width differs")
+		if font.character_map() != expected.character_map():
+			problems.append("character map differs")
+		if len(font.glyphs) != len(expected.glyphs):
+			problems.append("%d glyphs, expected %d" % (len(font.glyphs), len(expected.glyphs)))
+
+		for index, (glyph, other) in enumerate(zip(font.glyphs, expected.glyphs)):
+			_, encoding, width, yOffset, pixels = glyph
+			label = "glyph %d (%s)" % (index, other[0])
+			if (encoding, width, yOffset) != other[1:4]:
+				problems.append("%s: character, width or y-offset differs" % label)
+			elif xbm_bytes(pixels, width, font.height) != expectedData[index]:
+				problems.append("%s: bitmap differs" % label)
+
+		failures += len(problems)
+		print("%-8s %s" % (name, "ok" if not problems else "FAILED"))
+		for problem in problems[:10]:
+			print("\t" + problem)
+
+	expectedSymbols = c_symbols()
+	for path in sorted(glob.glob(os.path.join(PBM_DIR, "*"))):
+		name = os.path.splitext(os.path.basename(path))[0]
+		width, height, pixels = read_icon(path)
+		ok = name in expectedSymbols and expectedSymbols[name] == (width, height, xbm_bytes(pixels, width, height))
+		failures += not ok
+		print("%-8s %s" % (name, "ok" if ok else "FAILED"))
+	missing = set(expectedSymbols) - set(os.path.splitext(os.path.basename(p))[0] for p in glob.glob(os.path.join(PBM_DIR, "*")))
+	for name in sorted(missing):
+		failures += 1
+		print("%-8s FAILED\n\tno source in %s" % (name, os.path.relpath(PBM_DIR)))
+
+	for paths in GENERATED_FILES:
+		problems = check_generated(paths)
+		failures += len(problems)
+		print("%s %s" % (", ".join(os.path.basename(path) for path in paths), "ok" if not problems else "FAILED"))
+		for problem in problems:
+			print("\t" + problem)
+
+	if failures:
+		sys.exit("%d differences" % failures)
+
+
+def command_export(args):
+	"""Write the BDF and PBM sources from the tables in the tree."""
+	os.makedirs(BDF_DIR, exist_ok=True)
+	os.makedirs(PBM_DIR, exist_ok=True)
+	for size in sorted(FONTS):
+		font, _ = read_c_font(size)
+		write_bdf(font, FONTS[size][1], bdf_path(size))
+		print(os.path.relpath(bdf_path(size)))
+	for name, (width, height, data) in sorted(c_symbols().items()):
+		path = os.path.join(PBM_DIR, name + ".pbm")
+		write_pbm(width, height, glyph_pixels(data, width, height), path)
+		print(os.path.relpath(path))
+
+
+def command_font(args):
+	rotations = sorted({int(v) for v in args.rotations.split(",") if v != ""}) if args.rotations else []
+	if any(o not in range(4) for o in rotations):
+		sys.exit("orientations must be 0-3")
+	fileBase = args.file or "XBM_" + args.name
+	compile_font(read_bdf(args.bdf), args.name, fileBase, args.bdf, rotations, args.packed, args.output)
+
+
+def command_icons(args):
+	compile_icons(args.images, args.file, args.output)
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+	commands = parser.add_subparsers(dest="command", required=True)
+
+	font = commands.add_parser("font", help="compile a BDF font into XBM_FONT_x.c/.h")
+	font.add_argument("bdf")
+	font.add_argument("--name", required=True, help="name of the glyph table, eg FONT_12")
+	font.add_argument("--file", help="name of the generated files, default XBM_<name>")
+	font.add_argument("--rotations", metavar="O,O", help="also generate page packed glyphs for these orientations")
+	font.add_argument("--packed", action="store_true", help="also generate compressed glyphs")
+	font.add_argument("--output", default=FONT_DIR, help="directory for the generated files")
+	font.set_defaults(run=command_font)
+
+	icons = commands.add_parser("icons", help="compile PBM or XBM images into one .c/.h pair")
+	icons.add_argument("images", nargs="+")
+	icons.add_argument("--file", default="XBM_icons", help="name of the generated files")
+	icons.add_argument("--output", default=SYMBOL_DIR, help="directory for the generated files")
+	icons.set_defaults(run=command_icons)
+
+	check = commands.add_parser("check", help="check the tables in the tree hold the data of tools/fonts and tools/symbols, and the files made from them regenerate byte for byte")
+	check.set_defaults(run=command_check)
+
+	export = commands.add_parser("export", help="write tools/fonts and tools/symbols from the tables in the tree")
+	export.set_defaults(run=command_export)
+
+	args = parser.parse_args()
+	args.run(args)
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""
+Summarise the i2c trace dumped by the roll clock over USART.
+
+With I2C_TRACE defined in i2cmaster.h the TWI layer records every transaction, queued or
+blocking, and sending 'd' to the clock dumps the records with i2c_trace_dump() in main.c:
+
+    i2c trace begin,lost 0
+    address,direction,bytes,status,start_us,end_us
+    0x78,W,131,ok,1203456,1206512
+    i2c trace end
+
+Save the serial output to a file (anything outside the begin and end lines is ignored, so
+several dumps and other output can be in the same file) and this script prints, for each
+device:
+
+    -	transactions, failures and bytes after the address,
+    -	occupancy, the time the device held the bus as a share of the traced time,
+    -	latency, the time from the start condition to the stop, mean, 95th percentile and max.
+
+The traced time runs from the first start condition to the last stop, so records lost to a
+full ring make the occupancy read low. The number lost is printed with the totals.
+
+Usage (from the repository root):
+    python3 tools/i2c_trace_summary.py serial.log
+    python3 tools/i2c_trace_summary.py < serial.log
+"""
+
+import argparse
+import sys
+
+# Addresses with the R/W bit clear, the same as I2C_DEVICE() in the drivers
+DEVICES = {
+	0x78: "SH1106 OLED",
+	0xDE: "MCP7940N RTC",
+	0xA6: "ADXL343",
+	0xB8: "AM2320",
+}
+
+WRAP = 1 << 32		# timer0_get_current_time_us() is a uint32_t
+
+
+class Record:
+	def __init__(self, fields):
+		self.address = int(fields[0], 16)
+		self.direction = fields[1]
+		self.count = int(fields[2])
+		self.ok = fields[3] == "ok"
+		self.start = int(fields[4])
+		self.end = int(fields[5])
+
+	def duration(self):
+		return (self.end - self.start) % WRAP
+
+
+def read_dumps(lines):
+	"""Return the records of every dump in order and the number lost."""
+	records = []
+	lost = 0
+	inDump = False
+	for number, line in enumerate(lines, 1):
+		line = line.strip()
+		if line.startswith("i2c trace begin"):
+			inDump = True
+			lost += int(line.split("lost")[-1])
+		elif line == "i2c trace end":
+			inDump = False
+		elif inDump and line and not line.startswith("address,"):
+			fields = line.split(",")
+			if len(fields) != 6:
+				sys.exit("line %d: expected 6 fields, got '%s'" % (number, line))
+			records.append(Record(fields))
+	return records, lost
+
+
+def unwrap(records):
+	"""Give each record a start time that keeps counting past the uint32_t wrap."""
+	offset = 0
+	last = None
+	for record in records:
+		if last is not None and record.start + (WRAP // 2) < last:
+			offset += WRAP
+		last = record.start
+		record.time = record.start + offset
+
+
+def percentile(values, fraction):
+	ordered = sorted(values)
+	return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def summarise(records, lost):
+	if not records:
+		print("no trace records")
+		return
+
+	unwrap(records)
+	first = min(record.time for record in records)
+	last = max(record.time + record.duration() for record in records)
+	traced = max(last - first, 1)
+
+	byDevice = {}
+	for record in records:
+		byDevice.setdefault(record.address, []).append(record)
+
+	print("%d records over %.3f s, %d lost" % (len(records), traced / 1e6, lost))
+	print()
+	print("%-20s %8s %6s %8s %10s %10s %10s %10s" % ("device", "count", "failed", "bytes", "occupancy", "mean us", "p95 us", "max us"))
+	busy = 0
+	for address in sorted(byDevice):
+		deviceRecords = byDevice[address]
+		durations = [record.duration() for record in deviceRecords]
+		busy += sum(durations)
+		name = "0x%02X %s" % (address, DEVICES.get(address, ""))
+		print("%-20s %8d %6d %8d %9.2f%% %10.0f %10d %10d" % (
+			name.strip(),
+			len(deviceRecords),
+			sum(not record.ok for record in deviceRecords),
+			sum(record.count for record in deviceRecords),
+			100.0 * sum(durations) / traced,
+			sum(durations) / len(durations),
+			percentile(durations, 0.95),
+			max(durations)))
+	print("%-20s %8d %6s %8s %9.2f%%" % ("bus", len(records), "", "", 100.0 * busy / traced))
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+	parser.add_argument("files", nargs="*", help="serial logs with i2c trace dumps, stdin if none")
+	args = parser.parse_args()
+
+	lines = []
+	if args.files:
+		for fileName in args.files:
+			with open(fileName, errors="replace") as f:
+				lines += f.readlines()
+	else:
+		lines = sys.stdin.readlines()
+
+	summarise(*read_dumps(lines))
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""
+Draw the static parts of the roll clock screens into background templates.
+
+The boxes and labels that never change on a screen used to be drawn again with
+OLED_draw_rectangle() and OLED_draw_string() each time the screen was cleared. They are now
+drawn once here, by tools/oled_host/backgrounds.c, with the real widget calls and the layout
+macros in MODE_A.h and MODE_B.h, built against the host stand-ins in tools/oled_host the same
+as tools/oled_host_test.py. The buffers it prints are packed into templates that
+OLED_draw_background() copies straight into the frame buffer and OLED_restore_background()
+copies back under a widget.
+
+A template is stored a page at a time. Each page is a list of runs of buffer columns:
+
+    start column, number of columns, one buffer byte for each column...
+
+and ends with OLED_BACKGROUND_END_OF_PAGE (0xFF). Columns outside the runs are blank, so a
+page with nothing on it is a single byte. Runs closer together than the 2 byte run header are
+joined into one.
+
+Change a screen in backgrounds.c, or a layout macro, and regenerate the files. --check draws
+the screens with the C code and fails if the committed templates no longer match them.
+
+Usage (from the repository root):
+    python3 tools/make_backgrounds.py
+    python3 tools/make_backgrounds.py --check
+    python3 tools/make_backgrounds.py --show MODE_A_CLOCK_BACKGROUND
+    CC=clang CXX=clang++ python3 tools/make_backgrounds.py --check
+"""
+
+import argparse
+import os
+import sys
+import tempfile
+
+from compile_assets import c_banner
+from oled_host_test import build_and_run
+from rotate_fonts import format_bytes
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+OUTPUT_DIR = os.path.join(TOOLS_DIR, "..", "code", "roll_clock_modes")
+FILE_BASE = "MODE_BACKGROUNDS"
+
+OLED_WIDTH = 128
+OLED_HEIGHT = 64
+END_OF_PAGE = 0xFF
+
+
+def draw_backgrounds():
+	"""Build and run backgrounds.c. Return [(name, description, [page bytes, ...]), ...]."""
+	with tempfile.TemporaryDirectory() as workDir:
+		passed, output = build_and_run("backgrounds.c", [], workDir)
+	if not passed:
+		sys.exit("backgrounds.c failed\n" + output)
+
+	backgrounds = []
+	for line in output.splitlines():
+		kind, rest = line.split(" ", 1)
+		if kind == "background":
+			name, description = rest.split(" ", 1)
+			backgrounds.append((name, description, []))
+		elif kind == "page":
+			_, values = rest.split(" ")
+			backgrounds[-1][2].append(list(bytes.fromhex(values)))
+	for name, _, pages in backgrounds:
+		if len(pages) != OLED_HEIGHT // 8 or any(len(values) != OLED_WIDTH for values in pages):
+			sys.exit("backgrounds.c printed a short buffer for %s" % name)
+	return backgrounds
+
+
+def page_runs(values):
+	"""Split a page into (start, bytes) runs, joining runs with gaps no longer than a run header."""
+	runs = []
+	for column, value in enumerate(values):
+		if not value:
+			continue
+		if runs and column - (runs[-1][0] + len(runs[-1][1])) <= 2:
+			start, data = runs[-1]
+			data.extend(values[start + len(data):column + 1])
+		else:
+			runs.append((column, [value]))
+	return runs
+
+
+def encode(buffer):
+	"""Return the template bytes and a comment for each page."""
+	pages = []
+	for page in range(OLED_HEIGHT // 8):
+		data = []
+		runs = page_runs(buffer[page])
+		for start, values in runs:
+			data += [start, len(values)] + values
+		data.append(END_OF_PAGE)
+		pages.append((data, "Page %d, %s" % (page, ", ".join("columns %d - %d" % (start, start + len(values) - 1) for start, values in runs) or "blank")))
+	return pages
+
+
+def generate(backgrounds):
+	"""Return {fileName: contents} for the generated .c and .h."""
+	command = "python3 tools/make_backgrounds.py"
+	arrays = []
+	total = 0
+	for name, description, buffer in backgrounds:
+		pages = encode(buffer)
+		size = sum(len(data) for data, _ in pages)
+		total += size
+		body = []
+		for data, comment in pages:
+			body.append("\t/* %s */" % comment)
+			body.append(format_bytes(data))
+		arrays.append((name, description, size, "\n".join(body)))
+
+	def banner(fileName):
+		return c_banner(fileName, [
+			"Backgrounds of the roll clock screens, drawn with",
+			"OLED_draw_background().",
+			"Generated by tools/make_backgrounds.py, do not edit.",
+			"Regenerate after changing a screen with:",
+			command,
+			"Total size: %d bytes of flash." % total,
+		])
+
+	source = [banner(FILE_BASE + ".c"), "#include <avr/pgmspace.h>", "#include \"%s.h\"" % FILE_BASE, ""]
+	header = [banner(FILE_BASE + ".h"), "#ifndef %s_H_" % FILE_BASE, "#define %s_H_" % FILE_BASE, "", "#include <avr/pgmspace.h>", ""]
+	for name, description, size, body in arrays:
+		source.append("/* %s, %d bytes */" % (description, size))
+		source.append("const uint8_t %s[] PROGMEM =\n{\n%s\n};\n" % (name, body))
+		header.append("extern const uint8_t %s[] PROGMEM;" % name)
+	header += ["", "#endif /* %s_H_ */" % FILE_BASE, ""]
+
+	return {
+		FILE_BASE + ".c": "\n".join(source),
+		FILE_BASE + ".h": "\n".join(header),
+	}
+
+
+def show(backgrounds, name):
+	buffers = dict((background[0], background[2]) for background in backgrounds)
+	if name not in buffers:
+		sys.exit("unknown background %s" % name)
+	buffer = buffers[name]
+	for y in range(OLED_HEIGHT):
+		print("".join("#" if buffer[y // 8][x] & (1 << (y % 8)) else "." for x in range(OLED_WIDTH)))
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+	parser.add_argument("--check", action="store_true", help="check the files in the tree match the screens drawn by the C code without writing them")
+	parser.add_argument("--show", metavar="NAME", help="print one background as text without writing any files")
+	parser.add_argument("--output", default=OUTPUT_DIR, help="directory for the generated files")
+	args = parser.parse_args()
+
+	backgrounds = draw_backgrounds()
+	if args.show:
+		show(backgrounds, args.show)
+		return
+
+	stale = 0
+	for fileName, contents in generate(backgrounds).items():
+		path = os.path.join(args.output, fileName)
+		if args.check:
+			current = open(path).read() if os.path.exists(path) else None
+			stale += current != contents
+			print("%-24s %s" % (fileName, "ok" if current == contents else "OUT OF DATE"))
+		else:
+			with open(path, "w") as f:
+				f.write(contents)
+			print(os.path.relpath(path))
+	if stale:
+		sys.exit("%d files out of date" % stale)
+
+
+if __name__ == "__main__":
+	main()
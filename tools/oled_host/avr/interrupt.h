@@ -0,0 +1,14 @@
+/*
+ * Host stand-in for <avr/interrupt.h>. The TWI model in host_twi.cpp runs the TWI interrupt
+ * when the i2c code turns the I bit of SREG back on with it waiting.
+ */
+#ifndef HOST_AVR_INTERRUPT_H_
+#define HOST_AVR_INTERRUPT_H_
+
+#include <avr/io.h>
+
+#define ISR(vector) void vector(void)
+#define sei() (SREG |= (1 << SREG_I))
+#define cli() (SREG &= ~(1 << SREG_I))
+
+#endif /* HOST_AVR_INTERRUPT_H_ */
@@ -0,0 +1,39 @@
+/*
+ * Host stand-in for <avr/io.h>, enough for the SH1106 library and the i2c code to build
+ * with the host compiler. SREG is a plain variable defined in host_twi.cpp, which also
+ * models the TWI and PORTC registers the i2c code uses.
+ */
+#ifndef HOST_AVR_IO_H_
+#define HOST_AVR_IO_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern volatile uint8_t SREG;
+
+#ifdef __cplusplus
+}
+#endif
+
+#define SREG_I 7
+
+/* TWCR bits */
+#define TWINT	7
+#define TWEA	6
+#define TWSTA	5
+#define TWSTO	4
+#define TWWC	3
+#define TWEN	2
+#define TWIE	0
+
+/* TWI pins on PORTC */
+#define PC4 4
+#define PC5 5
+
+#define _BV(bit) (1 << (bit))
+#define bit_is_set(sfr, bit) ((sfr) & _BV(bit))
+
+#endif /* HOST_AVR_IO_H_ */
@@ -0,0 +1,23 @@
+/*
+ * Host stand-in for <avr/pgmspace.h>. PROGMEM data is ordinary memory on the host.
+ */
+#ifndef HOST_AVR_PGMSPACE_H_
+#define HOST_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(string) (string)
+#define PGM_P const char*
+
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+#define pgm_read_dword(address) (*(const uint32_t*)(address))
+/* The library reads its PROGMEM pointer tables with pgm_read_word(), pointers are wider on the host */
+#define pgm_read_word(address) ((sizeof(*(address)) == sizeof(uint16_t)) ? \
+	(uintptr_t)*(const uint16_t*)(address) : *(const uintptr_t*)(address))
+
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#endif /* HOST_AVR_PGMSPACE_H_ */
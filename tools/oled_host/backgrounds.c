@@ -0,0 +1,80 @@
+/*
+ **************************************************************
+ * backgrounds.c
+ * Draws the parts of the roll clock screens that never change
+ * with the real widget calls and prints the buffer of each one
+ * as hex, a page per line. tools/make_backgrounds.py builds
+ * and runs it and packs the buffers into the templates in
+ * roll_clock_modes/MODE_BACKGROUNDS.c.
+ **************************************************************
+*/
+
+#include <stdio.h>
+
+#include "host_oled.h"
+
+/* Built in so the buffer can be printed after the widgets are drawn */
+#include "SH1106_OLED/SH1106.c"
+#include "OLED_widgets/OLED_widgets.c"
+
+#include "roll_clock_modes/MODE_A.h"
+#include "roll_clock_modes/MODE_B.h"
+
+/*
+* _print_background()
+* -------------------
+* Private function to draw the widgets added since WIDGET_screen() and print the buffer under
+* the name of the template it is packed into.
+*/
+static void _print_background(const char* name, const char* description) {
+	WIDGET_render();
+
+	printf("background %s %s\n", name, description);
+	for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
+		printf("page %u ", page);
+		for (uint8_t column = 0; column < OLED_WIDTH; column++) {
+			printf("%02x", _oled_buffer[page][column]);
+		}
+		printf("\n");
+	}
+}
+
+/*
+* _print_title()
+* --------------
+* Private function to print a Mode A settings screen, its title centred at the top.
+*/
+static void _print_title(uint8_t screen, const char* title, const char* name, const char* description) {
+	WIDGET_screen(screen);
+	WIDGET_add_label_P(title, OLED_WIDTH / 2, MODE_A_TITLE_Y, 16, 2, OLED_ALIGN_CENTER, MODE_A);
+	_print_background(name, description);
+}
+
+int main() {
+	uint8_t screen = 0;
+
+	WIDGET_screen(screen++);
+	WIDGET_add_box(0, MODE_A_TIME_LINE_Y, OLED_WIDTH - 1, 1, WIDGET_BOX_FILLED, MODE_A);
+	WIDGET_add_box(0, MODE_A_DATE_BOX_Y, OLED_WIDTH - 1, 1, WIDGET_BOX_FILLED, MODE_A);
+	WIDGET_add_box(MODE_A_DATE_BOX_WIDTH, MODE_A_DATE_BOX_Y, 1, OLED_HEIGHT - 1 - MODE_A_DATE_BOX_Y, WIDGET_BOX_FILLED, MODE_A);
+	WIDGET_add_box(0, 0, OLED_WIDTH, OLED_HEIGHT - 1, WIDGET_BOX_OUTLINE, MODE_A);
+	_print_background("MODE_A_CLOCK_BACKGROUND", "Mode A clock face, the lines between the time, date and alarm icon");
+
+	// Each item is 2 pixels under the top of the row _menu_highlight_option() inverts.
+	WIDGET_screen(screen++);
+	WIDGET_add_label_P(PSTR("Set Time"), MODE_A_MENU_TEXT_X, 2, 16, 2, OLED_ALIGN_LEFT, MODE_A);
+	WIDGET_add_label_P(PSTR("Set Date"), MODE_A_MENU_TEXT_X, MODE_A_MENU_ROW_HEIGHT + 2, 16, 2, OLED_ALIGN_LEFT, MODE_A);
+	WIDGET_add_label_P(PSTR("Set Alarm"), MODE_A_MENU_TEXT_X, 2 * MODE_A_MENU_ROW_HEIGHT + 2, 16, 2, OLED_ALIGN_LEFT, MODE_A);
+	_print_background("MODE_A_MENU_BACKGROUND", "Mode A settings menu");
+
+	_print_title(screen++, PSTR("Set Time"), "MODE_A_SET_TIME_BACKGROUND", "Mode A set time title");
+	_print_title(screen++, PSTR("Set Date"), "MODE_A_SET_DATE_BACKGROUND", "Mode A set date title");
+	_print_title(screen++, PSTR("Set Alarm"), "MODE_A_SET_ALARM_BACKGROUND", "Mode A set alarm title");
+
+	WIDGET_screen(screen++);
+	WIDGET_add_label_P(PSTR("Temperature"), 0, MODE_B_TEMPERATURE_LABEL_Y, 8, 1, OLED_ALIGN_LEFT, MODE_B);
+	WIDGET_add_label_P(PSTR("Humidity"), 0, MODE_B_HUMIDITY_LABEL_Y, 8, 1, OLED_ALIGN_LEFT, MODE_B);
+	_print_background("MODE_B_BACKGROUND", "Mode B temperature and humidity labels");
+
+	return 0;
+}
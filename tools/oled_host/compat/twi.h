@@ -0,0 +1,26 @@
+/*
+ * Host stand-in for <compat/twi.h>, the TWI status codes the i2c code checks.
+ */
+#ifndef HOST_COMPAT_TWI_H_
+#define HOST_COMPAT_TWI_H_
+
+#include <avr/io.h>
+
+#define TW_STATUS		(TWSR & 0xF8)
+
+#define TW_START		0x08
+#define TW_REP_START	0x10
+#define TW_MT_SLA_ACK	0x18
+#define TW_MT_SLA_NACK	0x20
+#define TW_MT_DATA_ACK	0x28
+#define TW_MT_DATA_NACK	0x30
+#define TW_MT_ARB_LOST	0x38
+#define TW_MR_ARB_LOST	0x38
+#define TW_MR_SLA_ACK	0x40
+#define TW_MR_SLA_NACK	0x48
+#define TW_MR_DATA_ACK	0x50
+#define TW_MR_DATA_NACK	0x58
+#define TW_NO_INFO		0xF8
+#define TW_BUS_ERROR	0x00
+
+#endif /* HOST_COMPAT_TWI_H_ */
@@ -0,0 +1,681 @@
+/*
+ **************************************************************
+ * draw_bench.c
+ * Times the SH1106 draw functions against the pixel at a time
+ * versions they replaced and checks both leave the same pixels
+ * in the buffer. The old versions are copied here from the
+ * history of SH1106.c, drawing with the old OLED_set_pixel().
+ * Built and run by tools/oled_host_test.py bench.
+ *
+ * The times are host nanoseconds, not AVR cycles, see
+ * tools/oled_host_test.py for how to read them.
+ **************************************************************
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "host_oled.h"
+
+/* Built in so the old versions can draw into the same buffer */
+#include "SH1106_OLED/SH1106.c"
+
+#define BENCH_RUNS 5			/* The fastest run is reported */
+#define BENCH_CALLS 2000		/* Calls in each run */
+
+static uint32_t _seed = 1;
+static uint8_t _failed;
+static uint8_t _before[OLED_HEIGHT / 8][OLED_WIDTH];	/* Buffer before the draw being checked */
+static uint8_t _expected[OLED_HEIGHT / 8][OLED_WIDTH];	/* Buffer after the old version */
+
+/*
+* _random()
+* ---------
+* xorshift32, so every host checks the same cases.
+*/
+static uint32_t _random(uint32_t range) {
+	_seed ^= _seed << 13;
+	_seed ^= _seed >> 17;
+	_seed ^= _seed << 5;
+	return _seed % range;
+}
+
+/*
+* _now_ns()
+* ---------
+* Monotonic host time in nanoseconds.
+*/
+static uint64_t _now_ns() {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+/*
+* _time_ns()
+* ----------
+* Time a draw, the fastest of BENCH_RUNS runs of BENCH_CALLS calls.
+*
+* draw: Function that makes one call of the draw being timed.
+*
+* Return:	Nanoseconds per call.
+*/
+static double _time_ns(void (*draw)(void)) {
+	uint64_t best = ~0ULL;
+
+	for (uint8_t run = 0; run < BENCH_RUNS; run++) {
+		uint64_t start = _now_ns();
+		for (uint16_t call = 0; call < BENCH_CALLS; call++) {
+			draw();
+		}
+		uint64_t elapsed = _now_ns() - start;
+		if (elapsed < best) {
+			best = elapsed;
+		}
+	}
+	return (double)best / BENCH_CALLS;
+}
+
+/*
+* _start_case()
+* -------------
+* Fill the buffer with a pattern, or clear it, and mark every page clean so the dirty ranges
+* of the draw can be checked.
+*/
+static void _start_case(uint8_t randomFill) {
+	for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
+		for (uint8_t column = 0; column < OLED_WIDTH; column++) {
+			_oled_buffer[page][column] = randomFill ? _random(256) : 0;
+		}
+		_dirtyStart[page] = OLED_WIDTH;
+		_dirtyEnd[page] = 0;
+	}
+	memcpy(_before, _oled_buffer, sizeof(_before));
+}
+
+/*
+* _keep_expected()
+* ----------------
+* Keep the buffer the old version drew and put the starting buffer back for the new one.
+*/
+static void _keep_expected() {
+	memcpy(_expected, _oled_buffer, sizeof(_expected));
+	memcpy(_oled_buffer, _before, sizeof(_before));
+	for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
+		_dirtyStart[page] = OLED_WIDTH;
+		_dirtyEnd[page] = 0;
+	}
+}
+
+/*
+* _check_case()
+* -------------
+* Compare the buffer the new version drew with the old one's, and check every column it
+* changed is inside the dirty range of its page.
+*
+* Return:	1 if they match, 0 if not (the first difference is printed).
+*/
+static uint8_t _check_case(const char* name) {
+	for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
+		for (uint8_t column = 0; column < OLED_WIDTH; column++) {
+			if (_oled_buffer[page][column] != _expected[page][column]) {
+				printf("%s: page %u column %u is 0x%02X, the old version drew 0x%02X\n", name, page, column,
+					_oled_buffer[page][column], _expected[page][column]);
+				_failed = 1;
+				return 0;
+			}
+			if ((_oled_buffer[page][column] != _before[page][column]) &&
+					((column < _dirtyStart[page]) || (column >= _dirtyEnd[page]))) {
+				printf("%s: page %u column %u changed outside the dirty range %u - %u\n", name, page, column,
+					_dirtyStart[page], _dirtyEnd[page]);
+				_failed = 1;
+				return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+/*
+* _old_set_pixel()
+* ----------------
+* OLED_set_pixel() before the canvas and the clip region, as the old draw functions used it.
+* Off the screen it writes outside the page or the buffer, so the cases keep to the screen.
+*/
+static void _old_set_pixel(uint8_t xCoordinate, uint8_t yCoordinate) {
+	uint8_t page = yCoordinate / 8;
+	uint8_t column = xCoordinate;
+	uint8_t value = 1 << (yCoordinate - (yCoordinate / 8) * 8);
+	if (!(_oled_buffer[page][column] & value)) {
+		_oled_buffer[page][column] |= value;
+		_mark_dirty(page, column, column + 1);
+	}
+}
+
+static void _old_clear_pixel(uint8_t xCoordinate, uint8_t yCoordinate) {
+	uint8_t page = yCoordinate / 8;
+	uint8_t column = xCoordinate;
+	uint8_t value = ~(1 << (yCoordinate - (yCoordinate / 8) * 8));
+	if (_oled_buffer[page][column] & ~value) {
+		_oled_buffer[page][column] &= value;
+		_mark_dirty(page, column, column + 1);
+	}
+}
+
+static uint8_t _old_bitread(uint8_t byte, uint8_t bit) {
+	if (bit > 7) {
+		return 0;
+	}
+
+	uint8_t result = 0x00;
+
+	result |= (byte & (1 << bit)) >> bit;
+	return result;
+}
+
+/*
+**************************************************************
+* OLED_draw_xbm()
+**************************************************************
+*/
+
+/*
+* _old_draw_xbm()
+* ---------------
+* OLED_draw_xbm() before it drew a column byte at a time.
+*/
+static void _old_draw_xbm(uint8_t xPosition, uint8_t yPosition, const uint8_t xbm[], uint8_t width, uint8_t height, uint8_t screenOrientation) {
+	uint8_t originalWidth = width;
+	uint8_t adjustedWidth = width;
+	uint8_t multipleBytes;
+	uint8_t raw_X_calclulation;
+	uint8_t raw_Y_calclulation;
+	uint8_t targetX;
+	uint8_t targetY;
+
+	if (width == 8) {
+		multipleBytes = 0;
+	} else {
+		 multipleBytes = width / 8;
+	}
+
+	if ((width % 8) != 0) {
+		width = ((width / 8 + 1)) * 8;
+	}
+
+	uint8_t trim = 0;
+	for (uint16_t i = 0; i < width * height / 8; i++) {
+		uint8_t byteColumn = pgm_read_byte(&(xbm[i]));
+		if (multipleBytes > 0) {
+			if (trim == multipleBytes) {
+				trim = -1;
+				adjustedWidth = originalWidth - (multipleBytes * 8);
+			} else {
+				adjustedWidth = 8;
+			}
+		}
+		trim++;
+
+		for (uint8_t j = 0; j < adjustedWidth; j++) {
+			if (_old_bitread(byteColumn, j)) {
+				raw_X_calclulation = (i * 8 + j) % width + xPosition;
+				raw_Y_calclulation = (8 * i / (width)) + yPosition;
+
+				if (screenOrientation == 0) {
+					targetX = raw_X_calclulation;
+					targetY = raw_Y_calclulation;
+				} else if (screenOrientation == 1) {
+					targetX = 127 - raw_Y_calclulation;
+					targetY = raw_X_calclulation;
+				} else if (screenOrientation == 2) {
+					targetX = 127 - raw_X_calclulation;
+					targetY = 63 - raw_Y_calclulation;
+				} else if (screenOrientation == 3) {
+					targetX = raw_Y_calclulation;
+					targetY = 63 - raw_X_calclulation;
+				} else {
+					targetX = 0;
+					targetY = 0;
+				}
+				_old_set_pixel(targetX, targetY);
+			}
+		}
+	}
+}
+
+/* XBM glyphs of the fonts in _fonts[], the descriptors of packed fonts do not point at them */
+static const uint8_t* const* const _xbmFonts[] = {FONT_8, FONT_16, FONT_20, FONT_25};
+
+/* Glyph being timed */
+static const uint8_t* _xbm;
+static uint8_t _xbmWidth;
+static uint8_t _xbmHeight;
+static uint8_t _xbmOrientation;
+
+static void _draw_xbm_old(void) {
+	_old_draw_xbm(0, 0, _xbm, _xbmWidth, _xbmHeight, _xbmOrientation);
+}
+
+static void _draw_xbm_new(void) {
+	OLED_draw_xbm(0, 0, _xbm, _xbmWidth, _xbmHeight, _xbmOrientation);
+}
+
+/*
+* _font_glyphs()
+* --------------
+* Return:	The number of glyphs in a font.
+*/
+static uint8_t _font_glyphs(const font_t* font) {
+	if (font->firstSymbol) {
+		return font->symbolIndex + font->lastSymbol - font->firstSymbol + 1;
+	}
+	if (font->remap) {
+		uint8_t glyphs = 0;
+		for (uint8_t i = 0; i <= font->lastChar - font->firstChar; i++) {
+			if ((font->remap[i] != FONT_NO_GLYPH) && (font->remap[i] >= glyphs)) {
+				glyphs = font->remap[i] + 1;
+			}
+		}
+		return glyphs;
+	}
+	return font->lastChar - font->firstChar + 1;
+}
+
+/*
+* _bench_xbm()
+* ------------
+* Draw every glyph of every font in each orientation at random places on the screen with
+* both versions and compare, then time them glyph by glyph.
+* Glyphs a multiple of 8 pixels wide from 16 up are only timed, the old version dropped
+* every third byte of them.
+*/
+static void _bench_xbm() {
+	uint16_t checked = 0;
+	uint16_t skipped = 0;
+
+	printf("OLED_draw_xbm(), host ns per glyph\n");
+	printf("%-6s %-12s %10s %10s %8s\n", "font", "orientation", "before", "after", "speedup");
+	for (uint8_t i = 0; i < sizeof(_fonts) / sizeof(_fonts[0]); i++) {
+		const font_t* font = _fonts[i];
+		uint8_t glyphs = _font_glyphs(font);
+
+		for (uint8_t orientation = 0; orientation < 4; orientation++) {
+			double before = 0;
+			double after = 0;
+
+			for (uint8_t glyph = 0; glyph < glyphs; glyph++) {
+				_xbm = _xbmFonts[i][glyph];
+				_xbmWidth = font->widths[glyph];
+				_xbmHeight = font->height;
+				_xbmOrientation = orientation;
+
+				if (((_xbmWidth % 8) == 0) && (_xbmWidth >= 16)) {
+					skipped++;
+				} else {
+					for (uint8_t place = 0; (place < 4) && !_failed; place++) {
+						uint8_t x = _random(OLED_CANVAS_WIDTH(orientation) - _xbmWidth + 1);
+						uint8_t y = _random(OLED_CANVAS_HEIGHT(orientation) - _xbmHeight + 1);
+
+						_start_case(place & 1);
+						_old_draw_xbm(x, y, _xbm, _xbmWidth, _xbmHeight, orientation);
+						_keep_expected();
+						OLED_draw_xbm(x, y, _xbm, _xbmWidth, _xbmHeight, orientation);
+						checked += _check_case("OLED_draw_xbm()");
+					}
+				}
+				_start_case(0);
+				before += _time_ns(_draw_xbm_old);
+				after += _time_ns(_draw_xbm_new);
+			}
+			printf("%-6u %-12u %10.0f %10.0f %7.1fx\n", font->height, orientation, before / glyphs, after / glyphs, before / after);
+		}
+	}
+	printf("%u glyph draws match the old version, %u glyphs not compared\n\n", checked, skipped);
+}
+
+/*
+**************************************************************
+* OLED_invert_rectangle()
+**************************************************************
+*/
+
+/*
+* _old_invert_rectangle()
+* -----------------------
+* OLED_invert_rectangle() before it worked a page byte at a time. It visits every pixel of
+* the screen, so any coordinates are safe. OLED_invert_horizontal() and
+* OLED_invert_vertical() were the same loop with only the y or the x test.
+*/
+static void _old_invert_rectangle(uint8_t xLeft, uint8_t xRight, uint8_t yTop, uint8_t yBottom) {
+	uint8_t xPos;
+	uint8_t yPos;
+
+	for (uint8_t i = 0; i < OLED_HEIGHT / 8; i++) {
+		for (uint8_t j = 0; j < OLED_WIDTH; j++) {
+			for (uint8_t k = 0; k < 8; k++) {
+				xPos = j;
+				yPos = (i * 8) + k;
+
+				if ((xPos >= xLeft) && (xPos < xRight) && (yPos >= yTop) && (yPos < yBottom)) {
+					if (_old_bitread(_oled_buffer[i][j], k)) {
+						_old_clear_pixel(xPos, yPos);
+					} else {
+						_old_set_pixel(xPos, yPos);
+					}
+				}
+			}
+		}
+	}
+}
+
+/* Region being timed, xLeft, xRight, yTop, yBottom */
+static uint8_t _region[4];
+
+static void _invert_old(void) {
+	_old_invert_rectangle(_region[0], _region[1], _region[2], _region[3]);
+}
+
+static void _invert_new(void) {
+	OLED_invert_rectangle(_region[0], _region[1], _region[2], _region[3]);
+}
+
+static void _invert_horizontal_new(void) {
+	OLED_invert_horizontal(_region[2], _region[3]);
+}
+
+/*
+* _bench_invert()
+* ---------------
+* Invert 300 random rectangles, horizontal bands and vertical bands with both versions over
+* a random buffer and compare, then time the regions the clock inverts.
+* Coordinates go past the edge of the screen and can make empty regions.
+*/
+static void _bench_invert() {
+	uint16_t checked = 0;
+
+	for (uint16_t i = 0; (i < 300) && !_failed; i++) {
+		uint8_t xLeft = _random(OLED_WIDTH + 16);
+		uint8_t xRight = xLeft + _random(OLED_WIDTH + 16 - xLeft);
+		uint8_t yTop = _random(OLED_HEIGHT + 8);
+		uint8_t yBottom = yTop + _random(OLED_HEIGHT + 8 - yTop);
+
+		_start_case(1);
+		_old_invert_rectangle(xLeft, xRight, yTop, yBottom);
+		_keep_expected();
+		OLED_invert_rectangle(xLeft, xRight, yTop, yBottom);
+		checked += _check_case("OLED_invert_rectangle()");
+
+		_start_case(1);
+		_old_invert_rectangle(0, OLED_WIDTH, yTop, yBottom);
+		_keep_expected();
+		OLED_invert_horizontal(yTop, yBottom);
+		checked += _check_case("OLED_invert_horizontal()");
+
+		_start_case(1);
+		_old_invert_rectangle(xLeft, xRight, 0, OLED_HEIGHT);
+		_keep_expected();
+		OLED_invert_vertical(xLeft, xRight);
+		checked += _check_case("OLED_invert_vertical()");
+	}
+
+	printf("OLED_invert_rectangle(), host ns per call\n");
+	printf("%-34s %10s %10s %8s\n", "region", "before", "after", "speedup");
+	static const struct {
+		const char* name;
+		uint8_t region[4];
+		uint8_t horizontal;
+	} regions[] = {
+		{"18x31 digit highlight (Mode A)", {40, 58, 16, 47}, 0},
+		{"128x20 menu bar", {0, 128, 0, 20}, 0},
+		{"invert_horizontal(), 9 rows", {0, 128, 27, 36}, 1}
+	};
+	for (uint8_t i = 0; i < sizeof(regions) / sizeof(regions[0]); i++) {
+		memcpy(_region, regions[i].region, sizeof(_region));
+		_start_case(1);
+		double before = _time_ns(_invert_old);
+		double after = _time_ns(regions[i].horizontal ? _invert_horizontal_new : _invert_new);
+		printf("%-34s %10.0f %10.0f %7.0fx\n", regions[i].name, before, after, before / after);
+	}
+	printf("%u inversions match the old version\n\n", checked);
+}
+
+/*
+**************************************************************
+* OLED_draw_rectangle() and OLED_draw_circle()
+**************************************************************
+*/
+
+/*
+* _old_draw_horizontal_line(), _old_draw_vertical_line(), _old_draw_rectangle(),
+* _old_draw_circle()
+* ------------------------------------------------------------------------------
+* The shape functions before they were span fills with a draw mode. They only set pixels.
+* The right edge of a rectangle is at xPosition + width, as it was.
+*/
+static void _old_draw_horizontal_line(uint8_t xStart, uint8_t xEnd, uint8_t yPosition) {
+	for (uint8_t i = xStart; i < xEnd; i++) {
+		_old_set_pixel(i, yPosition);
+	}
+}
+
+static void _old_draw_vertical_line(uint8_t yStart, uint8_t yEnd, uint8_t xPosition) {
+	for (uint8_t i = yStart; i < yEnd; i++) {
+		_old_set_pixel(xPosition, i);
+	}
+}
+
+static void _old_draw_rectangle(uint8_t xPosition, uint8_t yPosition, uint8_t width, uint8_t height, uint8_t filled) {
+	_old_draw_horizontal_line(xPosition, xPosition + width, yPosition);
+	_old_draw_horizontal_line(xPosition, xPosition + width, yPosition + height - 1);
+
+	_old_draw_vertical_line(yPosition, yPosition + height, xPosition);
+	_old_draw_vertical_line(yPosition, yPosition + height, xPosition + width);
+
+	if (filled) {
+		for (uint8_t i = yPosition + 1; i < yPosition + height - 1; i++) {
+			_old_draw_horizontal_line(xPosition, xPosition + width, i);
+		}
+	}
+}
+
+static void _old_draw_circle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t filled) {
+	int8_t x = radius;
+	int8_t y = 0;
+	int16_t p = 1 - x;
+
+	if (filled) {
+		while (x >= y) {
+			for (uint8_t i = xCenter - x; i <= xCenter + x; i++) {
+				_old_set_pixel(i, yCenter + y);
+				_old_set_pixel(i, yCenter - y);
+			}
+
+			for (uint8_t i = xCenter - y; i <= xCenter + y; i++) {
+				_old_set_pixel(i, yCenter + x);
+				_old_set_pixel(i, yCenter - x);
+			}
+
+			y++;
+			if (p < 0) {
+				p += 2 * y + 1;
+			} else {
+				x--;
+				p += 2 * (y - x) + 1;
+			}
+		}
+	} else {
+		while (x >= y) {
+			_old_set_pixel(xCenter + x, yCenter + y);
+			_old_set_pixel(xCenter + y, yCenter + x);
+			_old_set_pixel(xCenter - y, yCenter + x);
+			_old_set_pixel(xCenter - x, yCenter + y);
+			_old_set_pixel(xCenter - x, yCenter - y);
+			_old_set_pixel(xCenter - y, yCenter - x);
+			_old_set_pixel(xCenter + y, yCenter - x);
+			_old_set_pixel(xCenter + x, yCenter - y);
+
+			y++;
+
+			if (p < 0) {
+				p += 2 * y + 1;
+			} else {
+				x--;
+				p += 2 * (y - x) + 1;
+			}
+		}
+	}
+}
+
+/* Shape being checked or timed */
+static uint8_t _shape;			/* 0 = line, 1 = rectangle, 2 = circle */
+static uint8_t _shapeArgs[4];	/* x, y, width, height or x, y, radius */
+static uint8_t _shapeFilled;
+
+static void _draw_shape_old(void) {
+	if (_shape == 0) {
+		if (_shapeFilled) {
+			_old_draw_vertical_line(_shapeArgs[1], _shapeArgs[1] + _shapeArgs[3], _shapeArgs[0]);
+		} else {
+			_old_draw_horizontal_line(_shapeArgs[0], _shapeArgs[0] + _shapeArgs[2], _shapeArgs[1]);
+		}
+	} else if (_shape == 1) {
+		_old_draw_rectangle(_shapeArgs[0], _shapeArgs[1], _shapeArgs[2], _shapeArgs[3], _shapeFilled);
+	} else {
+		_old_draw_circle(_shapeArgs[0], _shapeArgs[1], _shapeArgs[2], _shapeFilled);
+	}
+}
+
+static void _draw_shape_mode(uint8_t drawMode) {
+	if (_shape == 0) {
+		/* A filled line is a vertical one */
+		if (_shapeFilled) {
+			OLED_draw_vertical_line(_shapeArgs[1], _shapeArgs[1] + _shapeArgs[3], _shapeArgs[0], drawMode);
+		} else {
+			OLED_draw_horizontal_line(_shapeArgs[0], _shapeArgs[0] + _shapeArgs[2], _shapeArgs[1], drawMode);
+		}
+	} else if (_shape == 1) {
+		OLED_draw_rectangle(_shapeArgs[0], _shapeArgs[1], _shapeArgs[2], _shapeArgs[3], _shapeFilled, drawMode);
+	} else {
+		OLED_draw_circle(_shapeArgs[0], _shapeArgs[1], _shapeArgs[2], _shapeFilled, drawMode);
+	}
+}
+
+static void _draw_shape_new(void) {
+	_draw_shape_mode(OLED_DRAW_SET);
+}
+
+/*
+* _check_shape()
+* --------------
+* Draw the current shape with both versions over a random buffer and compare. The pixels the
+* old version sets on a clear buffer are then used to work out what OLED_DRAW_CLEAR and
+* OLED_DRAW_XOR must leave, XOR inverting each pixel once however the spans overlap.
+*
+* Return:	The number of draws that matched.
+*/
+static uint8_t _check_shape(const char* name) {
+	uint8_t shapePixels[OLED_HEIGHT / 8][OLED_WIDTH];
+	uint8_t matched = 0;
+
+	_start_case(0);
+	_draw_shape_old();
+	memcpy(shapePixels, _oled_buffer, sizeof(shapePixels));
+
+	_start_case(1);
+	_draw_shape_old();
+	_keep_expected();
+	_draw_shape_mode(OLED_DRAW_SET);
+	matched += _check_case(name);
+
+	for (uint8_t drawMode = OLED_DRAW_CLEAR; (drawMode <= OLED_DRAW_XOR) && !_failed; drawMode++) {
+		_start_case(1);
+		for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
+			for (uint8_t column = 0; column < OLED_WIDTH; column++) {
+				if (drawMode == OLED_DRAW_CLEAR) {
+					_expected[page][column] = _before[page][column] & ~shapePixels[page][column];
+				} else {
+					_expected[page][column] = _before[page][column] ^ shapePixels[page][column];
+				}
+			}
+		}
+		_draw_shape_mode(drawMode);
+		matched += _check_case(name);
+	}
+	return matched;
+}
+
+/*
+* _bench_shapes()
+* ---------------
+* Check 300 random lines, rectangles and circles of each kind against the old versions, in
+* every draw mode, then time some of the sizes the clock draws. The old versions wrap
+* around off the screen, so the random shapes are kept on it.
+*/
+static void _bench_shapes() {
+	uint16_t checked = 0;
+
+	for (uint16_t i = 0; (i < 300) && !_failed; i++) {
+		_shapeFilled = i & 1;
+
+		_shape = 0;
+		_shapeArgs[0] = _random(OLED_WIDTH);
+		_shapeArgs[1] = _random(OLED_HEIGHT);
+		_shapeArgs[2] = _random(OLED_WIDTH - _shapeArgs[0] + 1);
+		_shapeArgs[3] = _random(OLED_HEIGHT - _shapeArgs[1] + 1);
+		checked += _check_shape(_shapeFilled ? "OLED_draw_vertical_line()" : "OLED_draw_horizontal_line()");
+
+		_shape = 1;
+		_shapeArgs[0] = _random(OLED_WIDTH - 1);
+		_shapeArgs[1] = _random(OLED_HEIGHT - 1);
+		_shapeArgs[2] = 1 + _random(OLED_WIDTH - 1 - _shapeArgs[0]);
+		_shapeArgs[3] = 2 + _random(OLED_HEIGHT - 1 - _shapeArgs[1]);
+		checked += _check_shape("OLED_draw_rectangle()");
+
+		_shape = 2;
+		_shapeArgs[2] = _random(OLED_HEIGHT / 2);
+		_shapeArgs[0] = _shapeArgs[2] + _random(OLED_WIDTH - 2 * _shapeArgs[2]);
+		_shapeArgs[1] = _shapeArgs[2] + _random(OLED_HEIGHT - 2 * _shapeArgs[2]);
+		checked += _check_shape("OLED_draw_circle()");
+	}
+
+	printf("OLED_draw_rectangle(), OLED_draw_circle(), host ns per call\n");
+	printf("%-34s %10s %10s %8s\n", "shape", "before", "after", "speedup");
+	static const struct {
+		const char* name;
+		uint8_t shape;
+		uint8_t args[4];
+		uint8_t filled;
+	} shapes[] = {
+		{"60x40 rectangle", 1, {30, 10, 60, 40}, 0},
+		{"60x40 filled rectangle", 1, {30, 10, 60, 40}, 1},
+		{"128 pixel horizontal line", 0, {0, 20, 128, 0}, 0},
+		{"r=30 circle", 2, {64, 32, 30, 0}, 0},
+		{"r=30 filled circle", 2, {64, 32, 30, 0}, 1}
+	};
+	for (uint8_t i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++) {
+		_shape = shapes[i].shape;
+		memcpy(_shapeArgs, shapes[i].args, sizeof(_shapeArgs));
+		_shapeFilled = shapes[i].filled;
+		_start_case(0);
+		double before = _time_ns(_draw_shape_old);
+		double after = _time_ns(_draw_shape_new);
+		printf("%-34s %10.0f %10.0f %7.1fx\n", shapes[i].name, before, after, before / after);
+	}
+	printf("%u shape draws match the old version\n\n", checked);
+}
+
+int main() {
+	host_panel_reset(0);
+	OLED_init();
+
+	_bench_xbm();
+	_bench_invert();
+	_bench_shapes();
+
+	if (_failed) {
+		printf("FAILED\n");
+	}
+	return _failed;
+}
@@ -0,0 +1,59 @@
+/*
+ **************************************************************
+ * host_oled.h
+ * Host stand-in for the TWI hardware and the SH1106 panel, so
+ * the SH1106 library and the real i2c code can be built and
+ * checked with the host compiler. Built and run by
+ * tools/oled_host_test.py.
+ **************************************************************
+ * EXTERNAL FUNCTIONS
+ **************************************************************
+ * host_panel_reset() - Fill the panel RAM with a pattern and
+ * zero the bus counters.
+ * host_panel_start() - The panel's address was acknowledged.
+ * host_panel_byte() - Apply a byte sent to the panel.
+ * host_i2c_hold() - Hold TWI interrupts back for
+ * host_i2c_pump().
+ * host_i2c_pump() - Run one held TWI interrupt.
+ * host_i2c_drain() - Stop holding TWI interrupts and run them.
+ **************************************************************
+*/
+
+#ifndef HOST_OLED_H_
+#define HOST_OLED_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* SH1106 RAM is 132 columns by 8 pages, the library's buffer starts at OLED_COLUMN_OFFSET */
+#define HOST_PANEL_COLUMNS	132
+#define HOST_PANEL_PAGES	8
+
+/* Panel RAM as written by the library over the bus */
+extern uint8_t host_panel[HOST_PANEL_PAGES][HOST_PANEL_COLUMNS];
+extern uint8_t host_panel_start_line;
+
+/* Number of times the panel will not acknowledge its address, as if it were busy */
+extern uint8_t host_panel_busy;
+
+/* Bus counters since the last host_panel_reset() */
+extern uint32_t host_transactions;	/* Addresses sent after a start condition */
+extern uint32_t host_bus_bytes;		/* Bytes sent or read, addresses included */
+extern uint32_t host_data_bytes;	/* Pixel bytes written to the panel RAM */
+
+void host_panel_reset(uint8_t pattern);
+void host_panel_start(void);
+void host_panel_byte(uint8_t byte);
+
+void host_i2c_hold(void);
+uint8_t host_i2c_pump(void);
+void host_i2c_drain(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_OLED_H_ */
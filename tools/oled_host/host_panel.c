@@ -0,0 +1,107 @@
+/*
+ **************************************************************
+ * host_panel.c
+ * Model of the SH1106 panel RAM for the host harness. The TWI
+ * model in host_twi.cpp hands it each transaction to the
+ * panel's address a byte at a time, as the real i2c code puts
+ * them on the bus. The first byte of a transaction is a control
+ * byte that selects commands or pixel data for the bytes after
+ * it.
+ **************************************************************
+*/
+
+#include <string.h>
+
+#include "host_oled.h"
+
+#define HOST_DATA_MODE		0x40
+#define HOST_CONTINUATION	0x80	/* Another control byte follows the next byte */
+
+uint8_t host_panel[HOST_PANEL_PAGES][HOST_PANEL_COLUMNS];
+uint8_t host_panel_start_line;
+uint8_t host_panel_busy;
+uint32_t host_transactions;
+uint32_t host_bus_bytes;
+uint32_t host_data_bytes;
+
+static uint8_t _page;
+static uint8_t _column;
+static uint8_t _argumentsLeft;	/* Argument bytes still to come for the last command */
+static uint8_t _control;		/* Control byte of the transaction, 0 until it has been sent */
+static uint8_t _controlNext;	/* The next byte is a control byte */
+
+/* Private function prototypes */
+static void _panel_command(uint8_t command);
+
+/*
+* host_panel_reset()
+* ------------------
+* Fill the panel RAM with a pattern, as the SH1106 RAM is random at power up, and zero the
+* bus counters.
+*/
+void host_panel_reset(uint8_t pattern) {
+	memset(host_panel, pattern, sizeof(host_panel));
+	host_panel_start_line = 0;
+	host_panel_busy = 0;
+	host_transactions = 0;
+	host_bus_bytes = 0;
+	host_data_bytes = 0;
+	_page = 0;
+	_column = 0;
+	_argumentsLeft = 0;
+}
+
+/*
+* host_panel_start()
+* ------------------
+* The panel's address has been acknowledged, a control byte comes next.
+*/
+void host_panel_start() {
+	_controlNext = 1;
+}
+
+/*
+* host_panel_byte()
+* -----------------
+* Apply one byte sent to the panel after its address.
+*/
+void host_panel_byte(uint8_t byte) {
+	if (_controlNext) {
+		_control = byte;
+		_controlNext = 0;
+		return;
+	}
+	if (_control & HOST_DATA_MODE) {
+		/* The column address stops moving at the end of the RAM */
+		if (_column < HOST_PANEL_COLUMNS) {
+			host_panel[_page][_column++] = byte;
+		}
+		host_data_bytes++;
+	} else {
+		_panel_command(byte);
+	}
+	_controlNext = (_control & HOST_CONTINUATION) ? 1 : 0;
+}
+
+/*
+* _panel_command()
+* ----------------
+* Private function to apply one command byte. Only the addressing commands change the model,
+* the argument bytes of the two byte commands in OLED_init() are skipped.
+*/
+static void _panel_command(uint8_t command) {
+	if (_argumentsLeft) {
+		_argumentsLeft--;
+	} else if ((command & 0xF0) == 0xB0) {
+		_page = command & 0x07;
+	} else if ((command & 0xF0) == 0x00) {
+		_column = (_column & 0xF0) | (command & 0x0F);
+	} else if ((command & 0xF0) == 0x10) {
+		_column = (_column & 0x0F) | ((command & 0x0F) << 4);
+	} else if ((command & 0xC0) == 0x40) {
+		host_panel_start_line = command & 0x3F;
+	} else if ((command == 0x81) || (command == 0xA8) || (command == 0xAD) || (command == 0xD3) ||
+			(command == 0xD5) || (command == 0xD9) || (command == 0xDA) || (command == 0xDB)) {
+		_argumentsLeft = 1;
+	}
+}
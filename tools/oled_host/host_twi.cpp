@@ -0,0 +1,258 @@
+/*
+ **************************************************************
+ * host_twi.cpp
+ * Host model of the ATmega328p TWI hardware that runs the real
+ * pFleury_i2c_stuff/twimastertimeout.c, so the harness sends
+ * frames through the same queue, TWI interrupt and blocking
+ * code as the firmware. The i2c code is built in here as C++
+ * so its writes to TWCR and SREG can be caught:
+ *	-	A TWCR write with TWINT set does the bus operation
+ *		straight away and sets TWINT again when it is done.
+ *	-	The TWI interrupt runs as soon as TWINT, TWIE and the
+ *		I bit of SREG are all set, unless the test is holding
+ *		it back to run it a step at a time.
+ * Bytes sent to the SH1106 address go to the panel model in
+ * host_panel.c, no other device acknowledges its address.
+ **************************************************************
+*/
+
+#include <stdint.h>
+
+#include <avr/io.h>
+#include <compat/twi.h>
+
+#include "host_oled.h"
+
+#define HOST_PANEL_ADDRESS 0x3C
+
+/* Bus state after the last operation */
+#define HOST_BUS_IDLE		0	/* Stop condition sent, or the TWI is off */
+#define HOST_BUS_ADDRESS	1	/* Start condition sent, the address comes next */
+#define HOST_BUS_PANEL		2	/* Panel addressed to write */
+#define HOST_BUS_IGNORED	3	/* Address not acknowledged, or a read the panel cannot do */
+
+extern "C" {
+	volatile uint8_t SREG = (1 << SREG_I);
+}
+
+/*
+* A TWI or PORTC register. Reads give the value, writes go through the register's write
+* function when it has one. The masks are int as the firmware writes them, eg. ~(1 << TWEN).
+*/
+struct HostRegister {
+	volatile uint8_t value;
+	void (*write)(HostRegister& reg, uint8_t value);
+
+	operator uint8_t() const { return value; }
+	HostRegister& operator=(uint8_t newValue) {
+		if (write) {
+			write(*this, newValue);
+		} else {
+			value = newValue;
+		}
+		return *this;
+	}
+	HostRegister& operator|=(int bits) { return *this = (uint8_t)(value | bits); }
+	HostRegister& operator&=(int bits) { return *this = (uint8_t)(value & bits); }
+};
+
+/* SREG as the i2c code sees it, turning the I bit on lets a waiting TWI interrupt run */
+struct HostStatus {
+	operator uint8_t() const { return SREG; }
+	HostStatus& operator=(uint8_t newValue);
+	HostStatus& operator|=(int bits) { return *this = (uint8_t)(SREG | bits); }
+	HostStatus& operator&=(int bits) { return *this = (uint8_t)(SREG & bits); }
+};
+
+static void _twcr_write(HostRegister& reg, uint8_t value);
+static void _run_interrupts(void);
+
+static HostRegister _twcr = {0, _twcr_write};
+static HostRegister _twsr = {TW_NO_INFO, 0};
+static HostRegister _twdr = {0xFF, 0};
+static HostRegister _twbr = {0, 0};
+static HostRegister _portc = {0, 0};
+static HostRegister _ddrc = {0, 0};
+static HostRegister _pinc = {(1 << PC4) | (1 << PC5), 0};	/* Both lines released by the devices */
+static HostStatus _sreg;
+
+static uint8_t _busState = HOST_BUS_IDLE;
+static uint8_t _held;			/* TWI interrupts wait for host_i2c_pump() */
+static uint8_t _inInterrupt;
+static uint32_t _timeUs;
+
+HostStatus& HostStatus::operator=(uint8_t newValue) {
+	SREG = newValue;
+	_run_interrupts();
+	return *this;
+}
+
+/* The real i2c code, on the registers above */
+#define TWCR _twcr
+#define TWSR _twsr
+#define TWDR _twdr
+#define TWBR _twbr
+#define PORTC _portc
+#define DDRC _ddrc
+#define PINC _pinc
+#undef SREG
+#define SREG _sreg
+
+extern "C" {
+#include "pFleury_i2c_stuff/twimastertimeout.c"
+}
+
+#undef SREG
+
+/*
+* timer0_get_current_time_us()
+* ----------------------------
+* Stand-in for the timer0 clock. There is no real time on the host, each read moves the clock
+* on 10us, so a wait that never ends still times out.
+*/
+extern "C" uint32_t timer0_get_current_time_us(void) {
+	_timeUs += 10;
+	return _timeUs;
+}
+
+/*
+* _address()
+* ----------
+* Private function to send the address in TWDR after a start condition. Returns the TWI status.
+*/
+static uint8_t _address(uint8_t address) {
+	host_transactions++;
+	host_bus_bytes++;
+	if (((address >> 1) != HOST_PANEL_ADDRESS) || host_panel_busy) {
+		if ((address >> 1) == HOST_PANEL_ADDRESS) {
+			host_panel_busy--;
+		}
+		_busState = HOST_BUS_IGNORED;
+		return (address & I2C_READ) ? TW_MR_SLA_NACK : TW_MT_SLA_NACK;
+	}
+	if (address & I2C_READ) {
+		/* Acknowledged, but nothing in the library reads the panel, it reads as 0xFF */
+		_busState = HOST_BUS_IGNORED;
+		return TW_MR_SLA_ACK;
+	}
+	host_panel_start();
+	_busState = HOST_BUS_PANEL;
+	return TW_MT_SLA_ACK;
+}
+
+/*
+* _twcr_write()
+* -------------
+* Private function to do what a write to TWCR does on the AVR. Writing TWINT as 1 clears the
+* flag and starts the next operation, which is done here straight away, then the flag is set
+* again. A stop condition on its own leaves the flag clear and TWSTO clears itself once it has
+* been sent.
+*/
+static void _twcr_write(HostRegister& reg, uint8_t value) {
+	uint8_t done = 1;
+
+	if (!(value & (1 << TWEN))) {
+		/* The TWI is off and the pins are PORTC again */
+		reg.value = value & ~(1 << TWINT);
+		_busState = HOST_BUS_IDLE;
+		return;
+	}
+	if (!(value & (1 << TWINT))) {
+		/* Writing TWINT as 0 leaves the flag alone */
+		reg.value = (reg.value & (1 << TWINT)) | value;
+		return;
+	}
+
+	if (value & (1 << TWSTO)) {
+		_busState = HOST_BUS_IDLE;
+	}
+	if (value & (1 << TWSTA)) {
+		_twsr.value = (_busState == HOST_BUS_IDLE) ? TW_START : TW_REP_START;
+		_busState = HOST_BUS_ADDRESS;
+	} else if (value & (1 << TWSTO)) {
+		done = 0;
+	} else if (_busState == HOST_BUS_ADDRESS) {
+		_twsr.value = _address(_twdr.value);
+	} else if (_busState == HOST_BUS_PANEL) {
+		host_bus_bytes++;
+		host_panel_byte(_twdr.value);
+		_twsr.value = TW_MT_DATA_ACK;
+	} else if ((_busState == HOST_BUS_IGNORED) && (_twsr.value == TW_MR_SLA_ACK || _twsr.value == TW_MR_DATA_ACK)) {
+		host_bus_bytes++;
+		_twdr.value = 0xFF;
+		_twsr.value = (value & (1 << TWEA)) ? TW_MR_DATA_ACK : TW_MR_DATA_NACK;
+	} else {
+		done = 0;
+	}
+
+	reg.value = (value & ~((1 << TWINT) | (1 << TWSTO))) | (done ? (1 << TWINT) : 0);
+	_run_interrupts();
+}
+
+/*
+* _interrupt_waiting()
+* --------------------
+* Private function, returns 1 if the TWI interrupt is enabled and its flag is set.
+*/
+static uint8_t _interrupt_waiting(void) {
+	return (_twcr.value & (1 << TWIE)) && (_twcr.value & (1 << TWINT));
+}
+
+/*
+* _run_interrupt()
+* ----------------
+* Private function to run the TWI interrupt once, with the I bit clear as on the AVR.
+*/
+static void _run_interrupt(void) {
+	_inInterrupt = 1;
+	SREG &= ~(1 << SREG_I);
+	TWI_vect();
+	SREG |= (1 << SREG_I);
+	_inInterrupt = 0;
+}
+
+/*
+* _run_interrupts()
+* -----------------
+* Private function to run the TWI interrupt for as long as it is waiting and not held back.
+* The interrupt does not run inside itself, the operations it starts are picked up by the loop.
+*/
+static void _run_interrupts(void) {
+	while (!_inInterrupt && !_held && (SREG & (1 << SREG_I)) && _interrupt_waiting()) {
+		_run_interrupt();
+	}
+}
+
+/*
+* host_i2c_hold()
+* ---------------
+* Hold TWI interrupts back until host_i2c_drain(), so the test can run them one at a time with
+* host_i2c_pump() and draw part way through a transfer. Nothing may wait for the bus while they
+* are held, the wait would time out.
+*/
+extern "C" void host_i2c_hold(void) {
+	_held = 1;
+}
+
+/*
+* host_i2c_pump()
+* ---------------
+* Run one held TWI interrupt. Returns 1 if the interrupt was waiting, 0 if not.
+*/
+extern "C" uint8_t host_i2c_pump(void) {
+	if (!_interrupt_waiting()) {
+		return 0;
+	}
+	_run_interrupt();
+	return 1;
+}
+
+/*
+* host_i2c_drain()
+* ----------------
+* Stop holding TWI interrupts back and run them until the bus is idle.
+*/
+extern "C" void host_i2c_drain(void) {
+	_held = 0;
+	_run_interrupts();
+}
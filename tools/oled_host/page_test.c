@@ -0,0 +1,155 @@
+/*
+ **************************************************************
+ * page_test.c
+ * Draws random frames with the SH1106 library and adds up a
+ * checksum of the panel RAM after each one. Built with
+ * OLED_PAGE_RENDERER, where each frame is drawn with
+ * OLED_render() a strip at a time, and without it, where the
+ * same frame is drawn into the full buffer and sent with
+ * OLED_display_buffer(). tools/oled_host_test.py checks every
+ * build ends with the same checksum.
+ **************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host_oled.h"
+
+/* Built in so the test draws with the same private state as the shadow test */
+#include "SH1106_OLED/SH1106.c"
+
+#define FRAMES 500
+
+static uint32_t _seed = 1;
+static uint32_t _frameSeed;	/* Seed the frame being drawn starts from, every strip draws the same frame */
+static uint8_t _draws;		/* Times _draw_frame() has been called for the current frame */
+
+/*
+* _random()
+* ---------
+* xorshift32, so every build draws the same frames.
+*/
+static uint32_t _random(uint32_t range) {
+	_seed ^= _seed << 13;
+	_seed ^= _seed >> 17;
+	_seed ^= _seed << 5;
+	return _seed % range;
+}
+
+/*
+* _draw_something()
+* -----------------
+* Draw one random primitive.
+*/
+static void _draw_something() {
+	char digits[4];
+	uint8_t x = _random(OLED_WIDTH);
+	uint8_t y = _random(OLED_HEIGHT);
+	uint8_t drawMode = _random(3);
+
+	switch (_random(8)) {
+	case 0:
+		snprintf(digits, sizeof(digits), "%u", (unsigned)_random(1000));
+		OLED_draw_string(digits, x / 2, y / 2, (_random(2) ? 8 : 16), _random(3), _random(4));
+		break;
+	case 1:
+		snprintf(digits, sizeof(digits), "%02u", (unsigned)_random(60));
+		OLED_draw_string(digits, x / 2, y / 2, (_random(2) ? 20 : 25), 2, _random(4));
+		break;
+	case 2:
+		OLED_draw_rectangle(x, y, 1 + _random(OLED_WIDTH - x), 1 + _random(OLED_HEIGHT - y), _random(2), drawMode);
+		break;
+	case 3:
+		OLED_draw_circle(x, y, _random(32), _random(2), drawMode);
+		break;
+	case 4:
+		OLED_invert_rectangle(x, x + _random(OLED_WIDTH - x), y, y + _random(OLED_HEIGHT - y));
+		break;
+	case 5:
+		OLED_clear_rectangle(x, x + _random(OLED_WIDTH - x), y, y + _random(OLED_HEIGHT - y));
+		break;
+	case 6:
+		OLED_draw_vertical_line(y / 2, y / 2 + _random(OLED_HEIGHT - y / 2), x, drawMode);
+		break;
+	default:
+		if (drawMode == OLED_DRAW_CLEAR) {
+			OLED_clear_pixel(x, y);
+		} else {
+			OLED_set_pixel(x, y);
+		}
+		break;
+	}
+}
+
+/*
+* _draw_frame()
+* -------------
+* Draw the frame for _frameSeed, sometimes turned or inside a clip region. The random numbers
+* start from the same seed every call, so each strip of the page renderer sees the same frame.
+*/
+static void _draw_frame() {
+	_seed = _frameSeed;
+	_draws++;
+
+	if (_random(4) == 0) {
+		uint8_t x = _random(OLED_WIDTH);
+		uint8_t y = _random(OLED_HEIGHT);
+
+		OLED_set_clip(x, x + _random(OLED_WIDTH - x + 1), y, y + _random(OLED_HEIGHT - y + 1));
+	}
+	if (_random(4) == 0) {
+		OLED_set_canvas(_random(4));
+	}
+	for (uint8_t i = 1 + _random(8); i > 0; i--) {
+		_draw_something();
+	}
+	OLED_set_canvas(OLED_CLOCKWISE_0);
+	OLED_reset_clip();
+}
+
+/*
+* _panel_checksum()
+* -----------------
+* FNV-1a of the visible panel RAM, added to the checksum of the frames before it.
+*/
+static uint32_t _panel_checksum(uint32_t checksum) {
+	for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
+		for (uint8_t column = 0; column < OLED_WIDTH; column++) {
+			checksum = (checksum ^ host_panel[page][column + OLED_COLUMN_OFFSET]) * 16777619UL;
+		}
+	}
+	return checksum;
+}
+
+int main() {
+	uint32_t checksum = 2166136261UL;
+	uint8_t failed = 0;
+
+	host_panel_reset(0xA5);
+	OLED_init();
+	host_data_bytes = 0;
+
+	for (uint16_t frame = 1; (frame <= FRAMES) && !failed; frame++) {
+		_frameSeed = 0x9E3779B9UL * frame;
+		_draws = 0;
+
+		#ifdef OLED_PAGE_RENDERER
+			OLED_render(_draw_frame);
+			if (_draws != (OLED_HEIGHT / 8) / OLED_STRIP_PAGES) {
+				printf("frame %u: drawn %u times, one for each of the %u strips expected\n", frame, _draws,
+					(OLED_HEIGHT / 8) / OLED_STRIP_PAGES);
+				failed = 1;
+			}
+		#else
+			OLED_clear_buffer();
+			_draw_frame();
+			OLED_display_buffer();
+		#endif /* OLED_PAGE_RENDERER */
+		checksum = _panel_checksum(checksum);
+	}
+
+	printf("%s: %u frames, panel checksum %08lX, %lu pixel bytes\n", (failed ? "FAILED" : "ok"), FRAMES,
+		(unsigned long)checksum, (unsigned long)host_data_bytes);
+	return failed;
+}
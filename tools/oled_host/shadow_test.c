@@ -0,0 +1,189 @@
+/*
+ **************************************************************
+ * shadow_test.c
+ * Draws random frames with the SH1106 library and checks the
+ * panel RAM the library writes over the bus matches its buffer
+ * after every flush. Built with and without OLED_SHADOW_BUFFER
+ * and with different OLED_SHADOW_RUN_GAP values by
+ * tools/oled_host_test.py, so the frame diff is checked
+ * against the same panel state a full flush would leave.
+ * Flushes are blocking, interrupt driven, or interrupt driven
+ * with more drawing done part way through, all of them through
+ * the real i2c code on the TWI model in host_twi.cpp. Some of
+ * the blocking flushes start with the panel busy, not
+ * acknowledging its address, which they must wait out.
+ **************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host_oled.h"
+
+/* Built in so the test can read the buffer and the shadow */
+#include "SH1106_OLED/SH1106.c"
+
+#define FRAMES 2000
+
+static uint32_t _seed = 1;
+static uint8_t _failed;
+static uint16_t _callbacks;
+
+/*
+* _random()
+* ---------
+* xorshift32, so every host draws the same frames.
+*/
+static uint32_t _random(uint32_t range) {
+	_seed ^= _seed << 13;
+	_seed ^= _seed >> 17;
+	_seed ^= _seed << 5;
+	return _seed % range;
+}
+
+static void _flush_done(void) {
+	_callbacks++;
+}
+
+/*
+* _draw_something()
+* -----------------
+* Draw one random primitive into the buffer.
+*/
+static void _draw_something() {
+	char digits[4];
+	uint8_t x = _random(OLED_WIDTH);
+	uint8_t y = _random(OLED_HEIGHT);
+	uint8_t drawMode = _random(3);
+
+	switch (_random(7)) {
+	case 0:
+		snprintf(digits, sizeof(digits), "%u", (unsigned)_random(1000));
+		OLED_draw_string(digits, x / 2, y / 2, (_random(2) ? 8 : 16), _random(3), _random(4));
+		break;
+	case 1:
+		snprintf(digits, sizeof(digits), "%02u", (unsigned)_random(60));
+		OLED_draw_string(digits, x / 2, y / 2, (_random(2) ? 20 : 25), 2, _random(4));
+		break;
+	case 2:
+		OLED_draw_rectangle(x, y, 1 + _random(OLED_WIDTH - x), 1 + _random(OLED_HEIGHT - y), _random(2), drawMode);
+		break;
+	case 3:
+		OLED_draw_circle(x, y, _random(32), _random(2), drawMode);
+		break;
+	case 4:
+		OLED_invert_rectangle(x, x + _random(OLED_WIDTH - x), y, y + _random(OLED_HEIGHT - y));
+		break;
+	case 5:
+		OLED_clear_rectangle(x, x + _random(OLED_WIDTH - x), y, y + _random(OLED_HEIGHT - y));
+		break;
+	default:
+		if (drawMode == OLED_DRAW_CLEAR) {
+			OLED_clear_pixel(x, y);
+		} else {
+			OLED_set_pixel(x, y);
+		}
+		break;
+	}
+}
+
+/*
+* _check_panel()
+* --------------
+* Compare the visible panel RAM with the buffer, and the shadow when there is one.
+*/
+static void _check_panel(uint16_t frame) {
+	if (_failed) {
+		return;
+	}
+	for (uint8_t page = 0; page < OLED_HEIGHT / 8; page++) {
+		for (uint8_t column = 0; column < OLED_WIDTH; column++) {
+			uint8_t expected = _oled_buffer[page][column];
+
+			if (host_panel[page][column + OLED_COLUMN_OFFSET] != expected) {
+				printf("frame %u: panel page %u column %u is 0x%02X, buffer has 0x%02X\n", frame, page, column,
+					host_panel[page][column + OLED_COLUMN_OFFSET], expected);
+				_failed = 1;
+				return;
+			}
+			#ifdef OLED_SHADOW_BUFFER
+				if (_oled_shadow[page][column] != expected) {
+					printf("frame %u: shadow page %u column %u is 0x%02X, buffer has 0x%02X\n", frame, page, column,
+						_oled_shadow[page][column], expected);
+					_failed = 1;
+					return;
+				}
+			#endif /* OLED_SHADOW_BUFFER */
+		}
+	}
+}
+
+int main() {
+	uint16_t asyncFlushes = 0;
+	uint16_t busyFlushes = 0;	/* Blocking flushes that found the panel busy */
+	uint8_t busy;
+
+	/* OLED_init() must overwrite the random power up RAM */
+	host_panel_reset(0xA5);
+	OLED_init();
+	_check_panel(0);
+	host_transactions = 0;
+	host_data_bytes = 0;
+
+	for (uint16_t frame = 1; (frame <= FRAMES) && !_failed; frame++) {
+		if (_random(4) == 0) {
+			OLED_clear_buffer();
+		}
+		for (uint8_t i = _random(6); i > 0; i--) {
+			_draw_something();
+		}
+
+		switch (_random(3)) {
+		case 0:
+			/* A blocking flush polls the panel while it does not acknowledge its address */
+			busy = (_random(4) == 0);
+			if (busy) {
+				host_panel_busy = 1 + _random(3);
+			}
+			OLED_display_buffer();
+			if (busy && !host_panel_busy) {
+				busyFlushes++;
+			}
+			host_panel_busy = 0;
+			break;
+		case 1:
+			host_i2c_hold();
+			OLED_display_buffer_async(_flush_done);
+			asyncFlushes++;
+			host_i2c_drain();
+			break;
+		default:
+			/* Draw while the flush is part way through, the next flush must send it */
+			host_i2c_hold();
+			OLED_display_buffer_async(_flush_done);
+			asyncFlushes++;
+			for (uint16_t i = _random(1200); (i > 0) && host_i2c_pump(); i--);
+			for (uint8_t i = 1 + _random(3); i > 0; i--) {
+				_draw_something();
+			}
+			host_i2c_drain();
+			OLED_display_buffer();
+			break;
+		}
+		if (OLED_flush_busy()) {
+			printf("frame %u: the flush is still busy with the queue empty\n", frame);
+			_failed = 1;
+		}
+		_check_panel(frame);
+	}
+	if (_callbacks != asyncFlushes) {
+		printf("%u interrupt driven flushes but %u callbacks\n", asyncFlushes, _callbacks);
+		_failed = 1;
+	}
+
+	printf("%s: %u frames, %lu pixel bytes (%lu a frame, a full frame is %u), %lu transactions, %u flushes to a busy panel\n",
+		(_failed ? "FAILED" : "ok"), FRAMES, (unsigned long)host_data_bytes,
+		(unsigned long)(host_data_bytes / FRAMES), OLED_WIDTH * OLED_HEIGHT / 8,
+		(unsigned long)host_transactions, busyFlushes);
+	return _failed;
+}
@@ -0,0 +1,11 @@
+/*
+ * Host stand-in for <util/atomic.h>, the body of an ATOMIC_BLOCK runs once.
+ */
+#ifndef HOST_UTIL_ATOMIC_H_
+#define HOST_UTIL_ATOMIC_H_
+
+#define ATOMIC_RESTORESTATE 0
+#define ATOMIC_FORCEON 0
+#define ATOMIC_BLOCK(type) for (uint8_t _atomicOnce = 1; _atomicOnce; _atomicOnce = 0)
+
+#endif /* HOST_UTIL_ATOMIC_H_ */
@@ -0,0 +1,11 @@
+/*
+ * Host stand-in for <util/delay.h>. Time on the host is the simulated timer0 clock in
+ * host_twi.cpp, the delays only hold the bus lines for the bus recovery.
+ */
+#ifndef HOST_UTIL_DELAY_H_
+#define HOST_UTIL_DELAY_H_
+
+#define _delay_us(us) ((void)0)
+#define _delay_ms(ms) ((void)0)
+
+#endif /* HOST_UTIL_DELAY_H_ */
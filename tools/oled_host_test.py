@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""
+Build the SH1106 library and the i2c code with the host compilers and run the checks in tools/oled_host.
+
+The library is built against tools/oled_host, which has host stand-ins for the AVR headers
+and a model of the TWI hardware (host_twi.cpp) that runs the real twimastertimeout.c, built
+in as C++ so its register writes can be caught. Bytes sent to the SH1106 go to a model of the
+panel RAM (host_panel.c). Everything is built with -Wall -Wextra -Werror. Each check is one C
+program that includes SH1106.c so it can look at the buffer:
+
+    shadow		shadow_test.c draws random frames and flushes them blocking, interrupt driven,
+				and interrupt driven with more drawing part way through. Some blocking flushes
+				start with the panel not acknowledging its address for a few tries, which
+				i2c_write_regs() must wait out. After every flush the panel RAM must match the
+				buffer. It is built without OLED_SHADOW_BUFFER and
+				with it at each --gaps value of OLED_SHADOW_RUN_GAP, and prints the pixel
+				bytes and transactions each build sent for the same frames.
+    page		page_test.c draws random frames, some of them turned or clipped, and adds up a
+				checksum of the panel RAM after each. It is built without OLED_PAGE_RENDERER,
+				drawing into the full buffer, and with it at each --strips value of
+				OLED_STRIP_PAGES, drawing with OLED_render(). Every build must end with the
+				same checksum. OLED_PAGE_RENDERER is a library option, the firmware does not
+				build with it.
+    bench		draw_bench.c times draw functions against the pixel at a time versions they
+				replaced, copied into it from the history of SH1106.c, and checks both leave
+				the same pixels in the buffer and the new one marks every column it changes
+				as dirty:
+					xbm		OLED_draw_xbm(), every glyph of every font in each orientation
+					invert	OLED_invert_rectangle(), _horizontal() and _vertical(), 300
+							random regions over a random buffer each
+					shapes	OLED_draw_rectangle(), OLED_draw_circle() and the lines, 300
+							random shapes of each kind in every draw mode
+
+The TWI model does each bus operation at once, so this checks what the library and the i2c
+code send, not the timing on the bus.
+
+The bench times are host nanoseconds for a build at -O2, the fastest of 5 runs of 2000
+calls. They are not AVR cycles and the speedups do not carry over exactly: the host has a
+hardware divide, 64-bit registers and caches, while on the ATmega328p the per-pixel 16-bit
+divide and modulo of the old versions are library calls of around 200 cycles each and every
+byte is a load and store through an 8-bit ALU. Use them to compare versions on the same
+machine. For cycles, time the same calls on the clock with timer1 at F_CPU (TCCR1B = 1).
+
+Usage (from the repository root):
+    python3 tools/oled_host_test.py shadow
+    python3 tools/oled_host_test.py shadow --gaps 0,2,6,32
+    python3 tools/oled_host_test.py page
+    python3 tools/oled_host_test.py bench
+    CC=clang CXX=clang++ python3 tools/oled_host_test.py shadow
+"""
+
+import argparse
+import glob
+import os
+import subprocess
+import sys
+import tempfile
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+HOST_DIR = os.path.join(TOOLS_DIR, "oled_host")
+CODE_DIR = os.path.join(os.path.dirname(TOOLS_DIR), "code")
+FONT_SOURCES = sorted(glob.glob(os.path.join(CODE_DIR, "SH1106_OLED", "XBM_fonts", "*.c")))
+
+I2C_SOURCE = os.path.join(HOST_DIR, "host_twi.cpp")
+PANEL_SOURCE = os.path.join(HOST_DIR, "host_panel.c")
+
+WARNINGS = ["-Wall", "-Wextra", "-Werror"]
+# pgm_read_word() in the host avr/pgmspace.h reads pointer tables through a cast
+CFLAGS = ["-std=gnu99", "-O2", "-fno-strict-aliasing"] + WARNINGS
+CXXFLAGS = ["-O2"] + WARNINGS
+
+
+def build_and_run(source, defines, workDir):
+	"""Build one check with the defines and run it. Return (passed, output)."""
+	includes = ["-I" + HOST_DIR, "-I" + CODE_DIR] + ["-D" + define for define in defines]
+	compiler = os.environ.get("CC", "cc")
+	cxxCompiler = os.environ.get("CXX", "c++")
+	program = os.path.join(workDir, "check")
+	objects = []
+	commands = []
+
+	for path in [os.path.join(HOST_DIR, source), PANEL_SOURCE, I2C_SOURCE] + FONT_SOURCES:
+		objects.append(os.path.join(workDir, "%d.o" % len(objects)))
+		if path.endswith(".cpp"):
+			commands.append([cxxCompiler] + CXXFLAGS + includes + ["-c", "-o", objects[-1], path])
+		else:
+			commands.append([compiler] + CFLAGS + includes + ["-c", "-o", objects[-1], path])
+	commands.append([cxxCompiler, "-o", program] + objects)
+
+	for command in commands:
+		build = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+		if build.returncode != 0:
+			return False, "build failed:\n" + build.stdout
+	run = subprocess.run([program], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+	return run.returncode == 0, run.stdout.strip()
+
+
+def run_builds(source, builds):
+	"""Run a check once for each (label, defines) build. Return the number that failed."""
+	failed = 0
+	with tempfile.TemporaryDirectory() as workDir:
+		for label, defines in builds:
+			passed, output = build_and_run(source, defines, workDir)
+			lines = output.splitlines() or [""]
+			print("%-24s %s" % (label, lines[0]))
+			for line in lines[1:]:
+				print((" " * 25 + line) if line else "")
+			failed += not passed
+	return failed
+
+
+def command_shadow(args):
+	builds = [("no shadow", [])]
+	for gap in args.gaps:
+		builds.append(("shadow, run gap %d" % gap, ["OLED_SHADOW_BUFFER", "OLED_SHADOW_RUN_GAP=%d" % gap]))
+	return run_builds("shadow_test.c", builds)
+
+
+def command_page(args):
+	builds = [("full buffer", [])]
+	for strip in args.strips:
+		builds.append(("page renderer, %d page%s" % (strip, "" if strip == 1 else "s"),
+			["OLED_PAGE_RENDERER", "OLED_STRIP_PAGES=%d" % strip]))
+	failed = 0
+	checksums = set()
+	with tempfile.TemporaryDirectory() as workDir:
+		for label, defines in builds:
+			passed, output = build_and_run("page_test.c", defines, workDir)
+			print("%-24s %s" % (label, output))
+			failed += not passed
+			if passed:
+				checksums.add(output.split("checksum ")[1].split(",")[0])
+	if len(checksums) > 1:
+		print("the builds left different frames on the panel")
+		failed += 1
+	return failed
+
+
+def command_bench(args):
+	return run_builds("draw_bench.c", [("bench", [])])
+
+
+def gap_list(text):
+	try:
+		return [int(gap) for gap in text.split(",")]
+	except ValueError:
+		raise argparse.ArgumentTypeError("expected a comma separated list of numbers")
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+	commands = parser.add_subparsers(dest="command", required=True)
+
+	shadow = commands.add_parser("shadow", help="check the frame diff leaves the panel RAM matching the buffer")
+	shadow.add_argument("--gaps", type=gap_list, default=[0, 1, 6, 32], help="OLED_SHADOW_RUN_GAP values to build with")
+	shadow.set_defaults(function=command_shadow)
+
+	page = commands.add_parser("page", help="check OLED_render() sends the same frames as the full buffer")
+	page.add_argument("--strips", type=gap_list, default=[1, 2, 4], help="OLED_STRIP_PAGES values to build with")
+	page.set_defaults(function=command_page)
+
+	bench = commands.add_parser("bench", help="time draw functions against the versions they replaced and compare their pixels")
+	bench.set_defaults(function=command_bench)
+
+	args = parser.parse_args()
+	failed = args.function(args)
+	if failed:
+		sys.exit("%d build(s) failed" % failed)
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,278 @@
+#!/usr/bin/env python3
+"""
+Compress the XBM fonts and symbols used by the SH1106 library into the packed asset format.
+
+XBM images store whole bytes for every row, so narrow glyphs waste up to 7 bits a row and
+large solid digits store long runs of set bits one bit at a time. The packed format reads
+the pixels column by column, top to bottom within a column, and stores each image in
+whichever of these encodings is smaller:
+
+    Bits (OLED_PACKED_BITS):	1 bit per pixel, LSB first, no padding between columns.
+    RLE (OLED_PACKED_RLE):		4-bit codes, low nibble first. Runs alternate between clear
+								and set pixels, starting with clear. Code 0 - 14 is a run of
+								that many pixels after which the colour changes, code 15 is
+								15 pixels with no change of colour.
+
+The library decodes the pixels straight into the buffer as vertical runs of set pixels, so
+no RAM is needed to unpack an image in any orientation.
+
+Fonts are written to XBM_fonts/XBM_FONTS_PACKED.c with a table of glyph offsets, bit 15 of
+an offset is set when that glyph is RLE. Fonts left out of --fonts keep their XBM glyphs.
+Each packed font is only built and drawn from when its own option, eg. OLED_PACKED_FONT_16,
+is defined in SH1106.h as well as OLED_PACKED_FONTS. Pre-rotated glyphs are drawn first, so
+only define the option of a font drawn in an orientation that has none, or the table is
+flash that is never read.
+Symbols are written to XBM_symbols/XBM_SYMBOLS_PACKED.c as images for OLED_draw_packed()
+that start with their width, height and encoding.
+
+Usage (from the repository root):
+    python3 tools/pack_assets.py
+    python3 tools/pack_assets.py --fonts 16 20 25
+    python3 tools/pack_assets.py --report
+    python3 tools/pack_assets.py --fonts 16 20 25 --output /tmp/packed
+"""
+
+import argparse
+import os
+import re
+import sys
+
+from rotate_fonts import FONTS, FONT_DIR, parse_font, glyph_pixels, format_bytes
+
+SYMBOL_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "code", "XBM_symbols")
+
+# Fonts packed by default. FONT_8 glyphs are too small for RLE to help, they end up bit
+# packed and take over twice as long to draw for only 284 bytes saved.
+DEFAULT_FONTS = [16, 20, 25]
+
+FONT_OUTPUT_NAME = "XBM_FONTS_PACKED"
+SYMBOL_OUTPUT_NAME = "XBM_SYMBOLS_PACKED"
+
+PACKED_BITS = 0
+PACKED_RLE = 1
+RLE_FLAG = 0x8000
+
+
+def column_bits(pixels, width, height):
+	"""The pixels of an image in the order they are packed, column by column."""
+	return [1 if (column, row) in pixels else 0 for column in range(width) for row in range(height)]
+
+
+def pack_bits(bits):
+	packed = [0] * ((len(bits) + 7) // 8)
+	for i, bit in enumerate(bits):
+		if bit:
+			packed[i // 8] |= 1 << (i % 8)
+	return packed
+
+
+def pack_rle(bits):
+	# Lengths of the alternating runs, starting with clear pixels.
+	runs = []
+	colour = 0
+	length = 0
+	for bit in bits:
+		if bit != colour:
+			runs.append(length)
+			colour = bit
+			length = 0
+		length += 1
+	runs.append(length)
+
+	codes = []
+	for i, length in enumerate(runs):
+		while length >= 15:
+			codes.append(15)
+			length -= 15
+		# The colour change after the last run is not needed.
+		if length or i < len(runs) - 1:
+			codes.append(length)
+
+	packed = [0] * ((len(codes) + 1) // 2)
+	for i, code in enumerate(codes):
+		packed[i // 2] |= code << (4 * (i % 2))
+	return packed, len(codes)
+
+
+def pack_image(pixels, width, height):
+	"""Return (encoding, data, codes read by the decoder, spans drawn by the decoder)."""
+	bits = column_bits(pixels, width, height)
+	bitData = pack_bits(bits)
+	rleData, rleCodes = pack_rle(bits)
+
+	spans = 0
+	for i, bit in enumerate(bits):
+		if bit and (i % height == 0 or not bits[i - 1]):
+			spans += 1
+
+	if len(rleData) < len(bitData):
+		return PACKED_RLE, rleData, rleCodes, spans
+	return PACKED_BITS, bitData, len(bits), spans
+
+
+def parse_symbols():
+	"""Return a list of (name, data, width, height) for the images in XBM_symbols.c."""
+	with open(os.path.join(SYMBOL_DIR, "XBM_symbols.h")) as f:
+		sizes = dict((name, int(value)) for name, value in re.findall(r"#define\s+(\w+)\s+(\d+)", f.read()))
+	with open(os.path.join(SYMBOL_DIR, "XBM_symbols.c")) as f:
+		source = re.sub(r"/\*.*?\*/|//[^\n]*", "", f.read(), flags=re.S)
+
+	symbols = []
+	for match in re.finditer(r"const\s+uint8_t\s+(\w+)\s*\[\d*\]\s*PROGMEM\s*=\s*\{([^}]*)\}", source):
+		name = match.group(1)
+		prefix = re.sub(r"([A-Z])", r"_\1", name).upper()
+		if prefix + "_WIDTH" not in sizes or prefix + "_HEIGHT" not in sizes:
+			sys.exit("XBM_symbols.h: no %s_WIDTH or %s_HEIGHT for %s" % (prefix, prefix, name))
+		data = [int(v.strip(), 0) for v in match.group(2).split(",") if v.strip()]
+		symbols.append((name, data, sizes[prefix + "_WIDTH"], sizes[prefix + "_HEIGHT"]))
+	return symbols
+
+
+def banner(fileName, lines, command, total):
+	return "\n".join([
+		"/*",
+		" **************************************************************",
+		" * " + fileName,
+	] + [" * " + line for line in lines] + [
+		" * Generated by tools/pack_assets.py, do not edit. Regenerate",
+		" * after changing an image with:",
+		" * " + command,
+		" * Total size: %d bytes of flash." % total,
+		" **************************************************************",
+		"*/",
+		"",
+	])
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+	parser.add_argument("--fonts", nargs="*", type=int, default=DEFAULT_FONTS, metavar="SIZE",
+		help="font sizes to pack, the others keep their XBM glyphs")
+	parser.add_argument("--report", action="store_true",
+		help="print the size and decode work of every font and symbol without writing any files")
+	parser.add_argument("--output", help="directory for all the generated files, default XBM_fonts and XBM_symbols")
+	args = parser.parse_args()
+	fontDir = args.output or FONT_DIR
+	symbolDir = args.output or SYMBOL_DIR
+
+	for size in args.fonts:
+		if size not in FONTS:
+			sys.exit("unknown font size %d" % size)
+	command = "python3 tools/pack_assets.py --fonts " + " ".join(str(size) for size in sorted(args.fonts))
+
+	report = ["%-24s %8s %8s %8s %14s %14s" % ("asset", "xbm", "packed", "saved", "codes/glyph", "spans/glyph")]
+	source = []
+	header = []
+	fontTotal = 0
+
+	for size in sorted(FONTS):
+		fileName, name, height = FONTS[size]
+		glyphs = parse_font(os.path.join(FONT_DIR, fileName), name)
+
+		data = []
+		offsets = []
+		codes = 0
+		spans = 0
+		rawSize = 2 * len(glyphs)		# The glyph pointer table is not needed once packed
+		for index, (glyph, width) in enumerate(glyphs):
+			try:
+				pixels = glyph_pixels(glyph, width, height)
+			except ValueError as error:
+				sys.exit("%s glyph %d: %s" % (name, index, error))
+			encoding, packed, glyphCodes, glyphSpans = pack_image(pixels, width, height)
+			offsets.append(len(data) | (RLE_FLAG if encoding == PACKED_RLE else 0))
+			data.extend(packed)
+			codes += glyphCodes
+			spans += glyphSpans
+			rawSize += ((width + 7) // 8) * height
+		if len(data) >= RLE_FLAG:
+			sys.exit("%s: %d bytes of packed glyphs is too many for the offset table" % (name, len(data)))
+
+		packedSize = len(data) + 2 * len(offsets)
+		report.append("%-24s %8d %8d %8d %14.1f %14.1f" % (
+			name, rawSize, packedSize, rawSize - packedSize, codes / len(glyphs), spans / len(glyphs)))
+
+		if size not in args.fonts:
+			header.append("#define %s_IS_PACKED\t0\t/* 1 = glyphs in %s_PACKED, 0 = XBM glyphs */" % (name, name))
+			header.append("")
+			continue
+
+		fontTotal += packedSize
+		header.append("#if defined(OLED_PACKED_FONTS) && defined(OLED_PACKED_%s)" % name)
+		header.append("#define %s_IS_PACKED\t1\t/* 1 = glyphs in %s_PACKED, 0 = XBM glyphs */" % (name, name))
+		header.append("#else")
+		header.append("#define %s_IS_PACKED\t0" % name)
+		header.append("#endif")
+		header.append("extern const uint8_t %s_PACKED[] PROGMEM;" % name)
+		header.append("extern const uint16_t %s_PACKED_OFFSETS[] PROGMEM;" % name)
+		header.append("")
+		source.append("#if %s_IS_PACKED\n" % name)
+		source.append("const uint8_t %s_PACKED[] PROGMEM =\n{\n%s\n};\n" % (name, format_bytes(data)))
+		source.append("const uint16_t %s_PACKED_OFFSETS[] PROGMEM =\n{\n\t%s\n};\n" % (
+			name, ", ".join("0x%04x" % o for o in offsets)))
+		source.append("#endif /* %s_IS_PACKED */\n" % name)
+
+	symbolSource = []
+	symbolHeader = []
+	symbolTotal = 0
+
+	for name, xbm, width, height in parse_symbols():
+		try:
+			pixels = glyph_pixels(xbm, width, height)
+		except ValueError as error:
+			sys.exit("%s: %s" % (name, error))
+		encoding, packed, codes, spans = pack_image(pixels, width, height)
+		data = [width, height, encoding] + packed
+
+		symbolTotal += len(data)
+		report.append("%-24s %8d %8d %8d %14d %14d" % (
+			name, len(xbm), len(data), len(xbm) - len(data), codes, spans))
+		symbolHeader.append("extern const uint8_t %sPacked[] PROGMEM;" % name)
+		symbolSource.append("const uint8_t %sPacked[] PROGMEM =\n{\n\t%d, %d, %s,\n%s\n};\n" % (
+			name, width, height, "OLED_PACKED_RLE" if encoding == PACKED_RLE else "OLED_PACKED_BITS",
+			format_bytes(packed)))
+
+	if args.report:
+		print("\n".join(report))
+		return
+
+	fontBanner = banner(FONT_OUTPUT_NAME + "%s", [
+		"Compressed glyphs for the XBM fonts, used by the SH1106",
+		"library when OLED_PACKED_FONTS and the option of the font,",
+		"eg. OLED_PACKED_FONT_16, are defined, see SH1106.h.",
+	], command, fontTotal)
+
+	with open(os.path.join(fontDir, FONT_OUTPUT_NAME + ".h"), "w") as f:
+		f.write(fontBanner % ".h")
+		f.write("\n#ifndef %s_H_\n#define %s_H_\n\n" % (FONT_OUTPUT_NAME, FONT_OUTPUT_NAME))
+		f.write("/* The font options, the fonts include this before SH1106.h */\n#include \"../SH1106.h\"\n\n")
+		f.write("\n".join(header))
+		f.write("\n#endif /* %s_H_ */\n" % FONT_OUTPUT_NAME)
+
+	with open(os.path.join(fontDir, FONT_OUTPUT_NAME + ".c"), "w") as f:
+		f.write(fontBanner % ".c")
+		f.write("\n#include <avr/pgmspace.h>\n#include \"../SH1106.h\"\n#include \"%s.h\"\n\n" % FONT_OUTPUT_NAME)
+		f.write("\n".join(source))
+
+	symbolBanner = banner(SYMBOL_OUTPUT_NAME + "%s", [
+		"Compressed copies of the images in XBM_symbols.c, drawn",
+		"with OLED_draw_packed().",
+	], command, symbolTotal)
+
+	with open(os.path.join(symbolDir, SYMBOL_OUTPUT_NAME + ".h"), "w") as f:
+		f.write(symbolBanner % ".h")
+		f.write("\n#ifndef %s_H_\n#define %s_H_\n\n" % (SYMBOL_OUTPUT_NAME, SYMBOL_OUTPUT_NAME))
+		f.write("\n".join(symbolHeader))
+		f.write("\n\n#endif /* %s_H_ */\n" % SYMBOL_OUTPUT_NAME)
+
+	with open(os.path.join(symbolDir, SYMBOL_OUTPUT_NAME + ".c"), "w") as f:
+		f.write(symbolBanner % ".c")
+		f.write("\n#include <avr/pgmspace.h>\n#include \"../SH1106_OLED/SH1106.h\"\n#include \"%s.h\"\n\n" % SYMBOL_OUTPUT_NAME)
+		f.write("\n".join(symbolSource))
+
+	print("%s: %d bytes" % (FONT_OUTPUT_NAME, fontTotal))
+	print("%s: %d bytes" % (SYMBOL_OUTPUT_NAME, symbolTotal))
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""
+Generate pre-rotated, page-packed copies of the XBM fonts used by the SH1106 library.
+
+The XBM fonts store each glyph as rows of LSB-first bits. Drawing them at 90, 180 or 270
+degrees means rotating every glyph at runtime. This script does the rotation on the host
+and writes each glyph as the column bytes the SH1106 buffer uses (bit 0 = top pixel of
+the page), already in the orientation it will be drawn in, so the library only has to
+copy bytes.
+
+Only the orientations listed for each font are generated so unused ones cost no flash.
+The defaults match what the roll clock modes use.
+
+Usage (from the repository root):
+    python3 tools/rotate_fonts.py
+    python3 tools/rotate_fonts.py --orientations 8:1,2,3 16:0,1 20: 25:0
+"""
+
+import argparse
+import os
+import re
+import sys
+
+FONT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "code", "SH1106_OLED", "XBM_fonts")
+
+# Font size -> (source file, glyph pointer array name, glyph height)
+FONTS = {
+	8: ("XBM_FONT_8.c", "FONT_8", 8),
+	16: ("XBM_FONT_16.c", "FONT_16", 16),
+	20: ("XBM_FONT_NUMBERS_20.c", "FONT_20", 20),
+	25: ("XBM_FONT_NUMBERS_25.c", "FONT_25", 25),
+}
+
+# Orientations used by MODE_A (0), MODE_B (1), MODE_C (2) and MODE_D (3).
+DEFAULT_ORIENTATIONS = {
+	8: [1, 2, 3],
+	16: [0, 1],
+	20: [],
+	25: [0],
+}
+
+OUTPUT_NAME = "XBM_FONTS_ROTATED"
+
+
+def parse_font(path, pointerArrayName):
+	"""Return a list of (glyph bytes, width) in the order of the font's pointer array."""
+	with open(path) as f:
+		source = re.sub(r"/\*.*?\*/|//[^\n]*", "", f.read(), flags=re.S)
+
+	arrays = {}
+	for match in re.finditer(r"const\s+uint8_t\s+(?:const\s+)?(\w+)\s*\[\d*\]\s*PROGMEM\s*=\s*\{([^}]*)\}", source):
+		values = [v.strip() for v in match.group(2).split(",") if v.strip()]
+		arrays[match.group(1)] = [int(v, 0) for v in values]
+
+	pointers = re.search(r"const\s+uint8_t\s*\*\s*const\s+" + pointerArrayName + r"\s*\[\]\s*PROGMEM\s*=\s*\{([^}]*)\}", source)
+	if not pointers:
+		sys.exit("%s: pointer array %s not found" % (path, pointerArrayName))
+	names = re.findall(r"\(const uint8_t\s*\*\)\s*(\w+)", pointers.group(1))
+
+	widths = arrays[pointerArrayName + "_WIDTHS"]
+	if len(widths) < len(names):
+		sys.exit("%s: %d glyphs but only %d widths" % (path, len(names), len(widths)))
+
+	return [(arrays[name], widths[i]) for i, name in enumerate(names)]
+
+
+def glyph_pixels(data, width, height):
+	"""Unpack an XBM glyph into a set of (column, row) pixels, ignoring the row padding bits."""
+	rowBytes = (width + 7) // 8
+	if len(data) < rowBytes * height:
+		raise ValueError("glyph has %d bytes, expected %d" % (len(data), rowBytes * height))
+
+	pixels = set()
+	for row in range(height):
+		for column in range(width):
+			if data[row * rowBytes + column // 8] & (1 << (column % 8)):
+				pixels.add((column, row))
+	return pixels
+
+
+def rotate(pixels, width, height, orientation):
+	"""
+	Rotate the pixels the same way OLED_draw_xbm() does and return (pixels, width, height) of the
+	rotated glyph, with (0, 0) at its top left corner on the screen.
+	"""
+	if orientation == 0:
+		return pixels, width, height
+	if orientation == 1:
+		return {(height - 1 - r, c) for c, r in pixels}, height, width
+	if orientation == 2:
+		return {(width - 1 - c, height - 1 - r) for c, r in pixels}, width, height
+	return {(r, width - 1 - c) for c, r in pixels}, height, width
+
+
+def page_pack(pixels, width, height):
+	"""Pack the pixels into pages of column bytes, page by page."""
+	packed = []
+	for page in range((height + 7) // 8):
+		for column in range(width):
+			byte = 0
+			for bit in range(8):
+				if (column, page * 8 + bit) in pixels:
+					byte |= 1 << bit
+			packed.append(byte)
+	return packed
+
+
+def format_bytes(values, perLine=16):
+	lines = []
+	for i in range(0, len(values), perLine):
+		lines.append("\t" + ",".join("0x%02x" % v for v in values[i:i + perLine]) + ",")
+	return "\n".join(lines)
+
+
+def parse_orientations(arguments):
+	orientations = dict(DEFAULT_ORIENTATIONS)
+	for argument in arguments or []:
+		size, _, values = argument.partition(":")
+		size = int(size)
+		if size not in FONTS:
+			sys.exit("unknown font size %d" % size)
+		orientations[size] = sorted({int(v) for v in values.split(",") if v != ""})
+		if any(o not in range(4) for o in orientations[size]):
+			sys.exit("orientations must be 0-3")
+	return orientations
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+	parser.add_argument("--orientations", nargs="*", metavar="SIZE:O,O",
+		help="orientations to generate for a font, eg 8:1,2,3 or 20: for none")
+	parser.add_argument("--output", default=FONT_DIR, help="directory for the generated files")
+	args = parser.parse_args()
+
+	orientations = parse_orientations(args.orientations)
+	command = "python3 tools/rotate_fonts.py --orientations " + " ".join(
+		"%d:%s" % (size, ",".join(str(o) for o in orientations[size])) for size in sorted(FONTS))
+
+	source = []
+	header = []
+	total = 0
+
+	for size in sorted(FONTS):
+		fileName, name, height = FONTS[size]
+		glyphs = parse_font(os.path.join(FONT_DIR, fileName), name)
+		mask = sum(1 << o for o in orientations[size])
+
+		header.append("#define %s_ROTATIONS\t0x%02x\t/* Bit n set = glyphs pre-rotated for screenOrientation n */" % (name, mask))
+		header.append("extern const uint8_t* const %s_ROTATED[] PROGMEM;" % name)
+		header.append("extern const uint16_t* const %s_ROTATED_OFFSETS[] PROGMEM;" % name)
+		header.append("")
+
+		for orientation in orientations[size]:
+			data = []
+			offsets = []
+			for index, (glyph, width) in enumerate(glyphs):
+				try:
+					pixels = glyph_pixels(glyph, width, height)
+				except ValueError as error:
+					sys.exit("%s glyph %d: %s" % (name, index, error))
+				offsets.append(len(data))
+				data.extend(page_pack(*rotate(pixels, width, height, orientation)))
+
+			total += len(data) + 2 * len(offsets)
+			source.append("const uint8_t %s_ROTATED_%d[] PROGMEM =\n{\n%s\n};\n" % (name, orientation, format_bytes(data)))
+			source.append("const uint16_t %s_ROTATED_%d_OFFSETS[] PROGMEM =\n{\n\t%s\n};\n" % (
+				name, orientation, ", ".join(str(o) for o in offsets)))
+
+		# The tables are always generated, a 0 entry means that orientation is drawn at runtime.
+		for table, suffix in (("uint8_t", ""), ("uint16_t", "_OFFSETS")):
+			entries = ", ".join(
+				"%s_ROTATED_%d%s" % (name, o, suffix) if o in orientations[size] else "0" for o in range(4))
+			source.append("const %s* const %s_ROTATED%s[] PROGMEM =\n{\n\t%s\n};\n" % (table, name, suffix, entries))
+
+	banner = "\n".join([
+		"/*",
+		" **************************************************************",
+		" * %s",
+		" * Pre-rotated, page-packed glyphs for the XBM fonts, used by",
+		" * the SH1106 library when OLED_PRE_ROTATED_FONTS is defined.",
+		" * Generated by tools/rotate_fonts.py, do not edit. Regenerate",
+		" * after changing a font with:",
+		" * " + command,
+		" * Total size: %d bytes of flash." % total,
+		" **************************************************************",
+		"*/",
+		"",
+	])
+
+	with open(os.path.join(args.output, OUTPUT_NAME + ".h"), "w") as f:
+		f.write(banner % (OUTPUT_NAME + ".h"))
+		f.write("\n#ifndef %s_H_\n#define %s_H_\n\n" % (OUTPUT_NAME, OUTPUT_NAME))
+		f.write("\n".join(header))
+		f.write("\n#endif /* %s_H_ */\n" % OUTPUT_NAME)
+
+	with open(os.path.join(args.output, OUTPUT_NAME + ".c"), "w") as f:
+		f.write(banner % (OUTPUT_NAME + ".c"))
+		f.write("\n#include <avr/pgmspace.h>\n#include \"../SH1106.h\"\n#include \"%s.h\"\n\n" % OUTPUT_NAME)
+		f.write("#ifdef OLED_PRE_ROTATED_FONTS\n\n")
+		f.write("\n".join(source))
+		f.write("\n#endif /* OLED_PRE_ROTATED_FONTS */\n")
+
+	print("%s: %d bytes" % (OUTPUT_NAME, total))
+
+
+if __name__ == "__main__":
+	main()